@@ -0,0 +1,8 @@
+#! /usr/bin/env python
+
+# Programs that are runnable.
+ns3_runnable_programs = ['build/scratch/ns3-dev-evaluate_edmg_throughput-debug', 'build/scratch/ns3-dev-evaluate_fst_mechanism-debug', 'build/scratch/ns3-dev-evaluate_beacon_interval-debug', 'build/scratch/ns3-dev-evaluate_ap_clustering-debug', 'build/scratch/ns3-dev-evaluate_fullduplex_relay-debug', 'build/scratch/ns3-dev-evaluate_ati_polling-debug', 'build/scratch/subdir/ns3-dev-subdir-debug', 'build/scratch/ns3-dev-evaluate_beamforming-debug', 'build/scratch/ns3-dev-evaluate_dmg_throughput-debug', 'build/scratch/ns3-dev-evaluate_pcp_handover-debug', 'build/scratch/ns3-dev-evaluate_service_period-debug', 'build/scratch/ns3-dev-scratch-simulator-debug', 'build/scratch/ns3-dev-evaluate_abft_contention-debug']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
@@ -0,0 +1,656 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@hotmail.com>
+ */
+#ifndef DMG_AP_WIFI_MAC_H
+#define DMG_AP_WIFI_MAC_H
+
+#include "ns3/random-variable-stream.h"
+#include <set>
+
+#include "amsdu-subframe-header.h"
+#include "ctrl-headers.h"
+#include "dmg-beacon-dca.h"
+#include "dmg-beacon-interval-clock.h"
+#include "dmg-wifi-mac.h"
+
+namespace ns3 {
+
+#define TU                      1024            /* Time Unit defined in 802.11 std */
+#define aMaxBIDuration          TU * 1024       /* Maximum BI Duration Defined in 802.11ad */
+#define aMinChannelTime         aMaxBIDuration  /* Minimum Channel Time for Clustering */
+#define aMinSSSlotsPerABFT      1               /* Minimum Number of Sector Sweep Slots Per A-BFT */
+#define aSSFramesPerSlot        8               /* Number of SSW Frames per Sector Sweep Slot */
+#define aDMGPPMinListeningTime  150             /* The minimum time between two adjacent SPs with the same source or destination AIDs*/
+#define aMaxAllocationBlockDuration 32767      /* Maximum duration of an allocation block in microseconds */
+#define MAX_ALLOCATION_ID       15              /* Largest value of the 4-bit Allocation ID subfield */
+#define dot11MaxClusterRequests 3               /* Number of BIs during which a PCP/AP retries to join a centralized cluster */
+#define dot11PcpHandoverAnnouncements 10       /* Number of BIs during which a new PCP announces that it took over a PBSS */
+
+/**
+ * The clustering mode of a DMG PCP/AP, see 802.11ad 10.37 (PCP/AP clustering).
+ */
+enum ClusteringMode
+{
+  NO_CLUSTERING = 0,
+  DECENTRALIZED_CLUSTERING = 1,
+  CENTRALIZED_CLUSTERING = 2
+};
+
+/**
+ * The order in which a DMG PCP/AP polls its associated DMG STAs during the ATI.
+ */
+enum AtiPollingPolicy
+{
+  ATI_POLL_ROUND_ROBIN = 0,     //!< Start each ATI with the DMG STA following the first one polled in the previous ATI.
+  ATI_POLL_PRIORITY = 1         //!< Poll the DMG STAs with the largest buffered traffic reported so far first.
+};
+
+/**
+ * \brief Wi-Fi DMG AP state machine
+ * \ingroup wifi
+ *
+ * Handle association, dis-association and authentication,
+ * of DMG STAs within an infrastructure DMG BSS.
+ */
+class DmgApWifiMac : public DmgWifiMac
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DmgApWifiMac ();
+  virtual ~DmgApWifiMac ();
+  /**
+   * \param stationManager the station manager attached to this MAC.
+   */
+  virtual void SetWifiRemoteStationManager (Ptr<WifiRemoteStationManager> stationManager);
+
+  /**
+   * \param linkUp the callback to invoke when the link becomes up.
+   */
+  virtual void SetLinkUpCallback (Callback<void> linkUp);
+  /**
+   * \param packet the packet to send.
+   * \param to the address to which the packet should be sent.
+   *
+   * The packet should be enqueued in a tx queue, and should be
+   * dequeued as soon as the channel access function determines that
+   * access is granted to this MAC.
+   */
+  virtual void Enqueue (Ptr<const Packet> packet, Mac48Address to);
+  /**
+   * \param packet the packet to send.
+   * \param to the address to which the packet should be sent.
+   * \param from the address from which the packet should be sent.
+   *
+   * The packet should be enqueued in a tx queue, and should be
+   * dequeued as soon as the channel access function determines that
+   * access is granted to this MAC. The extra parameter "from" allows
+   * this device to operate in a bridged mode, forwarding received
+   * frames without altering the source address.
+   */
+  virtual void Enqueue (Ptr<const Packet> packet, Mac48Address to, Mac48Address from);
+  virtual bool SupportsSendFrom (void) const;
+  /**
+   * \param address the current address of this MAC layer.
+   */
+  virtual void SetAddress (Mac48Address address);
+  /**
+   * \param interval the interval between two beacon transmissions.
+   */
+  void SetBeaconInterval (Time interval);
+  /**
+   * \return the interval between two beacon transmissions.
+   */
+  Time GetBeaconInterval (void) const;
+  /**
+   * \param interval the interval.
+   */
+  void SetBeaconTransmissionInterval (Time interval);
+  /**
+   * \return the interval between two beacon transmissions.
+   */
+  Time GetBeaconTransmissionInterval (void) const;
+  /**
+   * Allocate CBAP period to be announced in DMG Beacon or Announce Frame.
+   * \param staticAllocation Is the allocation static.
+   * \param allocationStart The start time of the allocation relative to the beginning of DTI.
+   * \param blockDuration The duration of the allocation period.
+   * \return The start of the next allocation period.
+   */
+  uint32_t AllocateCbapPeriod (bool staticAllocation, uint32_t allocationStart, uint16_t blockDuration);
+  /**
+   * Add a new allocation period to be announced in DMG Beacon or Announce Frame.
+   * \param allocationID The unique identifier o
+   * \param allocationType The type of the allocation (CBAP or SP).
+   * \param staticAllocation Is the allocation static.
+   * \param sourceAid The AID of the source DMG STA.
+   * \param destAid The AID of the destination DMG STA.
+   * \param allocationStart The start time of the allocation relative to the beginning of DTI.
+   * \param blockDuration The duration of the allocation period.
+   * \return The start of the next allocation period.
+   */
+  uint32_t AddAllocationPeriod (AllocationID allocationID,
+                                AllocationType allocationType, bool staticAllocation,
+                                uint8_t sourceAid, uint8_t destAid,
+                                uint32_t allocationStart, uint16_t blockDuration);
+  /**
+   * AllocateBeamformingServicePeriod
+   * \param sourceAid The AID of the source DMG STA.
+   * \param destAid The AID of the destination DMG STA.
+   * \param allocationStart The start time of the allocation relative to the beginning of DTI.
+   * \param isTxss Is the Beamforming TxSS or RxSS.
+   * \return The start of the next allocation period.
+   */
+  uint32_t AllocateBeamformingServicePeriod (uint8_t sourceAid, uint8_t destAid,
+                                             uint32_t allocationStart, bool isTxss);
+  /**
+   * \return The beacon interval clock shared with the associated DMG STAs or 0 if disabled.
+   */
+  Ptr<DmgBeaconIntervalClock> GetBeaconIntervalClock (void) const;
+  /**
+   * \return The role of this PCP/AP in its cluster.
+   */
+  enum ClusterMemberRole GetClusterMemberRole (void) const;
+  /**
+   * \return The index of the Beacon SP of this PCP/AP in its cluster (1 for the S-AP) or 0 if not clustered.
+   */
+  uint8_t GetBeaconSpIndex (void) const;
+  /**
+   * Hand our PBSS over to the first DMG STA of the next PCP list (explicit PCP handover). The DMG STA
+   * receives our association table and allocation schedule and takes over after remainingBIs BIs.
+   * \param reason The reason of the handover announced in the Handover Request.
+   * \param remainingBIs The number of BIs, following the current one, before the new PCP takes over.
+   * \return False if none of the associated DMG STAs supports PCP handover.
+   */
+  bool InitiatePcpHandover (enum HandoverReason reason, uint8_t remainingBIs);
+  /**
+   * \return True if we operate the BIs of a PBSS, false as a standby PCP or after handing our PBSS over.
+   */
+  bool IsPcp (void) const;
+
+protected:
+  friend class DmgBeaconDca;
+
+  Time GetBTIRemainingTime (void) const;
+
+private:
+  virtual void DoDispose (void);
+  virtual void DoInitialize (void);
+
+  void StartBeaconInterval (void);
+  void StartBeaconTransmissionInterval (void);
+  /**
+   * Spend the BTI of this BI listening for DMG Beacons of cluster members sharing our Beacon SP.
+   */
+  void ListenBeaconTransmissionInterval (void);
+  void StartAssociationBeamformTraining (void);
+  void StartAnnouncementTransmissionInterval (void);
+  void StartDataTransmissionInterval (void);
+  void FrameTxOk (const WifiMacHeader &hdr);
+  virtual void BrpSetupCompleted (Mac48Address address);
+  virtual void NotifyBrpPhaseCompleted (void);
+  virtual void Receive (Ptr<Packet> packet, const WifiMacHeader *hdr);
+  /**
+   * The packet we sent was successfully received by the receiver
+   * (i.e. we received an ACK from the receiver). If the packet
+   * was an association response to the receiver, we record that
+   * the receiver is now associated with us.
+   *
+   * \param hdr the header of the packet that we successfully sent
+   */
+  virtual void TxOk (Ptr<const Packet> packet, const WifiMacHeader &hdr);
+  /**
+   * The packet we sent was not successfully received by the receiver
+   * (i.e. we did not receive an ACK from the receiver). If the packet
+   * was an association response to the receiver, we record that
+   * the receiver is not associated with us yet.
+   *
+   * \param hdr the header of the packet that we failed to sent
+   */
+  virtual void TxFailed (const WifiMacHeader &hdr);
+  /**
+   * This method is called to de-aggregate an A-MSDU and forward the
+   * constituent packets up the stack. We override the WifiMac version
+   * here because, as an AP, we also need to think about redistributing
+   * to other associated STAs.
+   *
+   * \param aggregatedPacket the Packet containing the A-MSDU.
+   * \param hdr a pointer to the MAC header for \c aggregatedPacket.
+   */
+  virtual void DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const WifiMacHeader *hdr);
+  /**
+   * Get MultiBand Element corresponding to this DMG STA.
+   * \return Pointer to the MultiBand element.
+   */
+  Ptr<MultiBandElement> GetMultiBandElement (void) const;
+  /**
+   * Start A-BFT Sector Sweep Slot.
+   */
+  void StartSectorSweepSlot (void);
+  /**
+   * End the current A-BFT Sector Sweep Slot and report its occupancy.
+   */
+  void EndSectorSweepSlot (void);
+  /**
+   * Establish BRP Setup Subphase
+   */
+  void DoBrpSetupSubphase (void);
+  /**
+   * Forward the packet down to DCF/EDCAF (enqueue the packet). This method
+   * is a wrapper for ForwardDown with traffic id.
+   *
+   * \param packet the packet we are forwarding to DCF/EDCAF
+   * \param from the address to be used for Address 3 field in the header
+   * \param to the address to be used for Address 1 field in the header
+   */
+  void ForwardDown (Ptr<const Packet> packet, Mac48Address from, Mac48Address to);
+  /**
+   * Forward the packet down to DCF/EDCAF (enqueue the packet).
+   *
+   * \param packet the packet we are forwarding to DCF/EDCAF
+   * \param from the address to be used for Address 3 field in the header
+   * \param to the address to be used for Address 1 field in the header
+   * \param tid the traffic id for the packet
+   */
+  void ForwardDown (Ptr<const Packet> packet, Mac48Address from, Mac48Address to, uint8_t tid);
+  /**
+   * Forward a probe response packet to the DCF. The standard is not clear on the correct
+   * queue for management frames if QoS is supported. We always use the DCF.
+   *
+   * \param to the MAC address of the STA we are sending a probe response to.
+   */
+  void SendProbeResp (Mac48Address to);
+  /**
+   * Forward an association response packet to the DCF. The standard is not clear on the correct
+   * queue for management frames if QoS is supported. We always use the DCF.
+   *
+   * \param to the MAC address of the STA we are sending an association response to.
+   * \param success indicates whether the association was successful or not.
+   */
+  void SendAssocResp (Mac48Address to, bool success);
+  /**
+   * Send Announce Frame
+   * \param to The MAC address of the DMG STA.
+   */
+  void SendAnnounceFrame (Mac48Address to);
+  /**
+   * Build the list of the associated DMG STAs to poll one after the other during the ATI for their SP requests.
+   */
+  void StartAtiPolling (void);
+  /**
+   * Poll the next DMG STA of this ATI, if the remaining ATI still fits a Poll/SPR exchange.
+   */
+  void PollNextStation (void);
+  /**
+   * Send a Poll frame during the ATI.
+   * \param to The MAC address of the DMG STA.
+   */
+  void SendPollFrame (Mac48Address to);
+  /**
+   * The polled DMG STA did not answer within AtiPollTimeout.
+   */
+  void PollTimeout (void);
+  /**
+   * Record the SP request of the polled DMG STA.
+   * \param from The MAC address of the DMG STA.
+   * \param spr The SPR frame of the DMG STA.
+   */
+  void ReceiveSprFrame (Mac48Address from, const CtrlDMG_SPR &spr);
+  /**
+   * Report the ATI utilization and turn the SP requests collected during the ATI into SPs of the next BI.
+   */
+  void EndAtiPolling (void);
+  /**
+   * Return the DMG capability of the current AP.
+   * \return the DMG capability that we support
+   */
+  Ptr<DmgCapabilities> GetDmgCapabilities (void) const;
+  /**
+   * Get DMG Operation Element.
+   * \return Pointer to the DMG Operation element.
+   */
+  Ptr<DmgOperationElement> GetDmgOperationElement (void) const;
+  /**
+   * Get Next DMG ATI Element Information Element.
+   * \return
+   */
+  Ptr<NextDmgAti> GetNextDmgAtiElement (void) const;
+  /**
+   * Get Extended Schedule Element.
+   * \return
+   */
+  Ptr<ExtendedScheduleElement> GetExtendedScheduleElement (void) const;
+  /**
+   * Cleanup non-static allocations. This is method is called after the transmission of the last DMG Beacon.
+   */
+  void CleanupAllocations (void);
+  /**
+   * Send One DMG Beacon Frame with the provided arguments.
+   * \param antennaID The ID of the current Antenna.
+   * \param sectorID The ID of the current sector in the antenna.
+   * \param count Number of remaining DMG Beacons till the end of BTI.
+   */
+  void SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Get the Clustering Control field announced in our DMG Beacons.
+   * \return The Clustering Control field.
+   */
+  ExtDMGClusteringControlField GetClusteringControlField (void) const;
+  /**
+   * Listen to the channel for ClusterMonitorDuration before starting the first BI, in order to
+   * find the Beacon SPs of the cluster we are about to join.
+   */
+  void StartClusterMonitoring (void);
+  /**
+   * Select a Beacon SP of the monitored cluster or form a new cluster if we did not find any.
+   */
+  void EndClusterMonitoring (void);
+  /**
+   * Record the Beacon SP occupied by the sender of a DMG Beacon received during cluster monitoring.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ReceiveClusterBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * Move to another empty Beacon SP if a member of our decentralized cluster sends its DMG Beacons in ours.
+   * Of the two colliding PCP/APs, the one with the higher MAC address moves.
+   * \param beacon The DMG Beacon received during our BTI.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ResolveBeaconSpCollision (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * \return The index of a randomly selected Beacon SP without DMG Beacons, or 0 if all of them are occupied.
+   */
+  uint8_t SelectEmptyBeaconSp (void);
+  /**
+   * Start our BIs in the Beacon SP of the cluster with the given index.
+   * \param beaconSpIndex The index of the Beacon SP (1 for the S-AP).
+   */
+  void JoinCluster (uint8_t beaconSpIndex);
+  /**
+   * Operate as the S-AP of a new cluster.
+   */
+  void FormCluster (void);
+  /**
+   * \param beaconSpIndex The index of a Beacon SP in the cluster.
+   * \return The earliest start time of the Beacon SP strictly after now.
+   */
+  Time GetNextBeaconSpStart (uint8_t beaconSpIndex) const;
+  /**
+   * \return The time between the start of two consecutive Beacon SPs of the cluster.
+   */
+  Time GetBeaconSpSpacing (void) const;
+  /**
+   * Recompute the quiet periods of the DTI protecting the Beacon SPs of the other cluster members.
+   * Called at the start of each BI, before the DMG Beacons announcing them are sent.
+   */
+  void UpdateQuietPeriods (void);
+  /**
+   * Start a Cluster Request sweep toward the S-AP of a centralized cluster.
+   */
+  void StartClusterRequestSweep (void);
+  /**
+   * Send one Cluster Request frame of the sweep toward the S-AP.
+   * \param sectorID The ID of the current sector.
+   * \param antennaID The ID of the current antenna.
+   * \param count Number of remaining Cluster Request frames till the end of the sweep.
+   */
+  void SendClusterRequest (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Send a Cluster Response assigning a Beacon SP to the requesting PCP/AP.
+   * \param to The MAC address of the requesting PCP/AP.
+   * \param bestSectorId The best sector to reach the requesting PCP/AP as fed back in its Cluster Request.
+   * \param bestAntennaId The best antenna to reach the requesting PCP/AP as fed back in its Cluster Request.
+   */
+  void SendClusterResponse (Mac48Address to, uint8_t bestSectorId, uint8_t bestAntennaId);
+  /**
+   * Derive the start of the BI of another PCP/AP from one of its DMG Beacons, the same way the DMG STAs do.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   * \return The start time of the BI in which the DMG Beacon was sent.
+   */
+  Time GetBeaconIntervalStart (ExtDMGBeacon &beacon, const WifiMacHeader *hdr) const;
+  /**
+   * Recompute the next PCP list from the DMG Capabilities of the associated DMG STAs, and send a copy of
+   * our association table and allocation schedule to the first next PCP whenever it changes.
+   * Called at the start of each BI.
+   */
+  void UpdateNextPcpList (void);
+  /**
+   * Send an Information Response carrying the DMG Capabilities of all the associated DMG STAs and our
+   * allocation schedule to the DMG STA that takes over our PBSS.
+   * \param to The MAC address of the next PCP.
+   */
+  void SendPcpStateTransfer (Mac48Address to);
+  /**
+   * Send a Handover Request frame to a DMG STA of the next PCP list.
+   * \param to The MAC address of the candidate PCP.
+   * \param reason The reason of the handover.
+   * \param remainingBIs The number of BIs before the handover takes effect.
+   */
+  void SendHandoverRequest (Mac48Address to, enum HandoverReason reason, uint8_t remainingBIs);
+  /**
+   * Send a Handover Response frame to the PCP.
+   * \param to The MAC address of the PCP.
+   * \param accept Whether we accept to take over the PBSS.
+   */
+  void SendHandoverResponse (Mac48Address to, bool accept);
+  /**
+   * Stop our BIs once the new PCP has taken over our PBSS.
+   */
+  void LeavePbss (void);
+  /**
+   * Listen to the DMG Beacons of the PCP of our SSID instead of starting our own PBSS.
+   */
+  void StartStandbyPcp (void);
+  /**
+   * Follow the BIs of the PCP from one of its DMG Beacons: train our link with the PCP in the A-BFT,
+   * contend in its DTI and watch for the loss of the PCP or for a handover to us.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ReceivePcpBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * Start our responder sector sweep toward the PCP in an SSW slot of its A-BFT.
+   * \param ssFramesPerSlot The number of SSW frames per SSW slot announced by the PCP.
+   */
+  void StartStandbySectorSweep (uint8_t ssFramesPerSlot);
+  /**
+   * Send one SSW frame of our responder sector sweep toward the PCP.
+   * \param sectorID The ID of the current sector.
+   * \param antennaID The ID of the current antenna.
+   * \param count Number of remaining SSW frames till the end of the sweep.
+   */
+  void SendStandbySectorSweepFrame (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Contend for the channel in a CBAP of the DTI of the PCP.
+   * \param allocationID The ID of the CBAP.
+   * \param contentionDuration The duration of the CBAP.
+   */
+  void StartStandbyContention (AllocationID allocationID, Time contentionDuration);
+  /**
+   * Associate with the PCP as a PCP-capable DMG STA.
+   */
+  void SendStandbyAssociationRequest (void);
+  /**
+   * We did not receive any DMG Beacon from the PCP for ImplicitHandoverLostBeacons BIs.
+   */
+  void PcpLost (void);
+  /**
+   * Take over the PBSS of the PCP we followed: install the association table and the allocation schedule
+   * transferred by the PCP and start our BIs on its BI grid.
+   */
+  void TakeOverPbss (void);
+
+  /** BTI Period Variables **/
+  Ptr<DmgBeaconDca> m_beaconDca;        //!< Dedicated DcaTxop for beacons.
+  EventId m_beaconEvent;		//!< Event to generate one beacon.
+  DcfManager *m_beaconDcfManager;       //!< DCF manager (access to channel)
+  Time m_btiRemaining;                  //!< Remaining Time to the end of the current BTI.
+  Time m_beaconTransmitted;             //!< The time at which we transmitted DMG Beacon.
+  std::vector<ANTENNA_CONFIGURATION> m_antennaConfigurationTable; //! Table with the current antenna configuration.
+  uint32_t m_antennaConfigurationIndex; //! Index of the current antenna configuration.
+  uint32_t m_antennaConfigurationOffset;//! The first antenna configuration to start BTI with.
+  bool m_beaconRandomization;           //!< Flag to indicate whether we want to randomize selection of DMG Beacon at each BI.
+
+  /** A-BFT Access Period Variables **/
+  bool m_isResponderTXSS;               //!< Flag to indicate if RSS in A-BFT is TxSS or RxSS.
+  uint8_t m_abftPeriodicity;            //!< The periodicity of the A-BFT in DMG Beacon.
+  /* Ensure only one DMG STA is communicating with us during single A-BFT slot */
+  bool m_receivedOneSSW;                //!< Flag to indicate if we received SSW Frame during SSW-Slot in A-BFT.
+  Mac48Address m_peerAbftStation;       //!< The MAC address of the station we received SSW from.
+  uint8_t m_remainingSlots;             //!< The number of SSW slots remaining in the current A-BFT.
+  uint8_t m_abftMultiplier;             //!< The number of secondary A-BFTs appended to the primary A-BFT (802.11ay).
+  uint8_t m_currentSlotIndex;           //!< The index of the current SSW slot within the A-BFT.
+  std::set<Mac48Address> m_slotResponders; //!< The DMG STAs from which we received SSW frames in the current slot.
+  Time m_atiStartTime;                  //!< The start time of ATI Period.
+
+  /** PCP/AP Clustering Variables **/
+  enum ClusteringMode m_clusteringMode;  //!< The clustering mode of the PCP/AP.
+  bool m_synchronizationAp;             //!< Flag to indicate whether we start a cluster as its S-AP.
+  uint8_t m_clusterMaxMem;              //!< The maximum number of Beacon SPs in the cluster.
+  Time m_beaconSpDuration;              //!< The duration of each Beacon SP of the cluster.
+  Time m_clusterMonitorDuration;        //!< The time we monitor the channel for a cluster before starting our BIs.
+  Ptr<UniformRandomVariable> m_clusterMonitorJitter;  //!< Random number of BIs added to the cluster monitoring.
+  enum ClusterMemberRole m_clusterRole; //!< Our role in the cluster.
+  Mac48Address m_clusterId;             //!< The ID of our cluster (the MAC address of the S-AP).
+  uint8_t m_beaconSpIndex;              //!< The index of our Beacon SP in the cluster.
+  uint8_t m_clusterProbeBIs;            //!< The number of BIs left in which we may listen for a Beacon SP collision.
+  bool m_monitoringCluster;             //!< Flag to indicate whether we are monitoring the channel for a cluster.
+  bool m_syncApFound;                   //!< Flag to indicate whether we received a DMG Beacon from the S-AP.
+  Time m_clusterTimeReference;          //!< The start of a BI of the S-AP, the reference of the Beacon SPs.
+  std::map<Mac48Address, Time> m_monitoredBeaconSps; //!< The BI start of each PCP/AP heard during cluster monitoring.
+  std::map<Mac48Address, uint8_t> m_clusterMembers;  //!< The Beacon SP assigned by the S-AP to each cluster member.
+  std::map<Mac48Address, EventId> m_clusterResponseEvents; //!< Events to respond to Cluster Request sweeps.
+  EventId m_clusterEvent;               //!< Event ending the cluster monitoring or retrying a Cluster Request.
+  uint8_t m_clusterRequests;            //!< The number of Cluster Request sweeps sent so far.
+  bool m_sendingClusterRequests;        //!< Flag to indicate whether we are sweeping Cluster Request frames.
+
+  /** PCP Handover Variables **/
+  bool m_standbyPcp;                    //!< Flag to indicate whether we start as a standby PCP in the PBSS of another PCP.
+  uint32_t m_implicitHandoverLostBeacons; //!< The number of BIs without DMG Beacon after which the next PCP takes over.
+  bool m_followingPcp;                  //!< Flag to indicate whether we currently follow the BIs of another PCP.
+  Mac48Address m_pcpAddress;            //!< The MAC address of the PCP we follow.
+  uint16_t m_standbyAid;                //!< Our AID in the PBSS of the PCP, 0 before association.
+  bool m_standbyBeamformed;             //!< Flag to indicate whether we trained our link with the PCP in its A-BFT.
+  bool m_standbyAssocPending;           //!< Flag to indicate whether our Association Request is in flight.
+  bool m_sendingStandbySweep;           //!< Flag to indicate whether we are sweeping SSW frames toward the PCP.
+  bool m_nextPcp;                       //!< Flag to indicate whether we head the next PCP list of the PCP.
+  Time m_pcpBiStart;                    //!< The start of the last BI of the PCP we heard.
+  AllocationFieldList m_pcpAllocationList; //!< The allocation schedule of the PCP.
+  std::map<uint16_t, WifiInformationElementMap> m_pcpStationsInfo; //!< The association table transferred by the PCP.
+  Ptr<UniformRandomVariable> m_standbySlotVariable; //!< Random A-BFT slot of our sector sweep toward the PCP.
+  EventId m_pcpLostEvent;               //!< Event detecting the loss of the PCP.
+  EventId m_takeOverEvent;              //!< Event taking over the PBSS of the PCP.
+  NextPcpAidList m_nextPcpList;         //!< The AIDs of the DMG STAs supporting PCP handover, in association order.
+  uint8_t m_nextPcpToken;               //!< The token of the next PCP list, incremented at each update.
+  Mac48Address m_synchronizedNextPcp;   //!< The next PCP holding a copy of our association table.
+  size_t m_synchronizedStations;        //!< The number of DMG STAs in the copy held by the next PCP.
+  Mac48Address m_handoverCandidate;     //!< The DMG STA we sent a Handover Request to.
+  uint8_t m_requestedRemainingBIs;      //!< The number of remaining BIs of our Handover Request.
+  Mac48Address m_newPcp;                //!< The new PCP of the explicit handover in progress.
+  uint8_t m_handoverRemainingBIs;       //!< The number of BIs, including the current one, before the new PCP takes over.
+  bool m_leftPbss;                      //!< Flag to indicate whether we handed our PBSS over.
+  Mac48Address m_oldBssid;              //!< The BSSID of the PBSS we took over.
+  uint8_t m_handoverAnnouncements;      //!< The number of BIs during which we still announce the takeover.
+
+  /** ATI Polling Variables **/
+  bool m_atiPolling;                    //!< Flag to indicate whether we poll the DMG STAs during the ATI.
+  enum AtiPollingPolicy m_atiPollingPolicy; //!< The order in which we poll the DMG STAs.
+  Time m_atiPollTimeout;                //!< The time we wait for the SPR of a polled DMG STA.
+  bool m_atiAllocation;                 //!< Flag to indicate whether we allocate SPs for the collected SP requests.
+  std::vector<Mac48Address> m_atiPollList; //!< The DMG STAs left to poll in the current ATI.
+  uint32_t m_atiPollOffset;             //!< The round robin position of the first DMG STA polled in the next ATI.
+  Mac48Address m_polledStation;         //!< The DMG STA we are waiting an SPR from.
+  Time m_pollStartTime;                 //!< The start of the current Poll/SPR exchange.
+  EventId m_pollTimeoutEvent;           //!< Event ending the current Poll/SPR exchange without SPR.
+  Time m_atiBusyTime;                   //!< The time spent in Poll/SPR exchanges during the current ATI.
+  uint32_t m_atiPolls;                  //!< The number of DMG STAs polled during the current ATI.
+  std::map<Mac48Address, Dynamic_Allocation_Info_Field> m_sprRequests; //!< The SP requests of the current ATI.
+  std::map<Mac48Address, uint16_t> m_bufferedTraffic; //!< The latest SP duration requested by each DMG STA.
+  AllocationFieldList m_pendingAtiAllocations; //!< The SPs granted in the last ATI, announced in the next BTI.
+  AllocationFieldList m_atiAllocations; //!< The SPs granted by ATI polling for the current BI.
+
+  /** Power Management Variables **/
+  Time m_awakeWindow;                   //!< The awake window announced to the DMG STAs in power save mode.
+
+  /** Beacon Interval Clock Variables **/
+  bool m_shareBiClock;                  //!< Flag to indicate whether we drive the DMG STAs from a shared BI clock.
+  Ptr<DmgBeaconIntervalClock> m_biClock; //!< The beacon interval clock shared with the associated DMG STAs.
+
+  /** BRP Phase Variables **/
+  typedef std::map<Mac48Address, bool> STATION_BRP_MAP;
+  STATION_BRP_MAP m_stationBrpMap;      //!< Map to indicate if a station has conducted BRP Phase or not.
+  uint16_t m_aidCounter;                //!< Association Identifier.
+
+  /**
+   * Type definition for storing IEs of the associated stations.
+   */
+  typedef std::map<Mac48Address, WifiInformationElementMap> AssociatedStationsInfoByAddress;
+  AssociatedStationsInfoByAddress m_associatedStationsInfoByAddress;
+  std::map<uint16_t, WifiInformationElementMap> m_associatedStationsInfoByAid;
+
+  /**
+   * TracedCallback signature for DTI access period start event.
+   *
+   * \param address The MAC address of the station.
+   * \param duration The duration of the DTI period.
+   */
+  typedef void (* DtiStartedCallback)(Mac48Address address, Time duration);
+  /**
+   * TracedCallback signature for the end of an A-BFT SSW slot.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param slotIndex The index of the SSW slot within the A-BFT.
+   * \param responders The number of distinct DMG STAs heard during the slot (more than one means a collision).
+   * \param served The MAC address of the DMG STA that is trained in this slot, if any.
+   */
+  typedef void (* AbftSlotCompletedCallback)(Mac48Address address, uint8_t slotIndex, uint32_t responders, Mac48Address served);
+  /**
+   * TracedCallback signature for joining a PCP/AP cluster.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param clusterId The ID of the cluster (the MAC address of the S-AP).
+   * \param beaconSpIndex The index of the Beacon SP assigned to the DMG AP (1 for the S-AP).
+   */
+  typedef void (* ClusterJoinedCallback)(Mac48Address address, Mac48Address clusterId, uint8_t beaconSpIndex);
+  /**
+   * TracedCallback signature for a PCP handover.
+   *
+   * \param oldBssid The BSSID of the PBSS, i.e. the MAC address of the old PCP.
+   * \param newPcp The MAC address of the new PCP.
+   */
+  typedef void (* PcpHandoverCallback)(Mac48Address oldBssid, Mac48Address newPcp);
+  /**
+   * TracedCallback signature for the SPR of a DMG STA polled during the ATI.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param station The MAC address of the DMG STA.
+   * \param duration The SP duration requested by the DMG STA.
+   */
+  typedef void (* ServicePeriodRequestedCallback)(Mac48Address address, Mac48Address station, Time duration);
+  /**
+   * TracedCallback signature for the end of an ATI with polling.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param polls The number of DMG STAs polled during the ATI.
+   * \param responses The number of SPR frames received during the ATI.
+   * \param utilization The fraction of the ATI spent in Poll/SPR exchanges.
+   */
+  typedef void (* AtiCompletedCallback)(Mac48Address address, uint32_t polls, uint32_t responses, double utilization);
+
+  TracedCallback<Mac48Address> m_biStarted;         //!< New BI Started has started.
+  TracedCallback<Mac48Address, Time> m_dtiStarted;  //!< DTI Started has started.
+  TracedCallback<Mac48Address, uint8_t, uint32_t, Mac48Address> m_abftSlotCompleted;  //!< A-BFT SSW slot completed.
+  TracedCallback<Mac48Address, Mac48Address, uint8_t> m_clusterJoined;  //!< Joined or formed a PCP/AP cluster.
+  TracedCallback<Mac48Address, Mac48Address> m_pcpHandover;  //!< Handed our PBSS over or took over a PBSS.
+  TracedCallback<Mac48Address, Mac48Address, Time> m_servicePeriodRequested;  //!< SPR received during the ATI.
+  TracedCallback<Mac48Address, uint32_t, uint32_t, double> m_atiCompleted;  //!< ATI with polling completed.
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_AP_WIFI_MAC_H */
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_BEACON_INTERVAL_CLOCK_H
+#define DMG_BEACON_INTERVAL_CLOCK_H
+
+#include <map>
+#include <vector>
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "dmg-information-elements.h"
+
+namespace ns3 {
+
+/**
+ * The phases of a beacon interval dispatched by the DmgBeaconIntervalClock.
+ */
+enum BeaconIntervalPhase
+{
+  BI_START = 0,
+  ABFT_START,
+  ATI_START,
+  DTI_START,
+  ALLOCATION_END,
+  ALLOCATION_START
+};
+
+/**
+ * \brief Shared beacon interval clock of a DMG BSS.
+ * \ingroup wifi
+ *
+ * The DMG AP owns one clock and starts it at the beginning of each beacon interval.
+ * The clock precomputes the timeline of the beacon interval (A-BFT, ATI, DTI and the
+ * allocations of the Extended Schedule element) and walks through it with a single
+ * pending event, dispatching each phase change to all the subscribed DMG STAs.
+ * This replaces the per-STA copies of the BI events, so the number of scheduled events
+ * per BI no longer grows with the number of DMG STAs in the BSS.
+ */
+class DmgBeaconIntervalClock : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  /**
+   * Callback invoked on each phase change. For ALLOCATION_START and ALLOCATION_END
+   * the allocation field is the allocation that starts or ends, otherwise it is empty.
+   */
+  typedef Callback<void, BeaconIntervalPhase, const AllocationField &> PhaseCallback;
+
+  DmgBeaconIntervalClock ();
+  virtual ~DmgBeaconIntervalClock ();
+
+  /**
+   * Register this clock as the beacon interval clock of the given BSS.
+   * \param bssid The BSSID of the DMG AP owning the clock.
+   */
+  void SetBssid (Mac48Address bssid);
+  /**
+   * \return The BSSID this clock is registered with.
+   */
+  Mac48Address GetBssid (void) const;
+  /**
+   * Find the beacon interval clock of a BSS.
+   * \param bssid The BSSID of the DMG AP.
+   * \return The clock of the BSS or 0 if the DMG AP does not share its clock.
+   */
+  static Ptr<DmgBeaconIntervalClock> Find (Mac48Address bssid);
+
+  /**
+   * Subscribe a DMG STA to the phase changes of the beacon interval. The first phase
+   * dispatched to a new subscriber is the start of the next beacon interval.
+   * \param address The MAC address of the DMG STA.
+   * \param callback The callback to invoke on each phase change.
+   */
+  void Subscribe (Mac48Address address, PhaseCallback callback);
+  /**
+   * Unsubscribe a DMG STA, it is safe to call it from within a phase callback.
+   * \param address The MAC address of the DMG STA.
+   */
+  void Unsubscribe (Mac48Address address);
+  /**
+   * \param address The MAC address of the DMG STA.
+   * \return True if the DMG STA is subscribed to this clock.
+   */
+  bool IsSubscribed (Mac48Address address) const;
+  /**
+   * \return The number of subscribed DMG STAs.
+   */
+  uint32_t GetNSubscribers (void) const;
+
+  /**
+   * Set the allocations announced in the Extended Schedule element of the DMG Beacons.
+   * The list is kept for the beacon intervals without BTI.
+   * \param allocationList The list of allocations relative to the start of the DTI.
+   */
+  void SetAllocationList (const AllocationFieldList &allocationList);
+  /**
+   * Start a new beacon interval at the current time, dispatch BI_START and schedule
+   * the remaining phases. Any pending phase of the previous beacon interval is dropped.
+   * \param btiPresent True if the beacon interval contains a BTI.
+   * \param btiDuration The duration of the BTI.
+   * \param abftPresent True if an A-BFT follows the BTI.
+   * \param abftDuration The duration of the A-BFT.
+   * \param atiPresent True if the beacon interval contains an ATI.
+   * \param atiDuration The duration of the ATI.
+   * \param mbifs The MBIFS separating the access periods of the BHI.
+   */
+  void StartBeaconInterval (bool btiPresent, Time btiDuration, bool abftPresent, Time abftDuration,
+                            bool atiPresent, Time atiDuration, Time mbifs);
+  /**
+   * Stop dispatching the phases of the current beacon interval.
+   */
+  void Stop (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * An entry of the beacon interval timeline.
+   */
+  struct TimelineEntry
+  {
+    Time offset;                  //!< The offset of the phase from the start of the BI.
+    BeaconIntervalPhase phase;    //!< The phase starting at this offset.
+    AllocationField field;        //!< The allocation of ALLOCATION_START and ALLOCATION_END phases.
+  };
+
+  /**
+   * Order the timeline by offset, at equal offsets an allocation ends before the next one starts.
+   */
+  static bool CompareTimelineEntry (const TimelineEntry &a, const TimelineEntry &b);
+  /**
+   * Append a phase to the timeline.
+   */
+  void AddPhase (Time offset, BeaconIntervalPhase phase, const AllocationField &field);
+  /**
+   * Dispatch all the phases starting at the current time and schedule the next one.
+   */
+  void DispatchNextPhases (void);
+  /**
+   * Dispatch a phase to all the subscribed DMG STAs.
+   */
+  void Dispatch (BeaconIntervalPhase phase, const AllocationField &field);
+
+  typedef std::map<Mac48Address, PhaseCallback> SubscriberMap;
+  typedef std::map<Mac48Address, DmgBeaconIntervalClock *> ClockRegistry;
+
+  static ClockRegistry *GetRegistry (void);
+
+  Mac48Address m_bssid;                   //!< The BSSID the clock is registered with.
+  SubscriberMap m_subscribers;            //!< The subscribed DMG STAs.
+  bool m_dispatching;                     //!< Flag to indicate we are dispatching a phase.
+  bool m_purgeSubscribers;                //!< Flag to indicate a subscriber left during dispatch.
+  AllocationFieldList m_allocationList;   //!< The allocations of the DTI.
+  std::vector<TimelineEntry> m_timeline;  //!< The timeline of the current beacon interval.
+  uint32_t m_nextEntry;                   //!< The index of the next phase in the timeline.
+  Time m_biStartTime;                     //!< The start time of the current beacon interval.
+  EventId m_phaseEvent;                   //!< The single pending event of the clock.
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_BEACON_INTERVAL_CLOCK_H */
@@ -0,0 +1,777 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_STA_WIFI_MAC_H
+#define DMG_STA_WIFI_MAC_H
+
+#include "dmg-wifi-mac.h"
+#include "dmg-beacon-interval-clock.h"
+#include <set>
+
+#include "ns3/event-id.h"
+#include "ns3/packet.h"
+#include "ns3/traced-callback.h"
+
+#include "supported-rates.h"
+#include "amsdu-subframe-header.h"
+
+namespace ns3  {
+
+class MgtAddBaRequestHeader;
+class UniformRandomVariable;
+
+typedef enum {
+  DIRECT_LINK = 0,
+  RELAY_LINK = 1
+} TransmissionLink;
+
+/**
+ * Built-in policies used by the source REDS to select an RDS once the channel
+ * measurement reports from both the RDSs and the destination REDS are available.
+ */
+typedef enum {
+  RELAY_SELECTION_USER_CALLBACK = 0,  //!< Delegate the selection to the registered relay selector function.
+  RELAY_SELECTION_MAX_MIN_SNR,        //!< Select the RDS which maximizes the weakest hop SNR.
+  RELAY_SELECTION_MAX_CAPACITY,       //!< Select the RDS which maximizes the end-to-end capacity.
+  RELAY_SELECTION_LOAD_AWARE          //!< Maximize the end-to-end capacity shared among the relay links of the RDS.
+} RelaySelectionPolicy;
+
+/**
+ * Strategies used by a DMG STA to select the SSW slot in which it performs
+ * the responder sector sweep during the A-BFT.
+ */
+typedef enum {
+  ABFT_SLOT_UNIFORM = 0,              //!< Select a slot uniformly at random among the remaining slots (802.11ad).
+  ABFT_SLOT_ADDRESS_HASHED,           //!< Derive the first attempt slot from the MAC address, retries are uniform.
+  ABFT_SLOT_ADAPTIVE                  //!< Uniform slot, but contend in an A-BFT with a probability halved at each failure.
+} AbftSlotSelection;
+
+typedef struct {
+  bool relayForwardingActivated;              //!< Flag to indicate if a relay link has been aactivated.
+  bool relayLinkEstablished;                  //!< Flag to indicate if a relay link has been established.
+  bool rdsDuplexMode;                         //!< The duplex mode of the RDS.
+  bool waitingDestinationRedsReports;         //!< Flag to indicate that we are waiting for the destination REDS report.
+  bool switchTransmissionLink;                //!< Flag to indicate that we want to change the current transmission link.
+  Time switchRequestTime;                     //!< The time at which the link switch has been decided.
+
+  uint8_t relayLinkChangeInterval;            //!< Relay Link Change Interval reported by the source REDS (MicroSeconds).
+  uint8_t relayDataSensingTime;               //!< Relay Data Sensing Time reported by the source REDS (MicroSeconds).
+  uint16_t relayFirstPeriod;                  //!< Relay First Period reported by the source REDS (MicroSeconds).
+  uint16_t relaySecondPeriod;                 //!< Relay Second Period reported by the source REDS (MicroSeconds).
+
+  /* Identifiers of the relay protected service period */
+  uint16_t srcRedsAid;                        //!< The AID of the source REDS.
+  uint16_t dstRedsAid;                        //!< The AID of the destination REDS.
+  uint16_t selectedRelayAid;                  //!< The AID of the selected RDS.
+  Mac48Address srcRedsAddress;                //!< The MAC address of the Source REDS.
+  Mac48Address dstRedsAddress;                //!< The MAC address of the destination REDS.
+  Mac48Address selectedRelayAddress;          //!< The MAC address of the selected RDS.
+  TransmissionLink transmissionLink;          //!< Current transmission link for the service period.
+
+  RelayCapabilitiesInfo rdsCapabilitiesInfo;            //!< The relay capabilities Information for the RDS.
+  RelayCapabilitiesInfo dstRedsCapabilitiesInfo;        //!< The relay capabilities Information for the destination REDS.
+  ChannelMeasurementInfoList channelMeasurementList;    //!< The channel measurement list between the source REDS and the RDS.
+} RELAY_LINK_INFO;
+
+/**
+ * Callback signature for reporting channel measurements for relay selection.
+ *
+ * \param address The MAC address of the station.
+ * \param duration The duration of the DTI period.
+ */
+typedef Callback<uint8_t, ChannelMeasurementInfoList, ChannelMeasurementInfoList, Mac48Address &> ChannelMeasurementCallback;
+typedef std::pair<uint8_t, uint8_t> SERVICE_PERIOD_PAIR;      //!< Typedef to identify source and destination DMG STA for SP.
+typedef SERVICE_PERIOD_PAIR REDS_PAIR;                        //!< Typedef to identify source and destination REDS protected by an RDS.
+
+#define dot11RSSRetryLimit              8
+#define dot11RSSBackoff                 8
+#define aMaxABFTAccessPeriod            2   //!< Typedef to identify source and destination REDS protected by an RDS.
+
+
+/**
+ * \ingroup wifi
+ *
+ * The Wifi MAC high model for a non-AP STA in a BSS.
+ */
+class DmgStaWifiMac : public DmgWifiMac
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DmgStaWifiMac ();
+  virtual ~DmgStaWifiMac ();
+  /**
+   * \param stationManager the station manager attached to this MAC.
+   */
+  virtual void SetWifiRemoteStationManager(Ptr<WifiRemoteStationManager> stationManager);
+  /**
+   * \param packet the packet to send.
+   * \param to the address to which the packet should be sent.
+   *
+   * The packet should be enqueued in a tx queue, and should be
+   * dequeued as soon as the channel access function determines that
+   * access is granted to this MAC.
+   */
+  virtual void Enqueue (Ptr<const Packet> packet, Mac48Address to);
+  /**
+   * \param lost The number of beacons which must be lost
+   * before a new association sequence is started.
+   */
+  void SetMaxLostBeacons (uint32_t lost);
+  /**
+   * \param timeout
+   *
+   * If no probe response is received within the specified
+   * timeout, the station sends a new probe request.
+   */
+  void SetProbeRequestTimeout (Time timeout);
+  /**
+   * \param timeout
+   *
+   * If no association response is received within the specified
+   * timeout, the station sends a new association request.
+   */
+  void SetAssocRequestTimeout (Time timeout);
+  /**
+   * Initiate Beamforming with a particular DMG STA.
+   * \param peerAid The AID of the peer DMG STA.
+   * \param peerAddress The address of the DMG STA to perform beamforming training with.
+   * \param isInitiator Indicate whether we are the Beamforming Initiator.
+   * \param isTxss Indicate whether the RSS is TxSS or RxSS.
+   * \param length The length of the Beamforming Service Period.
+   */
+  void StartBeamformingServicePeriod (uint8_t peerAid, Mac48Address peerAddress, bool isInitiator, bool isTxss, Time length);
+  /**
+   * Start an active association sequence immediately.
+   */
+  void StartActiveAssociation (void);
+  /**
+   * Request Information regarding station capabilities.
+   * \param stationAddress The address of the station to obtain its capabilities.
+   */
+  void RequestInformation (Mac48Address stationAddress);
+  /**
+   * Discover all the available relays in DMG BSS. This method is called by the source REDS.
+   * \param stationAddress The MAC address of the station to establish relay link with (Destination REDS).
+   */
+  void StartRelayDiscovery (Mac48Address stationAddress);
+  /**
+   * Initiate Relay Link Switching Type Procedure with the selected RDS in the RDS Selection procedure.
+   */
+  void StartRlsProcedure (void);
+  /**
+   * Tear down relay operation by either RDS or source REDS.
+   * \param to The address of the REDS or RDS.
+   * \param destinationAddress The address of the REDS.
+   * \param sourceAid The AID of the source REDS.
+   * \param destinationAid The AID of the destination REDS.
+   * \param relayAid The AID of the RDS.
+   */
+  void TeardownRelay (Mac48Address to, Mac48Address destinationAddress,
+                      uint16_t sourceAid, uint16_t destinationAid, uint16_t relayAid);
+  /**
+   * Send Channel Measurement Request to specific DMG STA.
+   * \param to The MAC address of the destination STA.
+   * \param token The dialog token.
+   */
+  void SendChannelMeasurementRequest (Mac48Address to, uint8_t token);
+  /**
+   * Register a user defined relay selector. The callback takes precedence over the
+   * built-in relay selection policies.
+   * \param callback The relay selector function.
+   */
+  void RegisterRelaySelectorFunction (ChannelMeasurementCallback callback);
+  /**
+   * Select an RDS using the configured built-in relay selection policy.
+   * \param rdsMeasurements The channel measurements between the source REDS and each RDS.
+   * \param dstRedsMeasurements The channel measurements between the destination REDS and each RDS.
+   * \param rdsAddress The MAC address of the selected RDS.
+   * \return The AID of the selected RDS.
+   */
+  uint8_t SelectRelay (ChannelMeasurementInfoList rdsMeasurements, ChannelMeasurementInfoList dstRedsMeasurements,
+                       Mac48Address &rdsAddress);
+  /**
+   * Switch transmission link for a specific service period to an alternative path.
+   * \param srcAid The AID of the source DMG STA.
+   * \param dstAid The AID of the destination DMG STA.
+   */
+  void SwitchTransmissionLink (uint8_t srcAid, uint8_t dstAid);
+  /**
+   * Get Association Identifier (AID).
+   * \return The AID of the station.
+   */
+  uint16_t GetAssociationID (void);
+  /**
+   * Create or modify DMG allocation for the transmission of frames between DMG STA
+   * that are members of a PBSS or a DMG infrastructure.
+   * \param to The MAC address of the peer station.
+   * \param elem The DMG TSPEC information element.
+   */
+  void CreateAllocation (Mac48Address to, DmgTspecElement &elem);
+
+protected:
+  friend class MultiBandNetDevice;
+
+  virtual void DoDispose (void);
+  virtual void DoInitialize (void);
+  void StartBeaconInterval (void);
+  void StartBeaconTransmissionInterval (void);
+  void StartAssociationBeamformTraining (void);
+  void StartAnnouncementTransmissionInterval (void);
+  void StartDataTransmissionInterval (void);
+  void FrameTxOk (const WifiMacHeader &hdr);
+  void BrpSetupCompleted (Mac48Address address);
+  virtual void NotifyBrpPhaseCompleted (void);
+
+  /**
+   * Forward an Action Frame to the specified destination
+   * \param to
+   * \param actionHdr
+   * \param actionBody
+   */
+  void ForwardActionFrame (Mac48Address to, WifiActionHeader &actionHdr, Header &actionBody);
+  /**
+   * Get Relay Transfer Parameter Set associated with this DMG STA.
+   * \return The relay transfer parameter set.
+   */
+  Ptr<RelayTransferParameterSetElement> GetRelayTransferParameterSet (void) const;
+  /**
+   * Initiate Relay Link Switch (RLS) procedure.
+   * \param to The MAC address of the RDS.
+   * \param token The dialog token.
+   * \param sourceAid The AID of the source REDS.
+   * \param relayAid The AID of the selected RDS.
+   * \param destinationAid The AID of the desination REDS.
+   */
+  void SendRlsRequest (Mac48Address to, uint8_t token, uint16_t sourceAid, uint16_t relayAid, uint16_t destinationAid);
+  /**
+   * Send RLS Response to the specified Station.
+   * \param to The MAC address of the station.
+   * \param token The dialog token.
+   * \param destinationStatus The status of the destination REDS.
+   * \param relayStatus The status of the RDS.
+   */
+  void SendRlsResponse (Mac48Address to, uint8_t token, uint16_t destinationStatus, uint16_t relayStatus);
+  /**
+   * Send RLS Announcment to the specified Station.
+   * \param to The MAC address of the PCP/AP.
+   * \param destinationAid The AID of the desination REDS.
+   * \param relayAid The AID of the selected RDS.
+   * \param sourceAid The AID of the source REDS.
+   */
+  void SendRlsAnnouncment (Mac48Address to, uint16_t destinationAid, uint16_t relayAid, uint16_t sourceAid);
+  /**
+   * Send Relay Teardown frame to the specified Station.
+   * \param to
+   * \param sourceAid The AID of the source REDS.
+   * \param destinationAid The AID of the desination REDS.
+   * \param relayAid The AID of the selected RDS.
+   */
+  void SendRelayTeardown (Mac48Address to, uint16_t sourceAid, uint16_t destinationAid, uint16_t relayAid);
+  /**
+   * Remove Relay Entry
+   * \param sourceAid The AID of the source REDS.
+   * \param destinationAid The AID of the desination REDS.
+   */
+  void RemoveRelayEntry (uint16_t sourceAid, uint16_t destinationAid);
+
+  Ptr<MultiBandElement> GetMultiBandElement (void) const;
+  /**
+   * Set the current MAC state.
+   *
+   * \param value the new state
+   */
+  void SetState (enum MacState value);
+  /**
+   * Forward data frame to another DMG STA. This function is called during HD-DF relay operation ode.
+   * \param hdr The MAC Header.
+   * \param packet
+   * \param destAddress The MAC address of the receiving station.
+   */
+  void ForwardDataFrame (WifiMacHeader hdr, Ptr<Packet> packet, Mac48Address destAddress);
+  /**
+   * Do Association Beamforming Training in the A-BFT period.
+   */
+  void DoAssociationBeamformingTraining (void);
+  /**
+   * Select the A-BFT SSW slot for the next responder sector sweep according to the slot selection strategy.
+   * \param firstSlot The first eligible slot index in the A-BFT.
+   * \param lastSlot The last eligible slot index in the A-BFT.
+   * \return The index of the selected slot in the A-BFT.
+   */
+  uint8_t SelectAbftSlot (uint8_t firstSlot, uint8_t lastSlot);
+  /**
+   * Add new data forwarding entry.
+   * \param nextHopAddress The MAC Address of the next hop.
+   */
+  void AddForwardingEntry (Mac48Address nextHopAddress);
+  /**
+   * Follow the access periods of the BI from the beacon interval clock of the PCP/AP.
+   * \param phase The phase of the BI that starts.
+   * \param field The allocation that starts or ends in the DTI.
+   */
+  void BeaconIntervalPhaseChanged (BeaconIntervalPhase phase, const AllocationField &field);
+  /**
+   * Stop following the beacon interval clock of the PCP/AP and schedule our own BIs again.
+   */
+  void LeaveBeaconIntervalClock (void);
+  /**
+   * Move to the PCP that took over the PBSS of our PCP, we keep our association and AID.
+   * \param newPcp The MAC address of the new PCP.
+   */
+  void FollowPcpHandover (Mac48Address newPcp);
+  /**
+   * Send our pending frames for the old PCP/AP to the PCP/AP we are associated with now.
+   * \param oldBssid The BSSID of the old PCP/AP.
+   */
+  void RedirectPendingFrames (Mac48Address oldBssid);
+  /**
+   * \param field The allocation announced in the Extended Schedule element.
+   * \return True if we have to start or end any access period in this allocation.
+   */
+  bool IsAllocationOfInterest (const AllocationField &field) const;
+  /**
+   * \return True if we are associated and in power save mode.
+   */
+  bool IsPowerSaving (void) const;
+  /**
+   * Put the PHY in the doze (sleep) state once the ongoing frame exchange is over.
+   */
+  void Doze (void);
+  /**
+   * Bring the PHY back to the awake state if it is dozing.
+   */
+  void WakeUp (void);
+  /**
+   * \return The Wakeup Schedule element describing our awake and doze BIs.
+   */
+  Ptr<WakeupScheduleElement> GetWakeupScheduleElement (void) const;
+  /**
+   * Start the access periods of an allocation in the DTI.
+   * \param field The allocation announced in the Extended Schedule element.
+   */
+  void StartAllocation (AllocationField field);
+  /**
+   * End the access periods started at the beginning of an allocation.
+   * \param field The allocation announced in the Extended Schedule element.
+   */
+  void EndAllocation (AllocationField field);
+  /**
+   * Send Relay Search Request.
+   * \param token The dialog token.
+   * \param destinationAid The AID of the destination DMG STA.
+   */
+  void SendRelaySearchRequest (uint8_t token, uint16_t destinationAid);
+  /**
+   * Send Channel Measurement Report.
+   * \param to The address of the DMG STA which sent the measurement request.
+   * \param token The token dialog.
+   * \param List of channel measurement information between sending station and other stations.
+   */
+  void SendChannelMeasurementReport (Mac48Address to, uint8_t token, ChannelMeasurementInfoList &measurementList);
+  /**
+   * Initiate and schedule periods related to relay operation.
+   * \param info Information regarding relay link.
+   */
+  void InitiateRelayPeriods (RELAY_LINK_INFO &info);
+  /**
+   * End Relay Period.
+   * \param pair The pair of REDS to which we establsihed the relay period.
+   */
+  void EndRelayPeriods (REDS_PAIR &pair);
+  /**
+   * This function is called upon the expiration of RelayLinkChangeIntervalTimeout.
+   * \param offset
+   */
+  void RelayLinkChangeIntervalTimeout (void);
+  /**
+   * Check if there is an available time for a given period in the current allocated Service Period.
+   * \param periodDuration The duration of the period.
+   * \return True if the period can exist in the current service period.
+   */
+  bool CheckTimeAvailabilityForPeriod (Time servicePeriodDuration, Time partialDuration);
+  /**
+   * Start Full Duplex Relay operation.
+   * \param allocationID The ID of the current allocation.
+   * \param servicePeriodLength The length of the service period for which we are using the relay.
+   * \param involved Flag to indicate if we are involved in relay forwarding.
+   */
+  void StartFullDuplexRelay (AllocationID allocationID, Time length, uint8_t peerAid, Mac48Address peerAddress, bool isSource);
+  /**
+   * Suspend transmission in the current period related to the HD-DF Relay operation mode.
+   */
+  void SuspendRelayPeriod (void);
+  /**
+   * MissedAck
+   * \param hdr
+   */
+  void MissedAck (const WifiMacHeader &hdr);
+  /**
+   * This function is called upon the expiration of Relay Data Sensing Timeout.
+   */
+  void RelayDataSensingTimeout (void);
+  /**
+   * Switch to Relay Opertional Mode. This method is called by the RDS.
+   */
+  void SwitchToRelayOpertionalMode (void);
+  /**
+   * Relay Operation Timeout.
+   */
+  void RelayOperationTimeout (void);
+  /**
+   * Calculate the end-to-end capacity of a two-hop relay link.
+   * \param firstHopSnr The SNR between the source REDS and the RDS in dB.
+   * \param secondHopSnr The SNR between the RDS and the destination REDS in dB.
+   * \param duplex The duplex mode of the RDS.
+   * \return The end-to-end capacity in bit/s/Hz.
+   */
+  double GetRelayLinkCapacity (double firstHopSnr, double secondHopSnr, RelayDuplexMode duplex) const;
+  /**
+   * Get the number of relay links for which a specific RDS has been selected.
+   * \param relayAid The AID of the RDS.
+   * \return The number of relay links.
+   */
+  uint32_t GetRelayLoad (uint16_t relayAid) const;
+  /**
+   * Evaluate the quality of the direct link at the start of a Link Change Interval and
+   * decide whether the source REDS should switch its transmission link.
+   */
+  void EvaluateTransmissionLink (void);
+  /**
+   * Change the current transmission link of the relay link being served.
+   * \param link The new transmission link.
+   */
+  void ChangeTransmissionLink (TransmissionLink link);
+  /**
+   * Request a transmission link change at the start of the following Link Change Interval.
+   */
+  void RequestTransmissionLinkSwitch (void);
+  /**
+   * Update the link quality towards a peer station upon a successfully received frame.
+   * \param address The MAC address of the peer station.
+   */
+  virtual void MacRxOk (Mac48Address address);
+
+private:
+  /**
+   * Enable or disable active probing.
+   *
+   * \param enable enable or disable active probing
+   */
+  void SetActiveProbing (bool enable);
+  /**
+   * Return whether active probing is enabled.
+   *
+   * \return true if active probing is enabled, false otherwise
+   */
+  bool GetActiveProbing (void) const;
+  virtual void Receive (Ptr<Packet> packet, const WifiMacHeader *hdr);
+
+  /**
+   * Forward a probe request packet to the DCF. The standard is not clear on the correct
+   * queue for management frames if QoS is supported. We always use the DCF.
+   */
+  void SendProbeRequest (void);
+  /**
+   * Forward an association request packet to the DCF. The standard is not clear on the correct
+   * queue for management frames if QoS is supported. We always use the DCF.
+   */
+  void SendAssociationRequest (void);
+  /**
+   * Answer the Poll of the PCP/AP during the ATI with an SPR frame, requesting an SP long enough
+   * to send the frames buffered for the PCP/AP.
+   * \param to The MAC address of the PCP/AP.
+   */
+  void SendSprFrame (Mac48Address to);
+  /**
+   * Try to ensure that we are associated with an AP by taking an appropriate action
+   * depending on the current association status.
+   */
+  void TryToEnsureAssociated (void);
+  /**
+   * This method is called after the association timeout occurred. We switch the state to
+   * WAIT_ASSOC_RESP and re-send an association request.
+   */
+  void AssocRequestTimeout (void);
+  /**
+   * This method is called after the probe request timeout occurred. We switch the state to
+   * WAIT_PROBE_RESP and re-send a probe request.
+   */
+  void ProbeRequestTimeout (void);
+  /**
+   * Return whether we are associated with an AP.
+   *
+   * \return true if we are associated with an AP, false otherwise
+   */
+  bool IsAssociated (void) const;
+  /**
+   * Return whether we are waiting for an association response from an AP.
+   *
+   * \return true if we are waiting for an association response from an AP, false otherwise
+   */
+  bool IsWaitAssocResp (void) const;
+  /**
+   * This method is called after we have not received a beacon from the AP
+   */
+  void MissedBeacons (void);
+  /**
+   * Restarts the beacon timer.
+   *
+   * \param delay the delay before the watchdog fires
+   */
+  void RestartBeaconWatchdog (Time delay);
+  /**
+   * Missed SSW-Feedback from PCP/AP during A-BFT.
+   */
+  void MissedSswFeedback (void);
+  /**
+   * Return the DMG capability of the current STA.
+   *
+   * \return the DMG capability that we support
+   */
+  Ptr<DmgCapabilities> GetDmgCapabilities (void) const;
+  /**
+   * Start Initiator Sector Sweep (ISS) Phase.
+   * \param stationAddress The address of the station.
+   * \param isTxss Indicate whether the RSS is TxSS or RxSS.
+   */
+  void StartInitiatorSectorSweep (Mac48Address address, bool isTxss);
+  /**
+   * Start Generic Responder Sector Sweep (RSS) Phase.
+   * \param stationAddress The address of the station.
+   * \param isTxss Indicate whether the RSS is TxSS or RxSS.
+   */
+  void StartResponderSectorSweep (Mac48Address stationAddress, bool isTxss);
+  /**
+   * Start Responder Sector Sweep (RSS) Phase during A-BFT access period.
+   * \param stationAddress The address of the station.
+   * \param isTxss Indicate whether the RSS is TxSS or RxSS.
+   */
+  void StartAbftResponderSectorSweep (Mac48Address address, bool isTxss);
+  /**
+   * Start Transmit Sector Sweep (TxSS) with specific station.
+   * \param address The MAC address of the peer DMG STA.
+   * \param direction Indicate whether we are initiator or responder.
+   */
+  void StartTransmitSectorSweep (Mac48Address address, BeamformingDirection direction);
+  /**
+   * Start Receive Sector Sweep (RxSS) with specific station.
+   * \param address The MAC address of the peer DMG STA.
+   * \param direction Indicate whether we are initiator or responder.
+   */
+  void StartReceiveSectorSweep (Mac48Address address, BeamformingDirection direction);
+  /**
+   * Send ISS Sector Sweep Frame
+   * \param address
+   * \param direction
+   * \param sectorID
+   * \param antennaID
+   * \param count
+   */
+  void SendIssSectorSweepFrame (Mac48Address address, BeamformingDirection direction,
+                                uint8_t sectorID, uint8_t antennaID,  uint16_t count);
+  /**
+   * Send RSS Sector Sweep Frame
+   * \param address
+   * \param direction
+   * \param sectorID
+   * \param antennaID
+   * \param count
+   */
+  void SendRssSectorSweepFrame (Mac48Address address, BeamformingDirection direction,
+                                uint8_t sectorID, uint8_t antennaID,  uint16_t count);
+  /**
+   * Send SSW Frame.
+   * \param sectorID The ID of the current transmitting sector.
+   * \param antennaID the ID of the current transmitting antenna.
+   * \param count the remaining number of sectors.
+   */
+  void SendSectorSweepFrame (Mac48Address address, BeamformingDirection direction,
+                             uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Send SSW FBCK Frame for SLS phase in a scheduled service period.
+   * \param receiver The MAC address of the peer DMG STA.
+   */
+  void SendSswFbckFrame (Mac48Address receiver);
+  /**
+   * Send SSW ACK Frame for SLS phase in a scheduled service period.
+   * \param receiver The MAC address of the peer DMG STA.
+   */
+  void SendSswAckFrame (Mac48Address receiver);
+
+private:
+  Time m_probeRequestTimeout;
+  Time m_assocRequestTimeout;
+  EventId m_probeRequestEvent;
+  EventId m_assocRequestEvent;
+  EventId m_beaconWatchdog;
+  Time m_beaconWatchdogEnd;                     //! Watch dog timer end time/
+  uint32_t m_maxLostBeacons;                    //! Maximum number of beacons we are allowed to miss.
+  bool m_activeProbing;                         //! Flag to indicate whether to perform active probing.
+
+  uint16_t m_aid;   /* AID of the STA */
+
+  TracedCallback<Mac48Address> m_assocLogger;
+  TracedCallback<Mac48Address> m_deAssocLogger;
+  TracedCallback<Mac48Address> m_beaconMissed;  //!< Trace callback for losing the DMG Beacons of the PCP/AP.
+  TracedCallback<Mac48Address> m_pcpHandover;   //!< Trace callback for following the new PCP of our PBSS.
+  Mac48Address m_lostBssid;                     //!< The BSSID of the PCP/AP whose DMG Beacons we missed.
+
+  bool m_moreData;                              //! More data field in the last received Data Frame to indicate that the STA
+                                                //! has MSDUs or A-MSDUs buffered for transmission to the frame’s recipient
+                                                //! during the current SP or TXOP.
+
+  /* BI Parameters */
+  EventId   m_abftEvent;                        //!< Association Beamforming training Event.
+  uint8_t   m_nBI;                              //!< Flag to indicate the number of intervals to allocate A-BFT.
+
+  /* BTI Beamforming */
+  bool m_receivedDmgBeacon;
+  bool    m_isResponderTXSS;                    //!< Flag to indicate whether the A-BFT Period is TXSS or RXSS.
+  uint8_t m_slotIndex;                          //!< The index of the selected slot in the A-BFT period.
+  EventId m_sswFbckTimeout;                     //!< Timeout Event for receiving SSW FBCK Frame.
+  Ptr<UniformRandomVariable> a_bftSlot;         //!< Random variable for A-BFT slot.
+  bool    m_isIssInitiator;                     //!< Flag to indicate that we are ISS.
+  EventId m_rssEvent;                           //!< Event related to scheduling
+  uint8_t m_abftMultiplier;                     //!< The number of secondary A-BFTs announced by the PCP/AP (802.11ay).
+  uint8_t m_slotOffset;                         //!< The index of the first slot we can still access in the current A-BFT.
+  AbftSlotSelection m_abftSlotSelection;        //!< The strategy to select the A-BFT SSW slot.
+  bool m_repeatAbft;                            //!< Flag to indicate whether we keep performing RSS after a successful A-BFT.
+  bool m_abftCompleted;                         //!< Flag to indicate that we received SSW-FBCK from the PCP/AP in an A-BFT.
+  Time m_abftContentionStart;                   //!< The time of our first RSS attempt towards the PCP/AP.
+  uint32_t m_abftAttempts;                      //!< The number of RSS attempts since the first one towards the PCP/AP.
+  Time m_sswFbckDuration;                       //!< The duration in the SSW-FBCK Field.
+
+  uint32_t m_failedRssAttemptsCounter;          //!< Counter for Failed RSS Attempts during A-BFT.
+  uint32_t m_rssAttemptsLimit;                  //!< Maximum Failed RSS Attempts during A-BFT.
+  uint32_t m_rssBackoffRemaining;               //!< Remaining BTIs for the RSS in A-BFT.
+  uint32_t m_rssBackoffLimit;                   //!< Maximum RSS Backoff value.
+  Ptr<UniformRandomVariable> m_rssBackoffVariable;//!< Random variable for the RSS Backoff value.
+
+  /**
+   * TracedCallback signature for A-BFT slot events.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param slotIndex The index of the SSW slot within the A-BFT.
+   * \param failedAttempts The current value of the FailedRSSAttempts counter.
+   */
+  typedef void (* AbftSlotCallback)(Mac48Address address, uint8_t slotIndex, uint32_t failedAttempts);
+  /**
+   * TracedCallback signature for entering the RSS backoff.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param backoff The number of A-BFTs we skip.
+   */
+  typedef void (* RssBackoffCallback)(Mac48Address address, uint32_t backoff);
+  /**
+   * TracedCallback signature for the completion of the association beamforming training.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param delay The time elapsed since our first RSS attempt towards the PCP/AP.
+   * \param attempts The number of RSS attempts it took.
+   */
+  typedef void (* AbftCompletedCallback)(Mac48Address address, Time delay, uint32_t attempts);
+  TracedCallback<Mac48Address, uint8_t, uint32_t> m_rssAttempt;  //!< Trace callback for starting RSS in an A-BFT slot.
+  TracedCallback<Mac48Address, uint8_t, uint32_t> m_rssFailed;   //!< Trace callback for missing the SSW-FBCK in an A-BFT slot.
+  TracedCallback<Mac48Address, uint32_t> m_rssBackoff;           //!< Trace callback for entering the RSS backoff.
+  TracedCallback<Mac48Address, Time, uint32_t> m_abftCompletedTrace; //!< Trace callback for a successful A-BFT.
+
+  /* Beacon Interval Clock */
+  enum AllocationEndAction
+  {
+    END_SERVICE_PERIOD = 1,
+    END_RELAY_PERIODS = 2,
+    RELAY_OPERATION_TIMEOUT = 4,
+    SUSPEND_RDS_OPERATION = 8,
+    END_CONTENTION_PERIOD = 16
+  };
+  typedef std::map<uint32_t, uint8_t> AllocationEndActions;
+  Ptr<DmgBeaconIntervalClock> m_biClock;        //!< The beacon interval clock of the PCP/AP we follow (if any).
+  Time m_lastBiStart;                           //!< The time at which we started the last BI.
+  AllocationEndActions m_allocationEndActions;  //!< The actions to take at the end of the ongoing allocations by start time.
+
+  /* Power Management */
+  bool m_powerSave;                             //!< Flag to indicate whether power save mode is enabled.
+  uint16_t m_sleepCycle;                        //!< The number of BIs in one cycle of the wakeup schedule.
+  uint16_t m_awakeBIs;                          //!< The number of awake BIs at the beginning of each sleep cycle.
+  uint32_t m_biCounter;                         //!< The number of BIs since we started.
+  uint32_t m_wakeupScheduleStart;               //!< The BI at which our wakeup schedule started.
+  bool m_dozeBi;                                //!< Flag to indicate that the current BI is a doze BI.
+  Time m_dtiOffset;                             //!< The offset of the DTI from the start of the last awake BI.
+  Time m_awakeWindow;                           //!< The awake window at the beginning of the DTI announced by the PCP/AP.
+  std::set<uint32_t> m_activeAllocations;       //!< The start times of the ongoing allocations we take part in.
+  EventId m_dozeEvent;                          //!< Event to enter the doze state.
+  /**
+   * TracedCallback signature for doze state changes.
+   *
+   * \param address The MAC address of the DMG STA.
+   * \param dozing True if the DMG STA entered the doze state, false if it woke up.
+   */
+  typedef void (* DozeStateChangedCallback)(Mac48Address address, bool dozing);
+  TracedCallback<Mac48Address, bool> m_dozeStateChanged; //!< Trace callback for doze state changes.
+
+  /* DMG Relay Support Variables */
+  bool m_relayMode;                             //!< Flag to indicate if we are in relay mode (For RDS).
+  bool m_rdsDuplexMode;                         //!< The duplex mode of the RDS.
+  uint8_t m_relayLinkChangeInterval;            //!< Relay Link Change Interval reported by the source REDS (MicroSeconds).
+  uint8_t m_relayDataSensingTime;               //!< Relay Data Sensing Time reported by the source REDS (MicroSeconds).
+
+  TracedCallback<Mac48Address> m_channelReportReceived;  //!< Trace callback for Channel Measurement completion.
+  EventId m_linkChangeInterval;                 //!< Event ID for the link change interval.
+  bool m_relayDataExchanged;                    //!< Flag to indicate a data has been exchanged during the relay operation mode.
+  bool m_relayReceivedData;                     //!< Flag to indicate if the RDS has received frame in the HD-DF operation mode.
+  bool m_periodProtected;
+
+  ChannelMeasurementInfoList m_channelMeasurementList;    //!< The channel measurement list between the source REDS and the RDS.
+  ChannelMeasurementCallback m_channelMeasurementCallback;
+  RelaySelectionPolicy m_relaySelectionPolicy;            //!< The built-in relay selection policy.
+
+  /* Automatic Link Switching */
+  bool m_automaticLinkSwitching;                //!< Flag to indicate whether the source REDS switches links based on the link quality.
+  double m_linkSwitchThreshold;                 //!< The direct link SNR threshold (dB) below which we switch to the relay link.
+  double m_linkSwitchHysteresis;                //!< The SNR margin (dB) above the threshold required to switch back to the direct link.
+  double m_linkSnrSmoothingFactor;              //!< The weight of the latest SNR sample in the link quality average.
+  typedef std::map<Mac48Address, double> LinkQualityMap;
+  LinkQualityMap m_linkQuality;                 //!< Smoothed SNR (dB) of the frames received from each peer station.
+
+  /**
+   * TracedCallback signature for link switch latency.
+   *
+   * \param address The MAC address of the station.
+   * \param link The new transmission link.
+   * \param latency The time elapsed between the switching decision and the actual link change.
+   */
+  typedef void (* LinkSwitchLatencyCallback)(Mac48Address address, TransmissionLink link, Time latency);
+  TracedCallback<Mac48Address, TransmissionLink, Time> m_linkSwitchLatency;
+
+  typedef std::map<REDS_PAIR, RELAY_LINK_INFO> RELAY_LINK_MAP;  //!< Typedef to identify relay link information for pair of REDS.
+  typedef RELAY_LINK_MAP::iterator RELAY_LINK_MAP_ITERATOR;     //!< Typedef for Ralay Link Map Iterator.
+  RELAY_LINK_MAP m_relayLinkMap;                                //!< List to store information related to relay links.
+  RELAY_LINK_INFO m_relayLinkInfo;                              //!< Information about the relay link being established.
+
+  /**
+   * TracedCallback signature for transmission link change event.
+   *
+   * \param address The MAC address of the station.
+   * \param transmissionLink The new transmission link.
+   */
+  typedef void (* TransmissionLinkChangedCallback)(Mac48Address address, TransmissionLink link);
+  TracedCallback<Mac48Address, TransmissionLink> m_transmissionLinkChanged;
+
+  /* Data Forwarding Table */
+  typedef struct {
+    Mac48Address nextHopAddress;
+    bool isCbapPeriod;
+  } AccessPeriodInformation;
+
+  typedef std::map<Mac48Address, AccessPeriodInformation> DataForwardingTable;
+  typedef DataForwardingTable::iterator DataForwardingTableIterator;
+  DataForwardingTable m_dataForwardingTable;
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_STA_WIFI_MAC_H */
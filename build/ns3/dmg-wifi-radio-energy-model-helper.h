@@ -0,0 +1,35 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_WIFI_RADIO_ENERGY_MODEL_HELPER_H
+#define DMG_WIFI_RADIO_ENERGY_MODEL_HELPER_H
+
+#include "wifi-radio-energy-model-helper.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup energy
+ * \brief Assign DmgWifiRadioEnergyModel to DMG wifi devices.
+ *
+ * On top of WifiRadioEnergyModelHelper, this installer attaches the energy model
+ * to the PHY of the device, so that beam sweeping, TRN reception and RF chain
+ * switching are accounted.
+ */
+class DmgWifiRadioEnergyModelHelper : public WifiRadioEnergyModelHelper
+{
+public:
+  DmgWifiRadioEnergyModelHelper ();
+  virtual ~DmgWifiRadioEnergyModelHelper ();
+
+private:
+  virtual Ptr<DeviceEnergyModel> DoInstall (Ptr<NetDevice> device,
+                                            Ptr<EnergySource> source) const;
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_WIFI_RADIO_ENERGY_MODEL_HELPER_H */
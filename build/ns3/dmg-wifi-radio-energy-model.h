@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_WIFI_RADIO_ENERGY_MODEL_H
+#define DMG_WIFI_RADIO_ENERGY_MODEL_H
+
+#include "ns3/packet.h"
+#include "wifi-radio-energy-model.h"
+#include "wifi-tx-vector.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup energy
+ * \brief Radio energy model of a 60 GHz DMG device.
+ *
+ * On top of the PHY states accounted by WifiRadioEnergyModel, a DMG radio spends
+ * energy on operations that have no counterpart in the legacy bands:
+ *
+ * - Beam sweeping: the transmission and reception of DMG Beacons and SSW frames,
+ *   where the antenna weights are reloaded for every frame.
+ * - TRN reception: the reception of the TRN fields appended to BRP packets, where
+ *   the receiver measures the link through each AWV of the training.
+ * - RF chain switching: a change of the active DMG antenna, which powers up a
+ *   different RF chain for RfChainSwitchingTime.
+ *
+ * The current of the RX or TX state is replaced by the BeamSweepingCurrentA or
+ * the TrnRxCurrentA for the duration of these operations, while the
+ * RfChainSwitchingCurrentA is drawn in addition to the current of the PHY state.
+ * The model must be attached to the PHY of the DMG device with SetPhy, which
+ * DmgWifiRadioEnergyModelHelper does at installation time.
+ */
+class DmgWifiRadioEnergyModel : public WifiRadioEnergyModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DmgWifiRadioEnergyModel ();
+  virtual ~DmgWifiRadioEnergyModel ();
+
+  /**
+   * Connect the model to the traces of the PHY and of its directional antenna.
+   * \param phy The PHY of the DMG device.
+   */
+  void SetPhy (Ptr<WifiPhy> phy);
+
+  double GetBeamSweepingCurrentA (void) const;
+  void SetBeamSweepingCurrentA (double current);
+  double GetTrnRxCurrentA (void) const;
+  void SetTrnRxCurrentA (double current);
+  double GetRfChainSwitchingCurrentA (void) const;
+  void SetRfChainSwitchingCurrentA (double current);
+
+  /**
+   * \param newState New state the radio device is currently in.
+   *
+   * Implements DeviceEnergyModel::ChangeState, the DMG operations bound to the
+   * TX or RX state end with that state.
+   */
+  virtual void ChangeState (int newState);
+
+protected:
+  virtual void DoDispose (void);
+  virtual double DoGetCurrentA (void) const;
+
+private:
+  /**
+   * \param packet The packet being transmitted or received.
+   * \return True if the packet is a DMG Beacon or an SSW frame.
+   */
+  static bool IsBeamSweepingFrame (Ptr<const Packet> packet);
+  /**
+   * Account the energy consumed so far with the current draw in effect.
+   */
+  void UpdateEnergy (void);
+  void PhyTxBegin (Ptr<const Packet> packet);
+  void PhyRxBegin (Ptr<const Packet> packet);
+  void PhyTrnRxBegin (WifiTxVector txVector, uint8_t fieldsRemaining);
+  void AntennaSwitched (uint8_t oldAntennaId, uint8_t newAntennaId);
+  void EndRfChainSwitching (void);
+
+  Ptr<WifiPhy> m_phy;                   //!< The PHY of the DMG device.
+  double m_beamSweepingCurrentA;        //!< Current drawn while sweeping.
+  double m_trnRxCurrentA;               //!< Current drawn while receiving TRN fields.
+  double m_rfChainSwitchingCurrentA;    //!< Additional current drawn while switching RF chains.
+  Time m_rfChainSwitchingTime;          //!< Duration of an RF chain switch.
+  bool m_txSweeping;                    //!< Flag to indicate the ongoing transmission is a sweep frame.
+  bool m_rxSweeping;                    //!< Flag to indicate the ongoing reception is a sweep frame.
+  bool m_trnReceiving;                  //!< Flag to indicate we are receiving TRN fields.
+  bool m_rfChainSwitching;              //!< Flag to indicate we are switching RF chains.
+  EventId m_rfChainSwitchingEvent;      //!< Event ending the current RF chain switch.
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_WIFI_RADIO_ENERGY_MODEL_H */
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <cmath>
+#include <map>
+
+/**
+ * This script is used to evaluate the contention in the A-BFT access period when a dense deployment of
+ * DMG STAs powers up at the same time (association storm). The topology consists of one DMG AP and a
+ * number of DMG STAs placed on a circle around it. No application traffic is generated, we only measure:
+ * 1. The per-slot occupancy of the A-BFT: the number of DMG STAs contending in each slot (idle, single or
+ *    collision) and the number of slots in which the DMG AP decoded an SSW frame and trained a DMG STA.
+ * 2. The number of RSS attempts, failures and backoffs of the DMG STAs.
+ * 3. The histogram of the time (in beacon intervals) it takes each DMG STA to complete the A-BFT and
+ *    to associate with the DMG AP.
+ *
+ * To compare the slot selection strategies and the 802.11ay extended A-BFT type:
+ * ./waf --run "evaluate_abft_contention --numStations=32 --slotSelection=Uniform"
+ * ./waf --run "evaluate_abft_contention --numStations=32 --slotSelection=AddressHashed"
+ * ./waf --run "evaluate_abft_contention --numStations=32 --slotSelection=Adaptive"
+ * ./waf --run "evaluate_abft_contention --numStations=32 --abftMultiplier=1 --repeatAbft=0"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluateAbftContention");
+
+using namespace ns3;
+using namespace std;
+
+/* A-BFT statistics */
+struct SlotStatistics
+{
+  uint32_t idle;
+  uint32_t single;
+  uint32_t collision;
+  uint32_t trained;
+};
+std::map<uint8_t, SlotStatistics> slotStatistics;   /* Occupancy per A-BFT slot index. */
+std::map<uint8_t, uint32_t> slotContenders;         /* Number of DMG STAs contending per slot in the current A-BFT. */
+uint32_t rssAttempts = 0;                           /* Total RSS attempts by all the DMG STAs. */
+uint32_t rssFailures = 0;                           /* Total RSS attempts without SSW-FBCK. */
+uint32_t rssBackoffs = 0;                           /* Total number of times a DMG STA entered RSS backoff. */
+std::map<Mac48Address, uint32_t> abftDelay;         /* Number of BIs to complete the first A-BFT per DMG STA. */
+std::map<Mac48Address, uint32_t> assocDelay;        /* Number of BIs to associate per DMG STA. */
+Time beaconInterval = MicroSeconds (102400);
+
+void
+AbftSlotCompleted (Mac48Address address, uint8_t slotIndex, uint32_t responders, Mac48Address served)
+{
+  /* The DMG AP locks on the first SSW frame, so collisions are counted from the DMG STAs attempts */
+  SlotStatistics &stats = slotStatistics[slotIndex];
+  uint32_t contenders = slotContenders[slotIndex];
+  if (contenders == 0)
+    {
+      stats.idle++;
+    }
+  else if (contenders == 1)
+    {
+      stats.single++;
+    }
+  else
+    {
+      stats.collision++;
+    }
+  if (served != Mac48Address ())
+    {
+      stats.trained++;
+    }
+  slotContenders[slotIndex] = 0;
+}
+
+void
+RssAttempt (Mac48Address address, uint8_t slotIndex, uint32_t failedAttempts)
+{
+  rssAttempts++;
+  slotContenders[slotIndex]++;
+}
+
+void
+RssFailed (Mac48Address address, uint8_t slotIndex, uint32_t failedAttempts)
+{
+  rssFailures++;
+}
+
+void
+RssBackoff (Mac48Address address, uint32_t backoff)
+{
+  rssBackoffs++;
+}
+
+void
+AbftCompleted (Ptr<DmgStaWifiMac> staMac, Mac48Address address, Time delay, uint32_t attempts)
+{
+  if (abftDelay.find (staMac->GetAddress ()) == abftDelay.end ())
+    {
+      abftDelay[staMac->GetAddress ()] = ceil (Simulator::Now ().GetSeconds () / beaconInterval.GetSeconds ());
+    }
+}
+
+void
+StationAssoicated (Ptr<DmgStaWifiMac> staMac, Mac48Address address)
+{
+  if (assocDelay.find (staMac->GetAddress ()) == assocDelay.end ())
+    {
+      assocDelay[staMac->GetAddress ()] = ceil (Simulator::Now ().GetSeconds () / beaconInterval.GetSeconds ());
+    }
+}
+
+void
+PrintHistogram (std::string title, std::map<Mac48Address, uint32_t> &delays, uint32_t numStations)
+{
+  std::map<uint32_t, uint32_t> histogram;
+  for (std::map<Mac48Address, uint32_t>::iterator it = delays.begin (); it != delays.end (); it++)
+    {
+      histogram[it->second]++;
+    }
+  std::cout << title << " (" << delays.size () << "/" << numStations << " DMG STAs)" << std::endl;
+  std::cout << "BIs\tDMG STAs" << std::endl;
+  for (std::map<uint32_t, uint32_t>::iterator it = histogram.begin (); it != histogram.end (); it++)
+    {
+      std::cout << it->first << "\t" << it->second << std::endl;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t numStations = 16;                    /* The number of DMG STAs. */
+  double distance = 2.0;                        /* The distance between the DMG AP and the DMG STAs. */
+  uint32_t ssSlotsPerAbft = 8;                  /* The number of SSW slots per A-BFT. */
+  uint32_t ssFramesPerSlot = 8;                 /* The number of SSW frames per SSW slot. */
+  uint32_t abftMultiplier = 0;                  /* The number of secondary A-BFTs. */
+  string slotSelection = "Uniform";             /* The A-BFT slot selection strategy. */
+  bool repeatAbft = true;                       /* Keep contending in A-BFT after a successful RSS. */
+  string phyMode = "DMG_MCS12";                 /* Type of the Physical Layer. */
+  bool verbose = false;                         /* Print Logging Information. */
+  double simulationTime = 2;                    /* Simulation time in seconds. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("numStations", "The number of DMG STAs", numStations);
+  cmd.AddValue ("distance", "The distance between the DMG AP and the DMG STAs", distance);
+  cmd.AddValue ("ssSlotsPerAbft", "The number of SSW slots per A-BFT", ssSlotsPerAbft);
+  cmd.AddValue ("ssFramesPerSlot", "The number of SSW frames per SSW slot", ssFramesPerSlot);
+  cmd.AddValue ("abftMultiplier", "The number of secondary A-BFTs (802.11ay extended A-BFT)", abftMultiplier);
+  cmd.AddValue ("slotSelection", "The A-BFT slot selection strategy: Uniform, AddressHashed or Adaptive", slotSelection);
+  cmd.AddValue ("repeatAbft", "Keep contending in A-BFT after a successful RSS", repeatAbft);
+  cmd.AddValue ("phyMode", "802.11ad PHY Mode", phyMode);
+  cmd.AddValue ("verbose", "turn on all WifiNetDevice log components", verbose);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.Parse (argc, argv);
+
+  /**** WifiHelper is a meta-helper: it helps creates helpers ****/
+  WifiHelper wifi;
+
+  /* Basic setup */
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+
+  /* Turn on logging */
+  if (verbose)
+    {
+      wifi.EnableLogComponents ();
+      LogComponentEnable ("EvaluateAbftContention", LOG_LEVEL_ALL);
+    }
+
+  /**** Set up Channel ****/
+  YansWifiChannelHelper wifiChannel ;
+  /* Simple propagation delay model */
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  /* Friis model with standard-specific wavelength */
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (56.16e9));
+
+  /**** SETUP ALL NODES ****/
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  /* Nodes will be added to the channel we set up earlier */
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  /* All nodes transmit at 10 dBm == 10 mW, no adaptation */
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("TxGain", DoubleValue (0));
+  wifiPhy.Set ("RxGain", DoubleValue (0));
+  /* Sensitivity model includes implementation loss and noise figure */
+  wifiPhy.Set ("RxNoiseFigure", DoubleValue (3));
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79));
+  wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+  /* Set the phy layer error model */
+  wifiPhy.SetErrorRateModel ("ns3::SensitivityModel60GHz");
+  /* Set default algorithm for all nodes to be constant rate */
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "ControlMode", StringValue (phyMode),
+                                                                "DataMode", StringValue (phyMode));
+  /* Give all nodes steerable antenna */
+  wifiPhy.EnableAntenna (true, true);
+  wifiPhy.SetAntenna ("ns3::Directional60GhzAntenna",
+                      "Sectors", UintegerValue (8),
+                      "Antennas", UintegerValue (1));
+
+  NodeContainer apWifiNode;
+  apWifiNode.Create (1);
+  NodeContainer staWifiNodes;
+  staWifiNodes.Create (numStations);
+
+  /**** Allocate a default DMG Wifi MAC ****/
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+
+  Ssid ssid = Ssid ("test802.11ad");
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true),
+                   "SSSlotsPerABFT", UintegerValue (ssSlotsPerAbft), "SSFramesPerSlot", UintegerValue (ssFramesPerSlot),
+                   "ABFTMultiplier", UintegerValue (abftMultiplier),
+                   "BeaconInterval", TimeValue (beaconInterval),
+                   "BeaconTransmissionInterval", TimeValue (MicroSeconds (400)),
+                   "ATIDuration", TimeValue (MicroSeconds (300)));
+
+  NetDeviceContainer apDevice;
+  apDevice = wifi.Install (wifiPhy, wifiMac, apWifiNode);
+
+  wifiMac.SetType ("ns3::DmgStaWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "ActiveProbing", BooleanValue (false),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true),
+                   "ABFTSlotSelection", StringValue (slotSelection),
+                   "RepeatABFT", BooleanValue (repeatAbft));
+
+  NetDeviceContainer staDevices;
+  staDevices = wifi.Install (wifiPhy, wifiMac, staWifiNodes);
+
+  /* Place the DMG STAs on a circle around the DMG AP */
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      double angle = 2 * M_PI * i / numStations;
+      positionAlloc->Add (Vector (distance * cos (angle), distance * sin (angle), 0.0));
+    }
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (apWifiNode);
+  mobility.Install (staWifiNodes);
+
+  /* Connect A-BFT traces */
+  Ptr<WifiNetDevice> apWifiNetDevice = StaticCast<WifiNetDevice> (apDevice.Get (0));
+  Ptr<DmgApWifiMac> apWifiMac = StaticCast<DmgApWifiMac> (apWifiNetDevice->GetMac ());
+  apWifiMac->TraceConnectWithoutContext ("ABFTSlotCompleted", MakeCallback (&AbftSlotCompleted));
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      Ptr<WifiNetDevice> staWifiNetDevice = StaticCast<WifiNetDevice> (staDevices.Get (i));
+      Ptr<DmgStaWifiMac> staWifiMac = StaticCast<DmgStaWifiMac> (staWifiNetDevice->GetMac ());
+      staWifiMac->TraceConnectWithoutContext ("RSSAttempt", MakeCallback (&RssAttempt));
+      staWifiMac->TraceConnectWithoutContext ("RSSFailed", MakeCallback (&RssFailed));
+      staWifiMac->TraceConnectWithoutContext ("RSSBackoff", MakeCallback (&RssBackoff));
+      staWifiMac->TraceConnectWithoutContext ("ABFTCompleted", MakeBoundCallback (&AbftCompleted, staWifiMac));
+      staWifiMac->TraceConnectWithoutContext ("Assoc", MakeBoundCallback (&StationAssoicated, staWifiMac));
+    }
+
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+
+  /* Print A-BFT statistics */
+  uint32_t totalIdle = 0, totalSingle = 0, totalCollision = 0, totalTrained = 0;
+  std::cout << "Slot\tIdle\tSingle\tCollision\tTrained" << std::endl;
+  for (std::map<uint8_t, SlotStatistics>::iterator it = slotStatistics.begin (); it != slotStatistics.end (); it++)
+    {
+      std::cout << uint (it->first) << "\t" << it->second.idle << "\t" << it->second.single
+                << "\t" << it->second.collision << "\t\t" << it->second.trained << std::endl;
+      totalIdle += it->second.idle;
+      totalSingle += it->second.single;
+      totalCollision += it->second.collision;
+      totalTrained += it->second.trained;
+    }
+  std::cout << "Total\t" << totalIdle << "\t" << totalSingle << "\t" << totalCollision
+            << "\t\t" << totalTrained << std::endl;
+  std::cout << "RSS Attempts=" << rssAttempts << ", Failures=" << rssFailures
+            << ", Backoffs=" << rssBackoffs << std::endl;
+  PrintHistogram ("Time to complete A-BFT", abftDelay, numStations);
+  PrintHistogram ("Time to associate", assocDelay, numStations);
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+#include <sstream>
+#include <vector>
+
+/**
+ * This script is used to evaluate PCP/AP clustering between overlapping DMG BSSs operating on the same channel.
+ * The topology consists of a number of co-located DMG APs, each one serving a single DMG STA which sends
+ * uplink UDP traffic to its DMG AP. The first DMG AP is the synchronization PCP/AP (S-AP) of the cluster,
+ * the other DMG APs monitor the channel before starting their beacon intervals and join the cluster
+ * in an empty Beacon SP. The script prints the Beacon SP assigned to each DMG AP and the throughput of each BSS.
+ *
+ * To compare the clustering modes:
+ * ./waf --run "evaluate_ap_clustering --clusteringMode=None"
+ * ./waf --run "evaluate_ap_clustering --clusteringMode=Decentralized"
+ * ./waf --run "evaluate_ap_clustering --clusteringMode=Centralized"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluateApClustering");
+
+using namespace ns3;
+using namespace std;
+
+void
+ClusterJoined (Mac48Address address, Mac48Address clusterId, uint8_t beaconSpIndex)
+{
+  std::cout << Simulator::Now ().GetSeconds () << "s: DMG AP " << address << " joined cluster " << clusterId
+            << " in Beacon SP " << uint16_t (beaconSpIndex) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t numBss = 3;                          /* The number of overlapping DMG BSSs. */
+  string clusteringMode = "Decentralized";      /* The PCP/AP clustering mode. */
+  uint32_t clusterMaxMem = 4;                   /* The maximum number of DMG APs in the cluster. */
+  uint32_t beaconSpDuration = 1600;             /* The duration of each Beacon SP in microseconds. */
+  double apDistance = 3.0;                      /* The distance between neighbouring DMG APs in meters. */
+  double staDistance = 1.0;                     /* The distance between a DMG AP and its DMG STA in meters. */
+  uint32_t payloadSize = 1472;                  /* Transport Layer Payload size in bytes. */
+  string dataRate = "1000Mbps";                 /* Application Layer Data Rate per DMG STA. */
+  string phyMode = "DMG_MCS12";                 /* Type of the Physical Layer. */
+  bool verbose = false;                         /* Print Logging Information. */
+  double simulationTime = 3;                    /* Simulation time in seconds. */
+  Time beaconInterval = MicroSeconds (102400);  /* The beacon interval of the cluster. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("numBss", "The number of overlapping DMG BSSs", numBss);
+  cmd.AddValue ("clusteringMode", "The PCP/AP clustering mode: None, Decentralized or Centralized", clusteringMode);
+  cmd.AddValue ("clusterMaxMem", "The maximum number of DMG APs in the cluster", clusterMaxMem);
+  cmd.AddValue ("beaconSpDuration", "The duration of each Beacon SP in microseconds", beaconSpDuration);
+  cmd.AddValue ("apDistance", "The distance between neighbouring DMG APs", apDistance);
+  cmd.AddValue ("staDistance", "The distance between a DMG AP and its DMG STA", staDistance);
+  cmd.AddValue ("payloadSize", "Payload size in bytes", payloadSize);
+  cmd.AddValue ("dataRate", "Data rate for OnOff Application per DMG STA", dataRate);
+  cmd.AddValue ("phyMode", "802.11ad PHY Mode", phyMode);
+  cmd.AddValue ("verbose", "turn on all WifiNetDevice log components", verbose);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.Parse (argc, argv);
+
+  /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
+  Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
+
+  /**** WifiHelper is a meta-helper: it helps creates helpers ****/
+  WifiHelper wifi;
+
+  /* Basic setup */
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+
+  /* Turn on logging */
+  if (verbose)
+    {
+      wifi.EnableLogComponents ();
+      LogComponentEnable ("EvaluateApClustering", LOG_LEVEL_ALL);
+    }
+
+  /**** Set up Channel ****/
+  YansWifiChannelHelper wifiChannel ;
+  /* Simple propagation delay model */
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  /* Friis model with standard-specific wavelength */
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (56.16e9));
+
+  /**** SETUP ALL NODES ****/
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  /* Nodes will be added to the channel we set up earlier */
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  /* All nodes transmit at 10 dBm == 10 mW, no adaptation */
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("TxGain", DoubleValue (0));
+  wifiPhy.Set ("RxGain", DoubleValue (0));
+  /* Sensitivity model includes implementation loss and noise figure */
+  wifiPhy.Set ("RxNoiseFigure", DoubleValue (3));
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79));
+  wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+  /* Set the phy layer error model */
+  wifiPhy.SetErrorRateModel ("ns3::SensitivityModel60GHz");
+  /* Set default algorithm for all nodes to be constant rate */
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "ControlMode", StringValue (phyMode),
+                                                                "DataMode", StringValue (phyMode));
+  /* Give all nodes steerable antenna */
+  wifiPhy.EnableAntenna (true, true);
+  wifiPhy.SetAntenna ("ns3::Directional60GhzAntenna",
+                      "Sectors", UintegerValue (8),
+                      "Antennas", UintegerValue (1));
+
+  NodeContainer apWifiNodes;
+  apWifiNodes.Create (numBss);
+  NodeContainer staWifiNodes;
+  staWifiNodes.Create (numBss);
+
+  /* Internet stack*/
+  InternetStackHelper stack;
+  stack.Install (apWifiNodes);
+  stack.Install (staWifiNodes);
+
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  std::vector<NetDeviceContainer> apDevices;
+  std::vector<Ipv4InterfaceContainer> apInterfaces;
+  std::vector<NetDeviceContainer> staDevices;
+  for (uint32_t i = 0; i < numBss; i++)
+    {
+      /* Each DMG BSS has its own SSID so that the DMG STAs only associate with their DMG AP */
+      ostringstream ssidName;
+      ssidName << "bss" << i;
+      Ssid ssid = Ssid (ssidName.str ());
+      wifiMac.SetType ("ns3::DmgApWifiMac",
+                       "Ssid", SsidValue (ssid),
+                       "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true),
+                       "BE_MaxAmpduSize", UintegerValue (262143),
+                       "BE_MaxAmsduSize", UintegerValue (7935),
+                       "SSSlotsPerABFT", UintegerValue (4), "SSFramesPerSlot", UintegerValue (8),
+                       "BeaconInterval", TimeValue (beaconInterval),
+                       "BeaconTransmissionInterval", TimeValue (MicroSeconds (600)),
+                       "ATIPresent", BooleanValue (false),
+                       "ClusteringMode", StringValue (clusteringMode),
+                       "SynchronizationAp", BooleanValue (i == 0),
+                       "ClusterMaxMem", UintegerValue (clusterMaxMem),
+                       "BeaconSPDuration", TimeValue (MicroSeconds (beaconSpDuration)),
+                       "ClusterMonitorDuration", TimeValue (beaconInterval * 2));
+      NetDeviceContainer apDevice = wifi.Install (wifiPhy, wifiMac, apWifiNodes.Get (i));
+
+      wifiMac.SetType ("ns3::DmgStaWifiMac",
+                       "Ssid", SsidValue (ssid),
+                       "ActiveProbing", BooleanValue (false),
+                       "BE_MaxAmpduSize", UintegerValue (262143),
+                       "BE_MaxAmsduSize", UintegerValue (7935),
+                       "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true));
+      NetDeviceContainer staDevice = wifi.Install (wifiPhy, wifiMac, staWifiNodes.Get (i));
+
+      /* The DMG APs are placed on a line and each DMG STA faces its DMG AP */
+      positionAlloc->Add (Vector (i * apDistance, 0.0, 0.0));
+      positionAlloc->Add (Vector (i * apDistance, staDistance, 0.0));
+      mobility.SetPositionAllocator (positionAlloc);
+      mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+      mobility.Install (apWifiNodes.Get (i));
+      mobility.Install (staWifiNodes.Get (i));
+
+      ostringstream subnet;
+      subnet << "10.0." << i << ".0";
+      Ipv4AddressHelper address;
+      address.SetBase (subnet.str ().c_str (), "255.255.255.0");
+      apInterfaces.push_back (address.Assign (apDevice));
+      address.Assign (staDevice);
+      apDevices.push_back (apDevice);
+      staDevices.push_back (staDevice);
+
+      Ptr<WifiNetDevice> apWifiNetDevice = StaticCast<WifiNetDevice> (apDevice.Get (0));
+      Ptr<DmgApWifiMac> apWifiMac = StaticCast<DmgApWifiMac> (apWifiNetDevice->GetMac ());
+      apWifiMac->TraceConnectWithoutContext ("ClusterJoined", MakeCallback (&ClusterJoined));
+    }
+
+  /* We do not want any ARP packets */
+  PopulateArpCache ();
+
+  /* Each DMG STA sends uplink UDP traffic to its DMG AP */
+  std::vector<Ptr<PacketSink> > sinks;
+  for (uint32_t i = 0; i < numBss; i++)
+    {
+      PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+      ApplicationContainer sinkApp = sinkHelper.Install (apWifiNodes.Get (i));
+      sinks.push_back (StaticCast<PacketSink> (sinkApp.Get (0)));
+      sinkApp.Start (Seconds (0.0));
+
+      OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (apInterfaces[i].GetAddress (0), 9999));
+      src.SetAttribute ("MaxBytes", UintegerValue (0));
+      src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+      src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+      src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+      src.SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+      ApplicationContainer srcApp = src.Install (staWifiNodes.Get (i));
+      srcApp.Start (Seconds (1.0));
+    }
+
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+
+  /* Print the throughput of each DMG BSS */
+  double totalThroughput = 0;
+  std::cout << "BSS\tBeacon SP\tThroughput (Mbps)" << std::endl;
+  for (uint32_t i = 0; i < numBss; i++)
+    {
+      Ptr<WifiNetDevice> apWifiNetDevice = StaticCast<WifiNetDevice> (apDevices[i].Get (0));
+      Ptr<DmgApWifiMac> apWifiMac = StaticCast<DmgApWifiMac> (apWifiNetDevice->GetMac ());
+      double throughput = sinks[i]->GetTotalRx () * (double) 8 / ((simulationTime - 1) * 1e6);
+      totalThroughput += throughput;
+      std::cout << i << "\t" << uint16_t (apWifiMac->GetBeaconSpIndex ()) << "\t\t" << throughput << std::endl;
+    }
+  std::cout << "Total\t\t\t" << totalThroughput << std::endl;
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+#include <cmath>
+#include <map>
+#include <vector>
+
+/**
+ * This script is used to evaluate ATI polling, in which the DMG AP polls its DMG STAs during the ATI and
+ * turns their Service Period Requests (SPR) into SPs of the next beacon interval. The topology consists of
+ * one DMG AP and a number of DMG STAs placed on a circle around it, DMG STA i sends uplink UDP traffic at
+ * (i + 1) / numStations of dataRate. The script prints the throughput and the SP time requested by each
+ * DMG STA, and the ATI utilization (the fraction of the ATI spent in Poll/SPR exchanges).
+ *
+ * To compare contention in the DTI against SPs requested in the ATI:
+ * ./waf --run "evaluate_ati_polling --atiPolling=0"
+ * ./waf --run "evaluate_ati_polling --atiPolling=1 --pollingPolicy=RoundRobin"
+ * ./waf --run "evaluate_ati_polling --atiPolling=1 --pollingPolicy=Priority --atiDuration=100"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluateAtiPolling");
+
+using namespace ns3;
+using namespace std;
+
+/* ATI statistics */
+uint32_t atiCount = 0;                              /* Number of ATIs with polling. */
+uint32_t totalPolls = 0;                            /* Total number of Poll frames. */
+uint32_t totalResponses = 0;                        /* Total number of SPR frames with an SP request. */
+double totalUtilization = 0;                        /* Sum of the ATI utilization. */
+std::map<Mac48Address, Time> requestedTime;         /* SP time requested per DMG STA. */
+std::map<Mac48Address, uint32_t> sprCount;          /* Number of SPR frames per DMG STA. */
+
+void
+AtiCompleted (Mac48Address address, uint32_t polls, uint32_t responses, double utilization)
+{
+  atiCount++;
+  totalPolls += polls;
+  totalResponses += responses;
+  totalUtilization += utilization;
+}
+
+void
+ServicePeriodRequested (Mac48Address address, Mac48Address station, Time duration)
+{
+  requestedTime[station] += duration;
+  sprCount[station]++;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t numStations = 4;                     /* The number of DMG STAs. */
+  double distance = 1.0;                        /* The distance between the DMG AP and the DMG STAs. */
+  bool atiPolling = true;                       /* Poll the DMG STAs during the ATI. */
+  string pollingPolicy = "RoundRobin";          /* The ATI polling policy. */
+  uint32_t atiDuration = 300;                   /* The duration of the ATI in microseconds. */
+  uint32_t payloadSize = 1472;                  /* Transport Layer Payload size in bytes. */
+  string dataRate = "800Mbps";                  /* Application Layer Data Rate of the busiest DMG STA. */
+  string phyMode = "DMG_MCS12";                 /* Type of the Physical Layer. */
+  bool verbose = false;                         /* Print Logging Information. */
+  double simulationTime = 3;                    /* Simulation time in seconds. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("numStations", "The number of DMG STAs", numStations);
+  cmd.AddValue ("distance", "The distance between the DMG AP and the DMG STAs", distance);
+  cmd.AddValue ("atiPolling", "Poll the DMG STAs for SP requests during the ATI", atiPolling);
+  cmd.AddValue ("pollingPolicy", "The ATI polling policy: RoundRobin or Priority", pollingPolicy);
+  cmd.AddValue ("atiDuration", "The duration of the ATI in microseconds", atiDuration);
+  cmd.AddValue ("payloadSize", "Payload size in bytes", payloadSize);
+  cmd.AddValue ("dataRate", "Data rate for OnOff Application of the busiest DMG STA", dataRate);
+  cmd.AddValue ("phyMode", "802.11ad PHY Mode", phyMode);
+  cmd.AddValue ("verbose", "turn on all WifiNetDevice log components", verbose);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.Parse (argc, argv);
+
+  /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
+  Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
+
+  /**** WifiHelper is a meta-helper: it helps creates helpers ****/
+  WifiHelper wifi;
+
+  /* Basic setup */
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+
+  /* Turn on logging */
+  if (verbose)
+    {
+      wifi.EnableLogComponents ();
+      LogComponentEnable ("EvaluateAtiPolling", LOG_LEVEL_ALL);
+    }
+
+  /**** Set up Channel ****/
+  YansWifiChannelHelper wifiChannel ;
+  /* Simple propagation delay model */
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  /* Friis model with standard-specific wavelength */
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (56.16e9));
+
+  /**** SETUP ALL NODES ****/
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  /* Nodes will be added to the channel we set up earlier */
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  /* All nodes transmit at 10 dBm == 10 mW, no adaptation */
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("TxGain", DoubleValue (0));
+  wifiPhy.Set ("RxGain", DoubleValue (0));
+  /* Sensitivity model includes implementation loss and noise figure */
+  wifiPhy.Set ("RxNoiseFigure", DoubleValue (3));
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79));
+  wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+  /* Set the phy layer error model */
+  wifiPhy.SetErrorRateModel ("ns3::SensitivityModel60GHz");
+  /* Set default algorithm for all nodes to be constant rate */
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "ControlMode", StringValue (phyMode),
+                                                                "DataMode", StringValue (phyMode));
+  /* Give all nodes steerable antenna */
+  wifiPhy.EnableAntenna (true, true);
+  wifiPhy.SetAntenna ("ns3::Directional60GhzAntenna",
+                      "Sectors", UintegerValue (8),
+                      "Antennas", UintegerValue (1));
+
+  NodeContainer apWifiNode;
+  apWifiNode.Create (1);
+  NodeContainer staWifiNodes;
+  staWifiNodes.Create (numStations);
+
+  /**** Allocate a default DMG Wifi MAC ****/
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+
+  Ssid ssid = Ssid ("test802.11ad");
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true),
+                   "BE_MaxAmpduSize", UintegerValue (262143),
+                   "BE_MaxAmsduSize", UintegerValue (7935),
+                   "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (8),
+                   "BeaconInterval", TimeValue (MicroSeconds (102400)),
+                   "BeaconTransmissionInterval", TimeValue (MicroSeconds (800)),
+                   "ATIPresent", BooleanValue (true),
+                   "ATIDuration", TimeValue (MicroSeconds (atiDuration)),
+                   "AtiPolling", BooleanValue (atiPolling),
+                   "AtiPollingPolicy", StringValue (pollingPolicy));
+
+  NetDeviceContainer apDevice;
+  apDevice = wifi.Install (wifiPhy, wifiMac, apWifiNode);
+
+  wifiMac.SetType ("ns3::DmgStaWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "ActiveProbing", BooleanValue (false),
+                   "BE_MaxAmpduSize", UintegerValue (262143),
+                   "BE_MaxAmsduSize", UintegerValue (7935),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true));
+
+  NetDeviceContainer staDevices;
+  staDevices = wifi.Install (wifiPhy, wifiMac, staWifiNodes);
+
+  /* Place the DMG STAs on a circle around the DMG AP */
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      double angle = 2 * M_PI * i / numStations;
+      positionAlloc->Add (Vector (distance * cos (angle), distance * sin (angle), 0.0));
+    }
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (apWifiNode);
+  mobility.Install (staWifiNodes);
+
+  /* Internet stack*/
+  InternetStackHelper stack;
+  stack.Install (apWifiNode);
+  stack.Install (staWifiNodes);
+
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer apInterface;
+  apInterface = address.Assign (apDevice);
+  address.Assign (staDevices);
+
+  /* We do not want any ARP packets */
+  PopulateArpCache ();
+
+  /* Each DMG STA sends uplink UDP traffic to the DMG AP on its own port */
+  std::vector<Ptr<PacketSink> > sinks;
+  uint64_t maxRate = DataRate (dataRate).GetBitRate ();
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9000 + i));
+      ApplicationContainer sinkApp = sinkHelper.Install (apWifiNode);
+      sinks.push_back (StaticCast<PacketSink> (sinkApp.Get (0)));
+      sinkApp.Start (Seconds (0.0));
+
+      OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (apInterface.GetAddress (0), 9000 + i));
+      src.SetAttribute ("MaxBytes", UintegerValue (0));
+      src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+      src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+      src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+      src.SetAttribute ("DataRate", DataRateValue (DataRate (maxRate * (i + 1) / numStations)));
+      ApplicationContainer srcApp = src.Install (staWifiNodes.Get (i));
+      srcApp.Start (Seconds (1.0));
+    }
+
+  /* Connect ATI traces */
+  Ptr<WifiNetDevice> apWifiNetDevice = StaticCast<WifiNetDevice> (apDevice.Get (0));
+  Ptr<DmgApWifiMac> apWifiMac = StaticCast<DmgApWifiMac> (apWifiNetDevice->GetMac ());
+  apWifiMac->TraceConnectWithoutContext ("AtiCompleted", MakeCallback (&AtiCompleted));
+  apWifiMac->TraceConnectWithoutContext ("ServicePeriodRequested", MakeCallback (&ServicePeriodRequested));
+
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+
+  /* Print the throughput and the SP requests of each DMG STA */
+  double totalThroughput = 0;
+  std::cout << "DMG STA\tOffered (Mbps)\tThroughput (Mbps)\tSPRs\tAvg Request (us)" << std::endl;
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      Ptr<WifiNetDevice> staWifiNetDevice = StaticCast<WifiNetDevice> (staDevices.Get (i));
+      Mac48Address staAddress = staWifiNetDevice->GetMac ()->GetAddress ();
+      double throughput = sinks[i]->GetTotalRx () * (double) 8 / ((simulationTime - 1) * 1e6);
+      totalThroughput += throughput;
+      uint32_t count = sprCount[staAddress];
+      double avgRequest = (count > 0) ? requestedTime[staAddress].GetMicroSeconds () / (double) count : 0;
+      std::cout << i << "\t" << maxRate * (i + 1) / numStations / 1e6 << "\t\t" << throughput
+                << "\t\t\t" << count << "\t" << avgRequest << std::endl;
+    }
+  std::cout << "Total\t\t\t" << totalThroughput << std::endl;
+  if (atiCount > 0)
+    {
+      std::cout << "ATIs=" << atiCount << ", Polls=" << totalPolls << ", SP Requests=" << totalResponses
+                << ", Avg ATI Utilization=" << totalUtilization / atiCount << std::endl;
+    }
+
+  Simulator::Destroy ();
+
+  return 0;
+}
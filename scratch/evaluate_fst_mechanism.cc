@@ -88,6 +88,7 @@ main(int argc, char *argv[])
   uint32_t llt = 100;                           /* Link Loss Timeout. */
   double simulationTime = 10;                   /* Simulation time in seconds. */
   bool pcapTracing = false;                     /* PCAP Tracing is enabled or not. */
+  bool automaticFst = false;                    /* Let the 60 GHz link quality trigger the FST. */
 
   /* Command line argument parser setup. */
   CommandLine cmd;
@@ -100,6 +101,7 @@ main(int argc, char *argv[])
   cmd.AddValue ("nPhyMode", "802.11n PHY Mode", nPhyMode);
   cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
   cmd.AddValue ("pcap", "Enable PCAP Tracing", pcapTracing);
+  cmd.AddValue ("automaticFst", "Trigger the FST automatically from the 60 GHz link quality", automaticFst);
   cmd.Parse (argc, argv);
 
   /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
@@ -325,9 +327,17 @@ main(int argc, char *argv[])
   Ptr<WifiPhy> srcWifiPhy = apMultibandDevice->GetPhy ();
   Ptr<WifiPhy> dstWifiPhy = staMultibandDevice->GetPhy ();
 
-  /* Schedule for FST Session Creation, STA is the Initiator */
-  Simulator::Schedule (Seconds (2), &MultiBandNetDevice::EstablishFastSessionTransferSession, staMultibandDevice,
-                       Mac48Address::ConvertFrom (apMultibandDevice->GetAddress ()));
+  if (automaticFst)
+    {
+      /* The STA initiates the FST as soon as it predicts an outage of the 60 GHz link */
+      staMultibandDevice->SetAttribute ("AutomaticFst", BooleanValue (true));
+    }
+  else
+    {
+      /* Schedule for FST Session Creation, STA is the Initiator */
+      Simulator::Schedule (Seconds (2), &MultiBandNetDevice::EstablishFastSessionTransferSession, staMultibandDevice,
+                           Mac48Address::ConvertFrom (apMultibandDevice->GetAddress ()));
+    }
 
   /* Schedule for link Interruption */
   Simulator::Schedule (Seconds (3), &InsertBlockage, adChannel, srcWifiPhy, dstWifiPhy);
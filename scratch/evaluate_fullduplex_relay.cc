@@ -135,11 +135,10 @@ TransmissionLinkChanged (Mac48Address address, TransmissionLink link)
     }
 }
 
-uint8_t
-SelectRelay (ChannelMeasurementInfoList rdsMeasurements, ChannelMeasurementInfoList dstRedsMeasurements, Mac48Address &rdsAddress)
+void
+LinkSwitchLatency (Mac48Address address, TransmissionLink link, Time latency)
 {
-  rdsAddress = rdsMac->GetAddress ();
-  return rdsMac->GetAssociationID ();
+  std::cout << "DMG STA " << address << " switched its transmission link after " << latency.As (Time::US) << std::endl;
 }
 
 void
@@ -317,7 +316,8 @@ main (int argc, char *argv[])
                    "BE_MaxAmsduSize", UintegerValue (msduAggregationSize),
                    "RDSActivated", BooleanValue (false), "REDSActivated", BooleanValue (true),
                    "RDSDuplexMode", BooleanValue (true),
-                   "RDSLinkChangeInterval", UintegerValue (250), "RDSDataSensingTime", UintegerValue (200));
+                   "RDSLinkChangeInterval", UintegerValue (250), "RDSDataSensingTime", UintegerValue (200),
+                   "RelaySelectionPolicy", EnumValue (RELAY_SELECTION_MAX_MIN_SNR));
 
   NetDeviceContainer redsDevices;
   redsDevices = wifi.Install (wifiPhy, wifiMac, NodeContainer (srcNode, dstNode));
@@ -394,8 +394,6 @@ main (int argc, char *argv[])
   srcWifiPhy = srcRedsNetDevice->GetPhy ();
   dstWifiPhy = dstRedsNetDevice->GetPhy ();
 
-  srcRedsMac->RegisterRelaySelectorFunction (MakeCallback (&SelectRelay));
-
   /* For implicit signaling, we insert packet dropper at the start of the service period between the source and destination REDS */
   srcRedsMac->TraceConnectWithoutContext ("ServicePeriodStarted", MakeCallback (&ServicePeriodStarted));
   srcRedsMac->TraceConnectWithoutContext ("ServicePeriodEnded", MakeCallback (&ServicePeriodEnded));
@@ -411,6 +409,8 @@ main (int argc, char *argv[])
   /* Traces related to link swtiching */
   srcRedsMac->TraceConnectWithoutContext ("TransmissionLinkChanged", MakeCallback (&TransmissionLinkChanged));
   dstRedsMac->TraceConnectWithoutContext ("TransmissionLinkChanged", MakeCallback (&TransmissionLinkChanged));
+  srcRedsMac->TraceConnectWithoutContext ("LinkSwitchLatency", MakeCallback (&LinkSwitchLatency));
+  dstRedsMac->TraceConnectWithoutContext ("LinkSwitchLatency", MakeCallback (&LinkSwitchLatency));
 
   /** Schedule Events **/
   /* Request the DMG Capabilities of other DMG STAs */
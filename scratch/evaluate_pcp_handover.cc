@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+#include <vector>
+
+/**
+ * This script is used to evaluate PCP handover in a DMG PBSS. The topology consists of a PCP, a standby
+ * PCP (a PCP capable DMG STA associated with the PCP) and a number of DMG STAs. Each DMG STA sends UDP
+ * traffic to the next DMG STA through the PCP. At 2s the PCP leaves the PBSS:
+ *
+ * - Explicit: the PCP hands the PBSS over to the standby PCP with a Handover Request.
+ * - Implicit: the PCP disappears, the standby PCP heads the NextPCP List and takes the PBSS over once it
+ *   misses ImplicitHandoverLostBeacons DMG Beacons.
+ * - None: the PCP disappears, the standby PCP does not support handover and starts a new PBSS, the DMG STAs
+ *   have to detect the loss of the PCP, beamform and associate again.
+ *
+ * The script prints the handover events, the throughput and the longest interruption of the traffic.
+ *
+ * ./waf --run "evaluate_pcp_handover --handoverMode=Explicit"
+ * ./waf --run "evaluate_pcp_handover --handoverMode=Implicit"
+ * ./waf --run "evaluate_pcp_handover --handoverMode=None"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluatePcpHandover");
+
+using namespace ns3;
+using namespace std;
+
+struct SinkStats
+{
+  Time lastRx;
+  Time maxGap;
+};
+
+std::vector<SinkStats> sinkStats;
+
+void
+PcpHandover (Mac48Address oldBssid, Mac48Address newPcp)
+{
+  std::cout << Simulator::Now ().GetSeconds () << "s: PBSS " << oldBssid << " handed over to " << newPcp << std::endl;
+}
+
+void
+StaFollowsPcp (Mac48Address newPcp)
+{
+  std::cout << Simulator::Now ().GetSeconds () << "s: DMG STA follows the new PCP " << newPcp << std::endl;
+}
+
+void
+StaAssociated (Mac48Address bssid)
+{
+  std::cout << Simulator::Now ().GetSeconds () << "s: DMG STA associated with " << bssid << std::endl;
+}
+
+void
+PacketReceived (uint32_t index, Ptr<const Packet> packet, const Address &address)
+{
+  SinkStats &stats = sinkStats[index];
+  if (stats.lastRx > Seconds (0))
+    {
+      stats.maxGap = std::max (stats.maxGap, Simulator::Now () - stats.lastRx);
+    }
+  stats.lastRx = Simulator::Now ();
+}
+
+void
+LeavePbss (Ptr<DmgApWifiMac> pcp, Ptr<MobilityModel> mobility, bool explicitHandover)
+{
+  if (explicitHandover)
+    {
+      if (!pcp->InitiatePcpHandover (LeavingPBSS, 3))
+        {
+          std::cout << "The PCP could not initiate the handover" << std::endl;
+        }
+    }
+  else
+    {
+      /* The PCP disappears without notice */
+      mobility->SetPosition (Vector (1000.0, 0.0, 0.0));
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t numStations = 2;                     /* The number of DMG STAs in the PBSS. */
+  string handoverMode = "Explicit";             /* The PCP handover mode. */
+  uint32_t lostBeacons = 4;                     /* The number of missed DMG Beacons before the implicit handover. */
+  uint32_t payloadSize = 1472;                  /* Transport Layer Payload size in bytes. */
+  string dataRate = "200Mbps";                  /* Application Layer Data Rate per DMG STA. */
+  string phyMode = "DMG_MCS12";                 /* Type of the Physical Layer. */
+  bool verbose = false;                         /* Print Logging Information. */
+  double simulationTime = 5;                    /* Simulation time in seconds. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("numStations", "The number of DMG STAs in the PBSS", numStations);
+  cmd.AddValue ("handoverMode", "The PCP handover mode: Explicit, Implicit or None", handoverMode);
+  cmd.AddValue ("lostBeacons", "The number of missed DMG Beacons before the implicit handover", lostBeacons);
+  cmd.AddValue ("payloadSize", "Payload size in bytes", payloadSize);
+  cmd.AddValue ("dataRate", "Data rate for OnOff Application per DMG STA", dataRate);
+  cmd.AddValue ("phyMode", "802.11ad PHY Mode", phyMode);
+  cmd.AddValue ("verbose", "turn on all WifiNetDevice log components", verbose);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.Parse (argc, argv);
+
+  /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
+  Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
+
+  /**** WifiHelper is a meta-helper: it helps creates helpers ****/
+  WifiHelper wifi;
+
+  /* Basic setup */
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+
+  /* Turn on logging */
+  if (verbose)
+    {
+      wifi.EnableLogComponents ();
+      LogComponentEnable ("EvaluatePcpHandover", LOG_LEVEL_ALL);
+    }
+
+  /**** Set up Channel ****/
+  YansWifiChannelHelper wifiChannel ;
+  /* Simple propagation delay model */
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  /* Friis model with standard-specific wavelength */
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (56.16e9));
+
+  /**** SETUP ALL NODES ****/
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  /* Nodes will be added to the channel we set up earlier */
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  /* All nodes transmit at 10 dBm == 10 mW, no adaptation */
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("TxGain", DoubleValue (0));
+  wifiPhy.Set ("RxGain", DoubleValue (0));
+  /* Sensitivity model includes implementation loss and noise figure */
+  wifiPhy.Set ("RxNoiseFigure", DoubleValue (3));
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79));
+  wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+  /* Set the phy layer error model */
+  wifiPhy.SetErrorRateModel ("ns3::SensitivityModel60GHz");
+  /* Set default algorithm for all nodes to be constant rate */
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "ControlMode", StringValue (phyMode),
+                                                                "DataMode", StringValue (phyMode));
+  /* Give all nodes steerable antenna */
+  wifiPhy.EnableAntenna (true, true);
+  wifiPhy.SetAntenna ("ns3::Directional60GhzAntenna",
+                      "Sectors", UintegerValue (8),
+                      "Antennas", UintegerValue (1));
+
+  NodeContainer pcpNodes;
+  pcpNodes.Create (2);
+  NodeContainer staWifiNodes;
+  staWifiNodes.Create (numStations);
+
+  /* Internet stack*/
+  InternetStackHelper stack;
+  stack.Install (pcpNodes);
+  stack.Install (staWifiNodes);
+
+  Ssid ssid = Ssid ("PBSS");
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true),
+                   "BE_MaxAmpduSize", UintegerValue (262143),
+                   "BE_MaxAmsduSize", UintegerValue (7935),
+                   "SSSlotsPerABFT", UintegerValue (4), "SSFramesPerSlot", UintegerValue (8),
+                   "BeaconInterval", TimeValue (MicroSeconds (102400)),
+                   "BeaconTransmissionInterval", TimeValue (MicroSeconds (600)),
+                   "ATIPresent", BooleanValue (false),
+                   "PcpHandoverSupport", BooleanValue (true));
+  NetDeviceContainer pcpDevice = wifi.Install (wifiPhy, wifiMac, pcpNodes.Get (0));
+
+  /* The standby PCP follows the PCP as a PCP capable DMG STA */
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "StandbyPcp", BooleanValue (true),
+                   "PcpHandoverSupport", BooleanValue (handoverMode != "None"),
+                   "ImplicitHandoverLostBeacons", UintegerValue (lostBeacons));
+  NetDeviceContainer standbyDevice = wifi.Install (wifiPhy, wifiMac, pcpNodes.Get (1));
+
+  wifiMac.SetType ("ns3::DmgStaWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "ActiveProbing", BooleanValue (false),
+                   "BE_MaxAmpduSize", UintegerValue (262143),
+                   "BE_MaxAmsduSize", UintegerValue (7935),
+                   "QosSupported", BooleanValue (true), "DmgSupported", BooleanValue (true));
+  NetDeviceContainer staDevices = wifi.Install (wifiPhy, wifiMac, staWifiNodes);
+
+  /* The PCP and the standby PCP are next to each other, the DMG STAs face both of them */
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (1.0, 0.0, 0.0));
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      positionAlloc->Add (Vector (i * 1.0, 1.5, 0.0));
+    }
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (pcpNodes);
+  mobility.Install (staWifiNodes);
+
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  address.Assign (pcpDevice);
+  address.Assign (standbyDevice);
+  Ipv4InterfaceContainer staInterfaces = address.Assign (staDevices);
+
+  /* We do not want any ARP packets */
+  PopulateArpCache ();
+
+  /* Connect Traces */
+  Ptr<DmgApWifiMac> pcpWifiMac = StaticCast<DmgApWifiMac> (StaticCast<WifiNetDevice> (pcpDevice.Get (0))->GetMac ());
+  Ptr<DmgApWifiMac> standbyWifiMac = StaticCast<DmgApWifiMac> (StaticCast<WifiNetDevice> (standbyDevice.Get (0))->GetMac ());
+  pcpWifiMac->TraceConnectWithoutContext ("PcpHandover", MakeCallback (&PcpHandover));
+  standbyWifiMac->TraceConnectWithoutContext ("PcpHandover", MakeCallback (&PcpHandover));
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      Ptr<DmgStaWifiMac> staWifiMac = StaticCast<DmgStaWifiMac> (StaticCast<WifiNetDevice> (staDevices.Get (i))->GetMac ());
+      staWifiMac->TraceConnectWithoutContext ("PcpHandover", MakeCallback (&StaFollowsPcp));
+      staWifiMac->TraceConnectWithoutContext ("Assoc", MakeCallback (&StaAssociated));
+    }
+
+  /* Each DMG STA sends UDP traffic to the next DMG STA through the PCP */
+  std::vector<Ptr<PacketSink> > sinks;
+  sinkStats.resize (numStations);
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+      ApplicationContainer sinkApp = sinkHelper.Install (staWifiNodes.Get (i));
+      sinks.push_back (StaticCast<PacketSink> (sinkApp.Get (0)));
+      sinks[i]->TraceConnectWithoutContext ("Rx", MakeBoundCallback (&PacketReceived, i));
+      sinkApp.Start (Seconds (0.0));
+
+      uint32_t sender = (i + numStations - 1) % numStations;
+      OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (staInterfaces.GetAddress (i), 9999));
+      src.SetAttribute ("MaxBytes", UintegerValue (0));
+      src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+      src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+      src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+      src.SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+      ApplicationContainer srcApp = src.Install (staWifiNodes.Get (sender));
+      srcApp.Start (Seconds (1.0));
+    }
+
+  Simulator::Schedule (Seconds (2.0), &LeavePbss, pcpWifiMac, pcpNodes.Get (0)->GetObject<MobilityModel> (),
+                       handoverMode == "Explicit");
+
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+
+  /* Print the throughput and the longest interruption of each flow */
+  std::cout << "Flow\tThroughput (Mbps)\tMax Gap (ms)" << std::endl;
+  for (uint32_t i = 0; i < numStations; i++)
+    {
+      double throughput = sinks[i]->GetTotalRx () * (double) 8 / ((simulationTime - 1) * 1e6);
+      std::cout << i << "\t" << throughput << "\t\t\t" << sinkStats[i].maxGap.GetMilliSeconds () << std::endl;
+    }
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,32 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/dmg-wifi-radio-energy-model.h"
+#include "ns3/wifi-net-device.h"
+#include "dmg-wifi-radio-energy-model-helper.h"
+
+namespace ns3 {
+
+DmgWifiRadioEnergyModelHelper::DmgWifiRadioEnergyModelHelper ()
+{
+  m_radioEnergy.SetTypeId ("ns3::DmgWifiRadioEnergyModel");
+}
+
+DmgWifiRadioEnergyModelHelper::~DmgWifiRadioEnergyModelHelper ()
+{
+}
+
+Ptr<DeviceEnergyModel>
+DmgWifiRadioEnergyModelHelper::DoInstall (Ptr<NetDevice> device,
+                                          Ptr<EnergySource> source) const
+{
+  Ptr<DeviceEnergyModel> model = WifiRadioEnergyModelHelper::DoInstall (device, source);
+  Ptr<DmgWifiRadioEnergyModel> dmgModel = DynamicCast<DmgWifiRadioEnergyModel> (model);
+  NS_ASSERT (dmgModel != 0);
+  dmgModel->SetPhy (DynamicCast<WifiNetDevice> (device)->GetPhy ());
+  return model;
+}
+
+} // namespace ns3
@@ -101,7 +101,7 @@ public:
                           std::string n6 = "", const AttributeValue &v6 = EmptyAttributeValue (),
                           std::string n7 = "", const AttributeValue &v7 = EmptyAttributeValue ());
 
-private:
+protected:
   /**
    * \param device Pointer to the NetDevice to install DeviceEnergyModel.
    * \param source Pointer to EnergySource to install.
@@ -111,7 +111,7 @@ private:
   virtual Ptr<DeviceEnergyModel> DoInstall (Ptr<NetDevice> device,
                                             Ptr<EnergySource> source) const;
 
-private:
+protected:
   ObjectFactory m_radioEnergy;
   WifiRadioEnergyModel::WifiRadioEnergyDepletionCallback m_depletionCallback;
   WifiRadioEnergyModel::WifiRadioEnergyRechargedCallback m_rechargedCallback;
@@ -287,6 +287,19 @@ Ptr<const Packet>
 BlockAckManager::GetNextPacket (WifiMacHeader &hdr)
 {
   NS_LOG_FUNCTION (this << &hdr);
+  return DoGetNextPacket (hdr, 0);
+}
+
+Ptr<const Packet>
+BlockAckManager::GetNextPacketByAddress (WifiMacHeader &hdr, Mac48Address receiver)
+{
+  NS_LOG_FUNCTION (this << &hdr << receiver);
+  return DoGetNextPacket (hdr, &receiver);
+}
+
+Ptr<const Packet>
+BlockAckManager::DoGetNextPacket (WifiMacHeader &hdr, const Mac48Address *receiver)
+{
   Ptr<const Packet> packet = 0;
   uint8_t tid;
   Mac48Address recipient;
@@ -297,6 +310,11 @@ BlockAckManager::GetNextPacket (WifiMacHeader &hdr)
       std::list<PacketQueueI>::iterator it = m_retryPackets.begin ();
       while (it != m_retryPackets.end ())
         {
+          if ((receiver != 0) && ((*it)->hdr.GetAddr1 () != *receiver))
+            {
+              it++;
+              continue;
+            }
           if ((*it)->hdr.IsQosData ())
             {
               tid = (*it)->hdr.GetQosTid ();
@@ -528,6 +546,43 @@ BlockAckManager::HasPackets (void) const
   return (m_retryPackets.size () > 0 || m_bars.size () > 0);
 }
 
+bool
+BlockAckManager::HasBarForReceiver (struct Bar &bar, Mac48Address receiver)
+{
+  NS_LOG_FUNCTION (this << &bar << receiver);
+  for (std::list<Bar>::iterator it = m_bars.begin (); it != m_bars.end (); it++)
+    {
+      if (it->recipient == receiver)
+        {
+          bar = *it;
+          m_bars.erase (it);
+          return true;
+        }
+    }
+  return false;
+}
+
+bool
+BlockAckManager::HasPacketsForReceiver (Mac48Address receiver) const
+{
+  NS_LOG_FUNCTION (this << receiver);
+  for (std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin (); it != m_retryPackets.end (); it++)
+    {
+      if ((*it)->hdr.GetAddr1 () == receiver)
+        {
+          return true;
+        }
+    }
+  for (std::list<Bar>::const_iterator it = m_bars.begin (); it != m_bars.end (); it++)
+    {
+      if (it->recipient == receiver)
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
 uint32_t
 BlockAckManager::GetNBufferedPackets (Mac48Address recipient, uint8_t tid) const
 {
@@ -658,6 +713,7 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                                                     (*queueIt).hdr.GetFragmentNumber ()))
                     {
                       nSuccessfulMpdus++;
+                      RemoveFromRetryQueue (recipient, tid, (*queueIt).hdr.GetSequenceNumber ());
                       queueIt = it->second.second.erase (queueIt);
                     }
                   else
@@ -692,6 +748,8 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                             {
                               m_txOkCallback ((*queueIt).hdr);
                             }
+                          /* A retransmission may have been acknowledged before the retry queue got to it */
+                          RemoveFromRetryQueue (recipient, tid, currentSeq);
                           queueIt = it->second.second.erase (queueIt);
                         }
                     }
@@ -938,19 +996,7 @@ BlockAckManager::CleanupBuffers (void)
           else
             {
               /* remove retry packet iterator if it's present in retry queue */
-              for (std::list<PacketQueueI>::iterator it = m_retryPackets.begin (); it != m_retryPackets.end (); )
-                {
-                  if ((*it)->hdr.GetAddr1 () == j->second.first.GetPeer ()
-                      && (*it)->hdr.GetQosTid () == j->second.first.GetTid ()
-                      && (*it)->hdr.GetSequenceNumber () == i->hdr.GetSequenceNumber ())
-                    {
-                      it = m_retryPackets.erase (it);
-                    }
-                  else
-                    {
-                      it++;
-                    }
-                }
+              RemoveFromRetryQueue (j->second.first.GetPeer (), j->second.first.GetTid (), i->hdr.GetSequenceNumber ());
             }
         }
       j->second.second.erase (j->second.second.begin (), end);
@@ -1054,4 +1100,23 @@ BlockAckManager::InsertInRetryQueue (PacketQueueI item)
     }
 }
 
+void
+BlockAckManager::RemoveFromRetryQueue (Mac48Address address, uint8_t tid, uint16_t seq)
+{
+  NS_LOG_FUNCTION (this << address << static_cast<uint32_t> (tid) << seq);
+  for (std::list<PacketQueueI>::iterator it = m_retryPackets.begin (); it != m_retryPackets.end (); )
+    {
+      if ((*it)->hdr.GetAddr1 () == address
+          && (*it)->hdr.GetQosTid () == tid
+          && (*it)->hdr.GetSequenceNumber () == seq)
+        {
+          it = m_retryPackets.erase (it);
+        }
+      else
+        {
+          it++;
+        }
+    }
+}
+
 } //namespace ns3
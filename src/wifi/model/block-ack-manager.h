@@ -159,6 +159,17 @@ public:
    * corresponding block ack bitmap.
    */
   Ptr<const Packet> GetNextPacket (WifiMacHeader &hdr);
+  /**
+   * \param hdr 802.11 header of returned packet (if exists).
+   * \param receiver the receiver of the returned packet.
+   *
+   * \return the packet
+   *
+   * Same as GetNextPacket, but only considers the packets sent to the given receiver.
+   * This allows several channel access functions (e.g. CBAP and SP access of a DMG STA)
+   * to share the same BlockAckManager.
+   */
+  Ptr<const Packet> GetNextPacketByAddress (WifiMacHeader &hdr, Mac48Address receiver);
   /**
    * \param hdr 802.11 header of returned packet (if exists).
    *
@@ -177,6 +188,20 @@ public:
    *         false otherwise
    */
   bool HasPackets (void) const;
+  /**
+   * \param bar the BAR scheduled for the given receiver (if exists).
+   * \param receiver the receiver of the BAR.
+   *
+   * \return true if a BAR is scheduled for the given receiver, false otherwise
+   */
+  bool HasBarForReceiver (struct Bar &bar, Mac48Address receiver);
+  /**
+   * \param receiver the receiver to check.
+   *
+   * \return true if there are packets that need retransmission or a BAR scheduled for
+   *         the given receiver, false otherwise
+   */
+  bool HasPacketsForReceiver (Mac48Address receiver) const;
   /**
    * \param blockAck The received block ack frame.
    * \param recipient Sender of block ack frame.
@@ -439,6 +464,22 @@ private:
    * This method ensures packets are retransmitted in the correct order.
    */
   void InsertInRetryQueue (PacketQueueI item);
+  /**
+   * \param address recipient mac address of the packet
+   * \param tid traffic ID of the packet
+   * \param seq sequence number of the packet
+   *
+   * Remove the reference to a packet from the retransmission queue, it must be
+   * called before the packet itself is removed from the agreement queue.
+   */
+  void RemoveFromRetryQueue (Mac48Address address, uint8_t tid, uint16_t seq);
+  /**
+   * \param hdr 802.11 header of returned packet (if exists).
+   * \param receiver the receiver of the returned packet, or 0 for any receiver.
+   *
+   * \return the next packet to retransmit
+   */
+  Ptr<const Packet> DoGetNextPacket (WifiMacHeader &hdr, const Mac48Address *receiver);
 
   /**
    * This data structure contains, for each block ack agreement (recipient, tid), a set of packets
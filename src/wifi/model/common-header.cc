@@ -162,6 +162,26 @@ MgtFrame::DeserializeInformationElements (Buffer::Iterator start)
               element = Create<StaAvailabilityElement> ();
               break;
             }
+          case IE_WAKEUP_SCHEDULE:
+            {
+              element = Create<WakeupScheduleElement> ();
+              break;
+            }
+          case IE_AWAKE_WINDOW:
+            {
+              element = Create<AwakeWindowElement> ();
+              break;
+            }
+          case IE_NEXT_PCP_LIST:
+            {
+              element = Create<NextPcpListElement> ();
+              break;
+            }
+          case IE_PCP_HANDOVER:
+            {
+              element = Create<PcpHandoverElement> ();
+              break;
+            }
         }
 
       i = element->DeserializeElementBody (i, length);
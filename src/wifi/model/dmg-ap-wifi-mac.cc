@@ -9,6 +9,7 @@
 #include "ns3/string.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include "ns3/enum.h"
 
 #include "amsdu-subframe-header.h"
 #include "dcf-manager.h"
@@ -19,6 +20,8 @@
 #include "mac-tx-middle.h"
 #include "msdu-aggregator.h"
 #include "wifi-phy.h"
+#include <algorithm>
+#include <functional>
 
 namespace ns3 {
 
@@ -69,6 +72,11 @@ DmgApWifiMac::GetTypeId (void)
                    UintegerValue (aSSFramesPerSlot),
                    MakeUintegerAccessor (&DmgApWifiMac::m_ssFramesPerSlot),
                    MakeUintegerChecker<uint8_t> (1, 16))
+    .AddAttribute ("ABFTMultiplier", "The number of secondary A-BFTs (802.11ay extended A-BFT) appended to the A-BFT. "
+                   "Each secondary A-BFT has SSSlotsPerABFT slots and is reserved for DMG STAs retrying RSS.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DmgApWifiMac::m_abftMultiplier),
+                   MakeUintegerChecker<uint8_t> (0, 7))
     .AddAttribute ("IsResponderTxss", "Indicates whether the A-BFT period is TxSS or RxSS",
                    BooleanValue (true),
                    MakeBooleanAccessor (&DmgApWifiMac::m_isResponderTXSS),
@@ -81,6 +89,80 @@ DmgApWifiMac::GetTypeId (void)
                     TimeValue (MicroSeconds (500)),
                     MakeTimeAccessor (&DmgApWifiMac::m_atiDuration),
                     MakeTimeChecker ())
+    .AddAttribute ("AwakeWindow", "The time at the beginning of the DTI during which the DMG STAs in power save "
+                   "mode stay awake, announced in the Awake Window element. Zero disables the element.",
+                   TimeValue (MicroSeconds (0)),
+                   MakeTimeAccessor (&DmgApWifiMac::m_awakeWindow),
+                   MakeTimeChecker (MicroSeconds (0), MicroSeconds (65535)))
+    .AddAttribute ("ShareBeaconIntervalClock", "Whether the associated DMG STAs follow the access periods and the "
+                   "allocations of the BI from a single clock shared by the BSS instead of scheduling their own events.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_shareBiClock),
+                   MakeBooleanChecker ())
+
+    /* PCP/AP Clustering */
+    .AddAttribute ("ClusteringMode", "The PCP/AP clustering mode used to share the channel with overlapping DMG BSSs.",
+                   EnumValue (NO_CLUSTERING),
+                   MakeEnumAccessor (&DmgApWifiMac::m_clusteringMode),
+                   MakeEnumChecker (NO_CLUSTERING, "None",
+                                    DECENTRALIZED_CLUSTERING, "Decentralized",
+                                    CENTRALIZED_CLUSTERING, "Centralized"))
+    .AddAttribute ("SynchronizationAp", "Whether the PCP/AP forms a cluster as its synchronization PCP/AP (S-AP) "
+                   "instead of monitoring the channel for an existing cluster.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_synchronizationAp),
+                   MakeBooleanChecker ())
+    .AddAttribute ("ClusterMaxMem", "The maximum number of PCP/APs in a cluster formed by this S-AP, "
+                   "i.e. the number of Beacon SPs within each beacon interval.",
+                   UintegerValue (8),
+                   MakeUintegerAccessor (&DmgApWifiMac::m_clusterMaxMem),
+                   MakeUintegerChecker<uint8_t> (2, 8))
+    .AddAttribute ("BeaconSPDuration", "The duration of the Beacon SP of each member in a cluster formed by this S-AP. "
+                   "The members do not transmit during the Beacon SPs of each other.",
+                   TimeValue (MicroSeconds (1600)),
+                   MakeTimeAccessor (&DmgApWifiMac::m_beaconSpDuration),
+                   MakeTimeChecker (MicroSeconds (8), MicroSeconds (2040)))
+    .AddAttribute ("ClusterMonitorDuration", "The time the PCP/AP listens to the channel for the DMG Beacons of a cluster "
+                   "before starting its first beacon interval, extended by a random number of beacon intervals "
+                   "below ClusterMaxMem.",
+                   TimeValue (MicroSeconds (aMinChannelTime)),
+                   MakeTimeAccessor (&DmgApWifiMac::m_clusterMonitorDuration),
+                   MakeTimeChecker ())
+
+    /* PCP Handover */
+    .AddAttribute ("StandbyPcp", "Whether the PCP starts as a PCP-capable DMG STA in the PBSS of the PCP with the same SSID "
+                   "instead of starting its own PBSS. With PcpHandoverSupport it takes the PBSS over when the PCP "
+                   "hands it over or disappears, otherwise it starts a new PBSS once the PCP is lost.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_standbyPcp),
+                   MakeBooleanChecker ())
+    .AddAttribute ("ImplicitHandoverLostBeacons", "The number of consecutive BIs without DMG Beacon from the PCP after "
+                   "which a standby PCP at the head of the next PCP list takes the PBSS over (implicit handover). "
+                   "This should be lower than the MaxLostBeacons of the DMG STAs.",
+                   UintegerValue (4),
+                   MakeUintegerAccessor (&DmgApWifiMac::m_implicitHandoverLostBeacons),
+                   MakeUintegerChecker<uint32_t> (1, 255))
+
+    /* ATI Polling */
+    .AddAttribute ("AtiPolling", "Whether the PCP/AP polls its associated DMG STAs for SP requests during the ATI. "
+                   "The DMG STAs answer with SPR frames reporting the airtime of the frames buffered for the PCP/AP.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_atiPolling),
+                   MakeBooleanChecker ())
+    .AddAttribute ("AtiPollingPolicy", "The order in which the PCP/AP polls its DMG STAs during the ATI.",
+                   EnumValue (ATI_POLL_ROUND_ROBIN),
+                   MakeEnumAccessor (&DmgApWifiMac::m_atiPollingPolicy),
+                   MakeEnumChecker (ATI_POLL_ROUND_ROBIN, "RoundRobin",
+                                    ATI_POLL_PRIORITY, "Priority"))
+    .AddAttribute ("AtiPollTimeout", "The time the PCP/AP waits for the SPR of a polled DMG STA before polling the next one.",
+                   TimeValue (MicroSeconds (50)),
+                   MakeTimeAccessor (&DmgApWifiMac::m_atiPollTimeout),
+                   MakeTimeChecker ())
+    .AddAttribute ("AtiAllocation", "Whether the PCP/AP turns the SP requests collected during the ATI into SPs "
+                   "announced in the next BI, after its static allocations.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_atiAllocation),
+                   MakeBooleanChecker ())
 
     /* DMG Parameters */
     .AddAttribute ("CBAPSource", "Indicates that PCP/AP has a higher priority for transmission in CBAP",
@@ -94,6 +176,21 @@ DmgApWifiMac::GetTypeId (void)
       .AddTraceSource ("DTIStarted", "The Data Transmission Interval access period started.",
                        MakeTraceSourceAccessor (&DmgApWifiMac::m_dtiStarted),
                        "ns3::DmgApWifiMac::DtiStartedTracedCallback")
+      .AddTraceSource ("ABFTSlotCompleted", "An A-BFT SSW slot has ended.",
+                       MakeTraceSourceAccessor (&DmgApWifiMac::m_abftSlotCompleted),
+                       "ns3::DmgApWifiMac::AbftSlotCompletedCallback")
+      .AddTraceSource ("ClusterJoined", "The PCP/AP joined or formed a PCP/AP cluster.",
+                       MakeTraceSourceAccessor (&DmgApWifiMac::m_clusterJoined),
+                       "ns3::DmgApWifiMac::ClusterJoinedCallback")
+      .AddTraceSource ("PcpHandover", "The PCP handed its PBSS over or the standby PCP took a PBSS over.",
+                       MakeTraceSourceAccessor (&DmgApWifiMac::m_pcpHandover),
+                       "ns3::DmgApWifiMac::PcpHandoverCallback")
+      .AddTraceSource ("ServicePeriodRequested", "A DMG STA polled during the ATI requested an SP.",
+                       MakeTraceSourceAccessor (&DmgApWifiMac::m_servicePeriodRequested),
+                       "ns3::DmgApWifiMac::ServicePeriodRequestedCallback")
+      .AddTraceSource ("AtiCompleted", "An ATI in which the PCP/AP polled its DMG STAs has ended.",
+                       MakeTraceSourceAccessor (&DmgApWifiMac::m_atiCompleted),
+                       "ns3::DmgApWifiMac::AtiCompletedCallback")
   ;
   return tid;
 }
@@ -114,9 +211,34 @@ DmgApWifiMac::DmgApWifiMac ()
 
   /* Constant Values */
   m_receivedOneSSW = false;
+  m_currentSlotIndex = 0;
   m_aidCounter = 0;
   m_btiPeriodicity = 0;
-  m_nextAbft = m_abftPeriodicity;
+  m_nextAbft = 0;
+  m_clusterRole = NOT_PARTICIPATING;
+  m_beaconSpIndex = 0;
+  m_clusterProbeBIs = 0;
+  m_monitoringCluster = false;
+  m_syncApFound = false;
+  m_clusterRequests = 0;
+  m_sendingClusterRequests = false;
+  m_clusterMonitorJitter = CreateObject<UniformRandomVariable> ();
+  m_followingPcp = false;
+  m_standbyAid = 0;
+  m_standbyBeamformed = false;
+  m_standbyAssocPending = false;
+  m_sendingStandbySweep = false;
+  m_nextPcp = false;
+  m_pcpBiStart = Seconds (-1);
+  m_standbySlotVariable = CreateObject<UniformRandomVariable> ();
+  m_nextPcpToken = 0;
+  m_synchronizedStations = 0;
+  m_requestedRemainingBIs = 0;
+  m_handoverRemainingBIs = 0;
+  m_leftPbss = false;
+  m_handoverAnnouncements = 0;
+  m_atiPollOffset = 0;
+  m_atiPolls = 0;
 
   // Let the lower layers know that we are acting as an AP.
   SetTypeOfStation (DMG_AP);
@@ -133,6 +255,20 @@ DmgApWifiMac::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_beaconDca = 0;
   m_beaconEvent.Cancel ();
+  m_clusterEvent.Cancel ();
+  m_pcpLostEvent.Cancel ();
+  m_takeOverEvent.Cancel ();
+  m_pollTimeoutEvent.Cancel ();
+  for (std::map<Mac48Address, EventId>::iterator it = m_clusterResponseEvents.begin ();
+       it != m_clusterResponseEvents.end (); it++)
+    {
+      it->second.Cancel ();
+    }
+  if (m_biClock != 0)
+    {
+      m_biClock->Dispose ();
+      m_biClock = 0;
+    }
   DmgWifiMac::DoDispose ();
 }
 
@@ -359,6 +495,9 @@ DmgApWifiMac::GetDmgCapabilities (void) const
   capabilities->SetMaxAssociatedStaNumber (254);
   capabilities->SetPowerSource (true); /* Not battery powered */
   capabilities->SetPcpForwarding (true);
+  capabilities->SetPcpHandover (m_pcpHandoverSupport);
+  capabilities->SetDecentralizedClustering (m_clusteringMode == DECENTRALIZED_CLUSTERING);
+  capabilities->SetCentralizedClustering (m_clusteringMode == CENTRALIZED_CLUSTERING);
 
   return capabilities;
 }
@@ -392,7 +531,9 @@ Ptr<ExtendedScheduleElement>
 DmgApWifiMac::GetExtendedScheduleElement (void) const
 {
   Ptr<ExtendedScheduleElement> scheduleElement = Create<ExtendedScheduleElement> ();
-  scheduleElement->SetAllocationFieldList (m_allocationList);
+  AllocationFieldList allocationList = m_allocationList;
+  allocationList.insert (allocationList.end (), m_quietPeriods.begin (), m_quietPeriods.end ());
+  scheduleElement->SetAllocationFieldList (allocationList);
   return scheduleElement;
 }
 
@@ -509,7 +650,7 @@ DmgApWifiMac::SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t co
 
   /* Beacon Interval Control Field */
   ExtDMGBeaconIntervalCtrlField ctrl;
-  ctrl.SetCCPresent (false);
+  ctrl.SetCCPresent (m_clusterRole != NOT_PARTICIPATING);
   ctrl.SetDiscoveryMode (false);          /* Discovery Mode = 0 when transmitted by PCP/AP */
   ctrl.SetNextBeacon (m_nextBeacon);
   /* Signal the presence of an ATI interval */
@@ -533,15 +674,23 @@ DmgApWifiMac::SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t co
   ctrl.SetABFT_Count (10);
   ctrl.SetN_ABFT_Ant (0);
   ctrl.SetPCPAssoicationReady (false);
+  ctrl.SetABFT_Multiplier (m_abftMultiplier);
   beacon.SetBeaconIntervalControlField (ctrl);
 
+  /* Clustering Control Field */
+  if (ctrl.IsCCPresent ())
+    {
+      ExtDMGClusteringControlField cluster = GetClusteringControlField ();
+      beacon.SetClusterControlField (cluster);
+    }
+
   /* DMG Parameters*/
   ExtDMGParameters parameters;
   parameters.Set_BSS_Type (InfrastructureBSS);  // An AP sets the BSS Type subfield to 3 within transmitted DMG Beacon,
   parameters.Set_CBAP_Only (m_isCbapOnly);
   parameters.Set_CBAP_Source (m_isCbapSource);
   parameters.Set_DMG_Privacy (false);
-  parameters.Set_ECPAC_Policy_Enforced (false);
+  parameters.Set_ECPAC_Policy_Enforced (m_clusteringMode == CENTRALIZED_CLUSTERING);
   beacon.SetDMGParameters (parameters);
 
   /* Service Set Identifier Information Element */
@@ -557,7 +706,42 @@ DmgApWifiMac::SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t co
   /* Add Relay Capability Element */
   beacon.AddWifiInformationElement (GetRelayCapabilitiesElement ());
   /* Extended Schedule Element */
-  beacon.AddWifiInformationElement (GetExtendedScheduleElement ());  
+  beacon.AddWifiInformationElement (GetExtendedScheduleElement ());
+  /* Awake Window Element */
+  if (m_awakeWindow.IsStrictlyPositive ())
+    {
+      Ptr<AwakeWindowElement> awakeWindow = Create<AwakeWindowElement> ();
+      awakeWindow->SetAwakeWindow (m_awakeWindow.GetMicroSeconds ());
+      beacon.AddWifiInformationElement (awakeWindow);
+    }
+  /* Next PCP List Element */
+  if (!m_nextPcpList.empty ())
+    {
+      Ptr<NextPcpListElement> nextPcpList = Create<NextPcpListElement> ();
+      nextPcpList->SetToken (m_nextPcpToken);
+      for (NextPcpAidList::const_iterator it = m_nextPcpList.begin (); it != m_nextPcpList.end (); it++)
+        {
+          nextPcpList->AddNextPcpAid (*it);
+        }
+      beacon.AddWifiInformationElement (nextPcpList);
+    }
+  /* PCP Handover Element, announcing either our handover in progress or the PBSS we took over */
+  if (m_newPcp != Mac48Address ())
+    {
+      Ptr<PcpHandoverElement> handover = Create<PcpHandoverElement> ();
+      handover->SetOldBssID (GetBssid ());
+      handover->SetNewPcpAddress (m_newPcp);
+      handover->SetRemainingBIs (m_handoverRemainingBIs);
+      beacon.AddWifiInformationElement (handover);
+    }
+  else if (m_handoverAnnouncements > 0)
+    {
+      Ptr<PcpHandoverElement> handover = Create<PcpHandoverElement> ();
+      handover->SetOldBssID (m_oldBssid);
+      handover->SetNewPcpAddress (GetAddress ());
+      handover->SetRemainingBIs (0);
+      beacon.AddWifiInformationElement (handover);
+    }
 
   /* Set Antenna Sector in the PHY Layer */
   m_phy->GetDirectionalAntenna ()->SetCurrentTxSectorID (sectorID);
@@ -567,10 +751,17 @@ DmgApWifiMac::SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t co
   m_beaconDca->TransmitDmgBeacon (beacon, hdr);
 }
 
+Ptr<DmgBeaconIntervalClock>
+DmgApWifiMac::GetBeaconIntervalClock (void) const
+{
+  return m_biClock;
+}
+
 Time
 DmgApWifiMac::GetBTIRemainingTime (void) const
 {
-  return m_btiRemaining - (Simulator::Now () - m_beaconTransmitted);
+  /* A DMG Beacon deferred by an overlapping BSS may be sent after the end of the BTI */
+  return Max (m_btiRemaining - (Simulator::Now () - m_beaconTransmitted), Seconds (0));
 }
 
 void
@@ -624,6 +815,12 @@ DmgApWifiMac::FrameTxOk (const WifiMacHeader &hdr)
 
           /* Cleanup non-static allocations */
           CleanupAllocations ();
+
+          /* One more BTI announced the PBSS we took over */
+          if (m_handoverAnnouncements > 0)
+            {
+              m_handoverAnnouncements--;
+            }
         }
       else
         {
@@ -653,6 +850,43 @@ DmgApWifiMac::FrameTxOk (const WifiMacHeader &hdr)
             }
         }
 	}
+  else if (hdr.IsActionNoAck () && m_sendingClusterRequests)
+    {
+      if (m_totalSectors == 0)
+        {
+          /* Wait for the Cluster Response of the S-AP */
+          m_sendingClusterRequests = false;
+          m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
+        }
+      else
+        {
+          m_antennaConfigurationIndex++;
+          m_totalSectors--;
+          ANTENNA_CONFIGURATION config = m_antennaConfigurationTable[m_antennaConfigurationIndex];
+          /* LBIFS is switching DMG Antenna and SBIFS is switching Sector */
+          Time ifs = (config.first == 1) ? m_lbifs : m_sbifs;
+          Simulator::Schedule (ifs, &DmgApWifiMac::SendClusterRequest, this,
+                               config.first, config.second, m_totalSectors);
+        }
+    }
+  else if (hdr.IsSSW () && m_sendingStandbySweep)
+    {
+      if (m_totalSectors == 0)
+        {
+          /* Wait for the SSW-FBCK of the PCP */
+          m_sendingStandbySweep = false;
+          m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
+        }
+      else
+        {
+          m_antennaConfigurationIndex++;
+          m_totalSectors--;
+          ANTENNA_CONFIGURATION config = m_antennaConfigurationTable[m_antennaConfigurationIndex];
+          Time ifs = (config.first == 1) ? m_lbifs : m_sbifs;
+          Simulator::Schedule (ifs, &DmgApWifiMac::SendStandbySectorSweepFrame, this,
+                               config.first, config.second, m_totalSectors);
+        }
+    }
   else if (hdr.IsSSW_FBCK ())
     {
       ANTENNA_CONFIGURATION antennaConfig;
@@ -676,6 +910,18 @@ DmgApWifiMac::StartBeaconInterval (void)
 {
   NS_LOG_FUNCTION (this << "DMG AP Starting BI at " << Simulator::Now ());
 
+  /* The new PCP takes over in this BI once the Remaining BIs of our handover elapsed */
+  if (m_newPcp != Mac48Address ())
+    {
+      m_handoverRemainingBIs--;
+      if (m_handoverRemainingBIs == 0)
+        {
+          LeavePbss ();
+          return;
+        }
+    }
+  UpdateNextPcpList ();
+
   /* Invoke callback */
   m_biStarted (GetAddress ());
 
@@ -685,10 +931,52 @@ DmgApWifiMac::StartBeaconInterval (void)
   /* Timing variables */
   m_biStartTime = Simulator::Now ();
 
+  /* The SPs granted in the last ATI are announced in the DMG Beacons of this BI, a BI without BTI keeps them pending */
+  m_atiAllocations.clear ();
+  if ((m_btiPeriodicity == 0) && !m_pendingAtiAllocations.empty ())
+    {
+      m_atiAllocations.swap (m_pendingAtiAllocations);
+      m_allocationList.insert (m_allocationList.end (), m_atiAllocations.begin (), m_atiAllocations.end ());
+    }
+
+  /* Protect the Beacon SPs of the other members of our cluster */
+  UpdateQuietPeriods ();
+
+  /* A member of a decentralized cluster cannot hear another PCP/AP that took the same Beacon SP at the same time,
+     so in the first BIs after taking a Beacon SP it now and then listens through its BTI instead of beaconing */
+  bool listenBti = false;
+  if ((m_btiPeriodicity == 0) && (m_clusteringMode == DECENTRALIZED_CLUSTERING)
+      && (m_clusterRole == PARTICIPATING_PCP_AP) && (m_clusterProbeBIs > 0))
+    {
+      m_clusterProbeBIs--;
+      listenBti = (m_clusterMonitorJitter->GetInteger (0, m_clusterMaxMem - 1) == 0);
+    }
+
+  /* Drive the associated DMG STAs through this BI, the timeline follows the DMG Beacon we are about to send */
+  if (m_biClock != 0)
+    {
+      bool btiPresent = (m_btiPeriodicity == 0);
+      if (btiPresent)
+        {
+          AllocationFieldList allocationList = m_allocationList;
+          allocationList.insert (allocationList.end (), m_quietPeriods.begin (), m_quietPeriods.end ());
+          m_biClock->SetAllocationList (allocationList);
+        }
+      m_biClock->StartBeaconInterval (btiPresent, m_btiDuration, btiPresent && !listenBti && (m_nextAbft == 0), m_abftDuration,
+                                      m_atiPresent, m_atiDuration, m_mbifs);
+    }
+
   if (m_btiPeriodicity == 0)
     {
       m_btiPeriodicity = m_nextBeacon;
-      StartBeaconTransmissionInterval ();
+      if (listenBti)
+        {
+          ListenBeaconTransmissionInterval ();
+        }
+      else
+        {
+          StartBeaconTransmissionInterval ();
+        }
     }
   else
     {
@@ -742,6 +1030,24 @@ DmgApWifiMac::StartBeaconTransmissionInterval (void)
   m_beaconEvent = Simulator::ScheduleNow (&DmgApWifiMac::SendOneDMGBeacon, this,  config.first, config.second, m_totalSectors);
 }
 
+void
+DmgApWifiMac::ListenBeaconTransmissionInterval (void)
+{
+  NS_LOG_FUNCTION (this << "DMG AP Listening during BTI at " << Simulator::Now ());
+  m_accessPeriod = CHANNEL_ACCESS_BTI;
+  m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
+
+  /* No DMG Beacon announces an A-BFT in this BI */
+  if (m_atiPresent)
+    {
+      Simulator::Schedule (m_btiDuration + m_mbifs, &DmgApWifiMac::StartAnnouncementTransmissionInterval, this);
+    }
+  else
+    {
+      Simulator::Schedule (m_btiDuration + m_mbifs, &DmgApWifiMac::StartDataTransmissionInterval, this);
+    }
+}
+
 void
 DmgApWifiMac::StartAssociationBeamformTraining (void)
 {
@@ -758,22 +1064,38 @@ DmgApWifiMac::StartAssociationBeamformTraining (void)
       Simulator::Schedule (m_abftDuration + m_mbifs, &DmgApWifiMac::StartDataTransmissionInterval, this);
     }
 
-  /* Schedule the beginning of the first A-BFT Slot */
-  m_remainingSlots = m_ssSlotsPerABFT;
+  /* Schedule the beginning of the first A-BFT Slot, the primary A-BFT is followed by the secondary A-BFTs */
+  m_remainingSlots = m_ssSlotsPerABFT * (1 + m_abftMultiplier);
+  m_currentSlotIndex = 0;
   Simulator::ScheduleNow (&DmgApWifiMac::StartSectorSweepSlot, this);
 }
 
 void
 DmgApWifiMac::StartSectorSweepSlot (void)
 {
-  NS_LOG_FUNCTION (this << "DMG AP Starting A-BFT SSW Slot [" << m_ssSlotsPerABFT - m_remainingSlots << "] at " << Simulator::Now ());
+  NS_LOG_FUNCTION (this << "DMG AP Starting A-BFT SSW Slot [" << uint (m_currentSlotIndex) << "] at " << Simulator::Now ());
   m_receivedOneSSW = false;
+  m_slotResponders.clear ();
   m_remainingSlots--;
+  Simulator::Schedule (NanoSeconds (m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot)),
+                       &DmgApWifiMac::EndSectorSweepSlot, this);
+}
+
+void
+DmgApWifiMac::EndSectorSweepSlot (void)
+{
+  NS_LOG_FUNCTION (this << uint (m_currentSlotIndex) << m_slotResponders.size ());
+  Mac48Address served;
+  if (m_receivedOneSSW)
+    {
+      served = m_peerAbftStation;
+    }
+  m_abftSlotCompleted (GetAddress (), m_currentSlotIndex, m_slotResponders.size (), served);
   /* Schedule the beginning of the next A-BFT Slot */
   if (m_remainingSlots > 0)
     {
-      Simulator::Schedule (NanoSeconds (m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot)),
-                           &DmgApWifiMac::StartSectorSweepSlot, this);
+      m_currentSlotIndex++;
+      StartSectorSweepSlot ();
     }
 }
 
@@ -792,11 +1114,20 @@ DmgApWifiMac::StartAnnouncementTransmissionInterval (void)
 {
   NS_LOG_FUNCTION (this << "DMG AP Starting ATI at " << Simulator::Now ());
   m_accessPeriod = CHANNEL_ACCESS_ATI;
+  m_atiStartTime = Simulator::Now ();
   /* Schedule DTI Period Starting Time */
   Simulator::Schedule (m_atiDuration, &DmgApWifiMac::StartDataTransmissionInterval, this);
   /* Initiate BRP Setup Subphase, currently ATI is used for BRP Setup + Training */
   m_dmgAtiDca->InitiateTransmission (m_atiDuration);
-  DoBrpSetupSubphase ();
+  if (m_atiPolling)
+    {
+      /* The BRP Setup Subphase uses what is left of the ATI once all the DMG STAs have been polled */
+      StartAtiPolling ();
+    }
+  else
+    {
+      DoBrpSetupSubphase ();
+    }
 }
 
 void
@@ -836,6 +1167,7 @@ DmgApWifiMac::StartDataTransmissionInterval (void)
   NS_LOG_FUNCTION (this);
   NS_LOG_INFO ("DMG AP Starting DTI at " << Simulator::Now ());
   m_accessPeriod = CHANNEL_ACCESS_DTI;
+  m_dtiStartTime = Simulator::Now ();
 
   /* Schedule the beginning of next BHI interval */
   Time nextBeaconInterval = m_beaconInterval - (Simulator::Now () - m_biStartTime);
@@ -848,12 +1180,23 @@ DmgApWifiMac::StartDataTransmissionInterval (void)
     {
       NS_LOG_INFO ("CBAP allocation only in DTI");
       m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
-      Simulator::ScheduleNow (&DmgApWifiMac::StartContentionPeriod, this, BROADCAST_CBAP, nextBeaconInterval);
+      Simulator::ScheduleNow (&DmgApWifiMac::StartContentionPeriod, this, BROADCAST_CBAP, GetCbapOnlyContentionDuration ());
+      /* Stop contending during the Beacon SPs of the other PCP/APs of the cluster */
+      for (AllocationFieldList::iterator iter = m_quietPeriods.begin (); iter != m_quietPeriods.end (); iter++)
+        {
+          Time quietStart = MicroSeconds (iter->GetAllocationStart ());
+          Simulator::Schedule (quietStart, &DmgApWifiMac::EndContentionPeriod, this);
+          Simulator::Schedule (quietStart + MicroSeconds (iter->GetAllocationBlockDuration ()),
+                               &DmgApWifiMac::ResumeContentionPeriod, this);
+        }
     }
   else
     {
+      /* The SPs granted by ATI polling are non-static, they already left m_allocationList after the BTI */
+      AllocationFieldList allocationList = m_allocationList;
+      allocationList.insert (allocationList.end (), m_atiAllocations.begin (), m_atiAllocations.end ());
       AllocationField field;
-      for (AllocationFieldList::iterator iter = m_allocationList.begin (); iter != m_allocationList.end (); iter++)
+      for (AllocationFieldList::iterator iter = allocationList.begin (); iter != allocationList.end (); iter++)
         {
           field = (*iter);
           if (field.GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
@@ -933,6 +1276,217 @@ DmgApWifiMac::SendAnnounceFrame (Mac48Address to)
   m_dmgAtiDca->Queue (packet, hdr);
 }
 
+void
+DmgApWifiMac::StartAtiPolling (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_atiPollList.clear ();
+  m_sprRequests.clear ();
+  m_atiBusyTime = Seconds (0);
+  m_atiPolls = 0;
+  m_polledStation = Mac48Address ();
+  Simulator::Schedule (m_atiDuration, &DmgApWifiMac::EndAtiPolling, this);
+
+  for (AssociatedStationsInfoByAddress::const_iterator it = m_associatedStationsInfoByAddress.begin ();
+       it != m_associatedStationsInfoByAddress.end (); it++)
+    {
+      if (m_stationManager->IsAssociated (it->first))
+        {
+          m_atiPollList.push_back (it->first);
+        }
+    }
+  if (m_atiPollList.empty ())
+    {
+      PollNextStation ();
+      return;
+    }
+
+  if (m_atiPollingPolicy == ATI_POLL_ROUND_ROBIN)
+    {
+      /* The DMG STAs that do not fit in this ATI are polled first in the next one */
+      m_atiPollOffset %= m_atiPollList.size ();
+      std::rotate (m_atiPollList.begin (), m_atiPollList.begin () + m_atiPollOffset, m_atiPollList.end ());
+    }
+  else
+    {
+      /* DMG STAs reporting the same buffered traffic keep the association order */
+      std::multimap<uint16_t, Mac48Address, std::greater<uint16_t> > priorityList;
+      for (std::vector<Mac48Address>::const_iterator it = m_atiPollList.begin (); it != m_atiPollList.end (); it++)
+        {
+          priorityList.insert (std::make_pair (m_bufferedTraffic[*it], *it));
+        }
+      m_atiPollList.clear ();
+      for (std::multimap<uint16_t, Mac48Address, std::greater<uint16_t> >::const_iterator it = priorityList.begin ();
+           it != priorityList.end (); it++)
+        {
+          m_atiPollList.push_back (it->second);
+        }
+    }
+  PollNextStation ();
+}
+
+void
+DmgApWifiMac::PollNextStation (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_polledStation = Mac48Address ();
+  Time remainingAti = m_atiDuration - (Simulator::Now () - m_atiStartTime);
+  if (remainingAti < m_atiPollTimeout)
+    {
+      return;
+    }
+  else if (m_atiPollList.empty ())
+    {
+      DoBrpSetupSubphase ();
+      return;
+    }
+  m_polledStation = m_atiPollList.front ();
+  m_atiPollList.erase (m_atiPollList.begin ());
+  m_atiPolls++;
+  m_atiPollOffset++;
+  m_pollStartTime = Simulator::Now ();
+  SendPollFrame (m_polledStation);
+  m_pollTimeoutEvent = Simulator::Schedule (m_atiPollTimeout, &DmgApWifiMac::PollTimeout, this);
+}
+
+void
+DmgApWifiMac::SendPollFrame (Mac48Address to)
+{
+  NS_LOG_FUNCTION (this << to);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_CTL_DMG_POLL);
+  hdr.SetAddr1 (to);              // Receiver.
+  hdr.SetAddr2 (GetAddress ());   // Transmiter.
+
+  /* The DMG STA answers SIFS after the Poll */
+  CtrlDmgPoll poll;
+  poll.SetResponseOffset (0);
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (poll);
+
+  NS_LOG_INFO ("Sending Poll Frame to " << to << " at " << Simulator::Now ());
+  m_dmgAtiDca->Queue (packet, hdr);
+}
+
+void
+DmgApWifiMac::PollTimeout (void)
+{
+  NS_LOG_FUNCTION (this << m_polledStation);
+  NS_LOG_INFO ("No SPR from " << m_polledStation << " during the ATI");
+  m_atiBusyTime += Simulator::Now () - m_pollStartTime;
+  PollNextStation ();
+}
+
+void
+DmgApWifiMac::ReceiveSprFrame (Mac48Address from, const CtrlDMG_SPR &spr)
+{
+  NS_LOG_FUNCTION (this << from);
+  if ((m_accessPeriod != CHANNEL_ACCESS_ATI) || (from != m_polledStation))
+    {
+      NS_LOG_DEBUG ("Ignore unsolicited SPR from " << from);
+      return;
+    }
+  m_pollTimeoutEvent.Cancel ();
+  m_atiBusyTime += Simulator::Now () - m_pollStartTime;
+
+  Dynamic_Allocation_Info_Field info = spr.GetDynamicAllocationInfo ();
+  NS_LOG_INFO ("DMG STA " << from << " requests an SP of " << info.GetAllocationDuration () << " us");
+  m_bufferedTraffic[from] = info.GetAllocationDuration ();
+  if (info.GetAllocationDuration () > 0)
+    {
+      m_sprRequests[from] = info;
+    }
+  m_servicePeriodRequested (GetAddress (), from, MicroSeconds (info.GetAllocationDuration ()));
+  PollNextStation ();
+}
+
+void
+DmgApWifiMac::EndAtiPolling (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_pollTimeoutEvent.Cancel ();
+  m_atiPollList.clear ();
+  m_polledStation = Mac48Address ();
+  double utilization = m_atiBusyTime.GetSeconds () / m_atiDuration.GetSeconds ();
+  NS_LOG_INFO ("ATI polling: " << m_atiPolls << " polls, " << m_sprRequests.size () << " SP requests, utilization "
+               << utilization);
+  m_atiCompleted (GetAddress (), m_atiPolls, m_sprRequests.size (), utilization);
+
+  m_pendingAtiAllocations.clear ();
+  if (!m_atiAllocation || m_sprRequests.empty ())
+    {
+      return;
+    }
+
+  /* Place the requested SPs after the static allocations, up to the end of a DTI like the current one */
+  uint32_t allocationStart = 0;
+  std::set<AllocationID> usedIds;
+  for (AllocationFieldList::const_iterator iter = m_allocationList.begin (); iter != m_allocationList.end (); iter++)
+    {
+      allocationStart = std::max (allocationStart, iter->GetAllocationStart () + iter->GetAllocationBlockDuration ()
+                                  + aDMGPPMinListeningTime);
+      usedIds.insert (iter->GetAllocationID ());
+    }
+  uint32_t dtiEnd = (m_beaconInterval - (Simulator::Now () - m_biStartTime)).GetMicroSeconds ();
+  for (AllocationFieldList::const_iterator iter = m_quietPeriods.begin (); iter != m_quietPeriods.end (); iter++)
+    {
+      dtiEnd = std::min (dtiEnd, iter->GetAllocationStart ());
+    }
+  bool cbapOnly = m_allocationList.empty ();
+  AllocationID allocationId = 0;
+  for (std::map<Mac48Address, Dynamic_Allocation_Info_Field>::const_iterator it = m_sprRequests.begin ();
+       it != m_sprRequests.end (); it++)
+    {
+      /* MacLow keeps the suspended transmissions per allocation ID, so each SP needs its own one */
+      do
+        {
+          allocationId++;
+        }
+      while ((usedIds.find (allocationId) != usedIds.end ()) && (allocationId <= MAX_ALLOCATION_ID));
+      if (allocationId > MAX_ALLOCATION_ID)
+        {
+          break;
+        }
+      uint32_t duration = std::min<uint32_t> (it->second.GetAllocationDuration (), aMaxAllocationBlockDuration);
+      if (allocationStart + duration > dtiEnd)
+        {
+          duration = (dtiEnd > allocationStart) ? dtiEnd - allocationStart : 0;
+        }
+      if (duration == 0)
+        {
+          break;
+        }
+      AllocationField field;
+      field.SetAllocationID (allocationId);
+      field.SetAllocationType (SERVICE_PERIOD_ALLOCATION);
+      field.SetAsPseudoStatic (false);
+      field.SetSourceAid (it->second.GetSourceAID ());
+      field.SetDestinationAid (it->second.GetDestinationAID ());
+      field.SetAllocationStart (allocationStart);
+      field.SetAllocationBlockDuration (duration);
+      field.SetNumberOfBlocks (1);
+      m_pendingAtiAllocations.push_back (field);
+      allocationStart += duration + aDMGPPMinListeningTime;
+    }
+
+  /* Without static allocations the DTI was a single CBAP, keep contention in the rest of the DTI */
+  while (cbapOnly && (allocationStart < dtiEnd))
+    {
+      uint32_t duration = std::min<uint32_t> (dtiEnd - allocationStart, aMaxAllocationBlockDuration);
+      AllocationField field;
+      field.SetAllocationID (0);
+      field.SetAllocationType (CBAP_ALLOCATION);
+      field.SetAsPseudoStatic (false);
+      field.SetSourceAid (AID_BROADCAST);
+      field.SetDestinationAid (AID_BROADCAST);
+      field.SetAllocationStart (allocationStart);
+      field.SetAllocationBlockDuration (duration);
+      field.SetNumberOfBlocks (1);
+      m_pendingAtiAllocations.push_back (field);
+      allocationStart += duration;
+    }
+}
+
 void 
 DmgApWifiMac::TxOk (Ptr<const Packet> packet, const WifiMacHeader &hdr)
 {
@@ -957,6 +1511,11 @@ DmgApWifiMac::TxFailed (const WifiMacHeader &hdr)
       NS_LOG_DEBUG ("assoc failed with sta=" << hdr.GetAddr1 ());
       m_stationManager->RecordGotAssocTxFailed (hdr.GetAddr1 ());
     }
+  else if (hdr.IsAssocReq ())
+    {
+      /* Retry the association with the PCP in its next DTI */
+      m_standbyAssocPending = false;
+    }
 }
 
 Ptr<MultiBandElement>
@@ -1047,10 +1606,69 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
         }
       return;
     }
+  else if (hdr->IsDMGBeacon ())
+    {
+      /* The DMG Beacons of the other PCP/APs tell us the Beacon SPs of their cluster */
+      if (m_monitoringCluster)
+        {
+          ExtDMGBeacon beacon;
+          packet->RemoveHeader (beacon);
+          ReceiveClusterBeacon (beacon, hdr);
+        }
+      /* Another member of our decentralized cluster beacons in our Beacon SP */
+      else if ((m_clusteringMode == DECENTRALIZED_CLUSTERING) && (m_clusterRole == PARTICIPATING_PCP_AP)
+               && (m_accessPeriod == CHANNEL_ACCESS_BTI))
+        {
+          ExtDMGBeacon beacon;
+          packet->RemoveHeader (beacon);
+          ResolveBeaconSpCollision (beacon, hdr);
+        }
+      /* As a standby PCP we follow the BIs of the PCP */
+      else if (m_followingPcp)
+        {
+          ExtDMGBeacon beacon;
+          packet->RemoveHeader (beacon);
+          ReceivePcpBeacon (beacon, hdr);
+        }
+      return;
+    }
+  else if (hdr->IsSprFrame ())
+    {
+      CtrlDMG_SPR spr;
+      packet->RemoveHeader (spr);
+      ReceiveSprFrame (from, spr);
+      return;
+    }
+  else if (hdr->IsSSW_FBCK ())
+    {
+      if (m_followingPcp && (from == m_pcpAddress))
+        {
+          /* The SSW-FBCK of the PCP contains our best TX sector toward it */
+          CtrlDMG_SSW_FBCK fbck;
+          packet->RemoveHeader (fbck);
+          DMG_SSW_FBCK_Field sswFeedback = fbck.GetSswFeedbackField ();
+          sswFeedback.IsPartOfISS (false);
+          ANTENNA_CONFIGURATION_TX antennaConfigTx = std::make_pair (sswFeedback.GetSector (), sswFeedback.GetDMGAntenna ());
+          ANTENNA_CONFIGURATION_RX antennaConfigRx = std::make_pair (NO_ANTENNA_CONFIG, NO_ANTENNA_CONFIG);
+          m_bestAntennaConfig[from] = std::make_pair (antennaConfigTx, antennaConfigRx);
+          m_standbyBeamformed = true;
+          NS_LOG_INFO ("Best TX Antenna Sector Config by this standby PCP to PCP=" << from
+                       << ": SectorID=" << uint32_t (antennaConfigTx.first)
+                       << ", AntennaID=" << uint32_t (antennaConfigTx.second));
+          m_slsCompleted (from, CHANNEL_ACCESS_BHI, antennaConfigTx.first, antennaConfigTx.second);
+          SendStandbyAssociationRequest ();
+        }
+      return;
+    }
   else if (hdr->IsSSW ())
     {
       NS_LOG_INFO ("Received SSW frame from=" << hdr->GetAddr2 ());
 
+      if (m_accessPeriod == CHANNEL_ACCESS_ABFT)
+        {
+          m_slotResponders.insert (hdr->GetAddr2 ());
+        }
+
       /* Check if we have received SSW frame during the current SSW-Slot */
       if (!m_receivedOneSSW)
         {
@@ -1154,6 +1772,22 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                 }
               return;
             }
+          else if (hdr->IsAssocResp ())
+            {
+              if (m_followingPcp && m_standbyAssocPending && (from == m_pcpAddress))
+                {
+                  MgtAssocResponseHeader assocResp;
+                  packet->RemoveHeader (assocResp);
+                  m_standbyAssocPending = false;
+                  if (assocResp.GetStatusCode ().IsSuccess ())
+                    {
+                      m_standbyAid = assocResp.GetAid ();
+                      NS_LOG_INFO ("Standby PCP " << GetAddress () << " associated with PCP " << from
+                                   << " with AID=" << m_standbyAid);
+                    }
+                }
+              return;
+            }
           else if (hdr->IsDisassociation ())
             {
               m_stationManager->RecordDisassociated (from);
@@ -1242,6 +1876,72 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                         SendInformationResponse (from, responseHdr);
                         return;
                       }
+                    case WifiActionHeader::DMG_INFORMATION_RESPONSE:
+                      {
+                        ExtInformationResponse responseHdr;
+                        packet->RemoveHeader (responseHdr);
+                        if (!m_followingPcp || (from != m_pcpAddress))
+                          {
+                            return;
+                          }
+                        /* The PCP hands us its association table and its allocation schedule */
+                        NS_LOG_INFO ("Received the association table of PCP " << from);
+                        m_pcpStationsInfo.clear ();
+                        DmgCapabilitiesList capabilitiesList = responseHdr.GetDmgCapabilitiesList ();
+                        for (DmgCapabilitiesList::const_iterator it = capabilitiesList.begin ();
+                             it != capabilitiesList.end (); it++)
+                          {
+                            WifiInformationElementMap infoMap;
+                            infoMap[IE_DMG_CAPABILITIES] = *it;
+                            m_pcpStationsInfo[(*it)->GetAID ()] = infoMap;
+                          }
+                        Ptr<ExtendedScheduleElement> scheduleElement =
+                            StaticCast<ExtendedScheduleElement> (responseHdr.GetInformationElement (IE_EXTENDED_SCHEDULE));
+                        if (scheduleElement != 0)
+                          {
+                            m_pcpAllocationList = scheduleElement->GetAllocationFieldList ();
+                          }
+                        return;
+                      }
+                    case WifiActionHeader::DMG_HANDOVER_REQUEST:
+                      {
+                        ExtHandoverRequestHeader requestHdr;
+                        packet->RemoveHeader (requestHdr);
+                        if (!m_followingPcp || (from != m_pcpAddress))
+                          {
+                            return;
+                          }
+                        NS_LOG_INFO ("Received Handover Request from PCP " << from << " with reason "
+                                     << requestHdr.GetHandoverReason () << ", RemainingBI="
+                                     << uint16_t (requestHdr.GetHandoverRemainingBI ()));
+                        SendHandoverResponse (from, m_pcpHandoverSupport && (m_standbyAid != 0));
+                        return;
+                      }
+                    case WifiActionHeader::DMG_HANDOVER_RESPONSE:
+                      {
+                        ExtHandoverResponseHeader responseHdr;
+                        packet->RemoveHeader (responseHdr);
+                        if (from != m_handoverCandidate)
+                          {
+                            return;
+                          }
+                        m_handoverCandidate = Mac48Address ();
+                        /* A Handover Result of 0 means that the DMG STA accepted to become the new PCP */
+                        if (responseHdr.GetHandoverResult () == 0)
+                          {
+                            NS_LOG_INFO ("DMG STA " << from << " accepted to take over the PBSS of " << GetAddress ());
+                            m_newPcp = from;
+                            /* Announce the handover from the next BI onward */
+                            m_handoverRemainingBIs = m_requestedRemainingBIs + 1;
+                            SendPcpStateTransfer (from);
+                          }
+                        else
+                          {
+                            NS_LOG_INFO ("DMG STA " << from << " rejected the handover with reason "
+                                         << responseHdr.GetHandoverRejectReason ());
+                          }
+                        return;
+                      }
                     default:
                       packet->AddHeader (actionHdr);
                       DmgWifiMac::Receive (packet, hdr);
@@ -1256,13 +1956,72 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
             }
           else if (hdr->IsActionNoAck ())
             {
-              DmgWifiMac::Receive (packet, hdr);
-              return;
-            }
-        }
-      return;
-    }
-  DmgWifiMac::Receive (packet, hdr);
+              WifiActionHeader actionHdr;
+              packet->PeekHeader (actionHdr);
+              if (actionHdr.GetCategory () == WifiActionHeader::DMG)
+                {
+                  switch (actionHdr.GetAction ().dmgAction)
+                    {
+                    case WifiActionHeader::DMG_CLUSTER_REQUEST:
+                      {
+                        ExtClusterRequestHeader requestHdr;
+                        packet->RemoveHeader (actionHdr);
+                        packet->RemoveHeader (requestHdr);
+                        if ((m_clusterRole != SYNC_PCP_AP) || (m_clusteringMode != CENTRALIZED_CLUSTERING)
+                            || (requestHdr.GetClusterID () != GetAddress ()))
+                          {
+                            return;
+                          }
+                        /* Map the antenna configuration of the requesting PCP/AP */
+                        MapTxSnr (from, requestHdr.GetSectorID (), requestHdr.GetAntennaID (), m_stationManager->GetRxSnr ());
+                        EventId &responseEvent = m_clusterResponseEvents[from];
+                        if (!responseEvent.IsRunning ())
+                          {
+                            /* Respond MBIFS after the end of the Cluster Request sweep */
+                            Time sweepRemaining = (m_phy->GetLastRxDuration () + m_lbifs) * int64_t (requestHdr.GetCountDown ());
+                            responseEvent = Simulator::Schedule (sweepRemaining + m_mbifs, &DmgApWifiMac::SendClusterResponse, this,
+                                                                 from, requestHdr.GetBestSectorID (), requestHdr.GetBestAntennaID ());
+                          }
+                        return;
+                      }
+                    case WifiActionHeader::DMG_CLUSTER_RESPONSE:
+                      {
+                        ExtClusterResponseHeader responseHdr;
+                        packet->RemoveHeader (actionHdr);
+                        packet->RemoveHeader (responseHdr);
+                        if ((m_clusterRequests == 0) || (responseHdr.GetClusterID () != m_clusterId))
+                          {
+                            return;
+                          }
+                        m_clusterEvent.Cancel ();
+                        m_clusterRequests = 0;
+                        if (responseHdr.GetStatusCode () == 0)
+                          {
+                            ANTENNA_CONFIGURATION_TX antennaConfigTx
+                                = std::make_pair (responseHdr.GetBestSectorID (), responseHdr.GetBestAntennaID ());
+                            ANTENNA_CONFIGURATION_RX antennaConfigRx = std::make_pair (NO_ANTENNA_CONFIG, NO_ANTENNA_CONFIG);
+                            m_bestAntennaConfig[from] = std::make_pair (antennaConfigTx, antennaConfigRx);
+                            JoinCluster (responseHdr.GetBeaconSpIndex ());
+                          }
+                        else
+                          {
+                            NS_LOG_INFO ("Cluster " << m_clusterId << " is full, " << GetAddress ()
+                                         << " operates without clustering");
+                            StartBeaconInterval ();
+                          }
+                        return;
+                      }
+                    default:
+                      break;
+                    }
+                }
+              DmgWifiMac::Receive (packet, hdr);
+              return;
+            }
+        }
+      return;
+    }
+  DmgWifiMac::Receive (packet, hdr);
 }
 
 void 
@@ -1288,6 +2047,950 @@ DmgApWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const Wi
   }
 }
 
+enum ClusterMemberRole
+DmgApWifiMac::GetClusterMemberRole (void) const
+{
+  return m_clusterRole;
+}
+
+uint8_t
+DmgApWifiMac::GetBeaconSpIndex (void) const
+{
+  return m_beaconSpIndex;
+}
+
+ExtDMGClusteringControlField
+DmgApWifiMac::GetClusteringControlField (void) const
+{
+  ExtDMGClusteringControlField cluster;
+  cluster.SetBeaconSpDuration (static_cast<uint16_t> (m_beaconSpDuration.GetMicroSeconds ()));
+  cluster.SetClusterID (m_clusterId);
+  cluster.SetClusterMemberRole (m_clusterRole);
+  cluster.SetClusterMaxMem (m_clusterMaxMem);
+  return cluster;
+}
+
+Time
+DmgApWifiMac::GetBeaconSpSpacing (void) const
+{
+  return MicroSeconds (m_beaconInterval.GetMicroSeconds () / m_clusterMaxMem);
+}
+
+Time
+DmgApWifiMac::GetNextBeaconSpStart (uint8_t beaconSpIndex) const
+{
+  Time start = m_clusterTimeReference + GetBeaconSpSpacing () * int64_t (beaconSpIndex - 1);
+  Time now = Simulator::Now ();
+  if (start <= now)
+    {
+      start += m_beaconInterval * ((now - start) / m_beaconInterval + 1);
+    }
+  return start;
+}
+
+void
+DmgApWifiMac::FormCluster (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_LOG_INFO ("DMG AP " << GetAddress () << " forms a cluster as S-AP at " << Simulator::Now ());
+  m_clusterRole = SYNC_PCP_AP;
+  m_clusterId = GetAddress ();
+  m_beaconSpIndex = 1;
+  m_clusterTimeReference = Simulator::Now ();
+  m_clusterJoined (GetAddress (), m_clusterId, m_beaconSpIndex);
+  StartBeaconInterval ();
+}
+
+void
+DmgApWifiMac::JoinCluster (uint8_t beaconSpIndex)
+{
+  NS_LOG_FUNCTION (this << uint16_t (beaconSpIndex));
+  m_clusterRole = PARTICIPATING_PCP_AP;
+  m_beaconSpIndex = beaconSpIndex;
+  m_clusterProbeBIs = 2 * m_clusterMaxMem;
+  Time biStart = GetNextBeaconSpStart (beaconSpIndex);
+  NS_LOG_INFO ("DMG AP " << GetAddress () << " joins cluster " << m_clusterId << " in Beacon SP "
+               << uint16_t (beaconSpIndex) << ", first BI starts at " << biStart);
+  m_clusterJoined (GetAddress (), m_clusterId, m_beaconSpIndex);
+  Simulator::Schedule (biStart - Simulator::Now (), &DmgApWifiMac::StartBeaconInterval, this);
+}
+
+void
+DmgApWifiMac::StartClusterMonitoring (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_monitoringCluster = true;
+  m_syncApFound = false;
+  m_monitoredBeaconSps.clear ();
+  m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
+  /* Stagger the PCP/APs powered up together, so that each one sees the Beacon SPs taken by the others
+     and their Cluster Requests do not collide at the S-AP */
+  Time monitorDuration = m_clusterMonitorDuration
+    + m_beaconInterval * int64_t (m_clusterMonitorJitter->GetInteger (0, m_clusterMaxMem - 1));
+  m_clusterEvent = Simulator::Schedule (monitorDuration, &DmgApWifiMac::EndClusterMonitoring, this);
+}
+
+void
+DmgApWifiMac::ReceiveClusterBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr)
+{
+  NS_LOG_FUNCTION (this << hdr->GetAddr1 ());
+  ExtDMGBeaconIntervalCtrlField ctrl = beacon.GetBeaconIntervalControlField ();
+  if (!ctrl.IsCCPresent ())
+    {
+      return;
+    }
+  ExtDMGClusteringControlField cluster = beacon.GetClusterControlField ();
+  if ((cluster.GetClusterMemberRole () == NOT_PARTICIPATING)
+      || (m_syncApFound && (cluster.GetClusterID () != m_clusterId)))
+    {
+      return;
+    }
+
+  Time biStart = GetBeaconIntervalStart (beacon, hdr);
+
+  if (cluster.GetClusterMemberRole () == SYNC_PCP_AP)
+    {
+      /* The S-AP dictates the BI and the Beacon SPs of the cluster */
+      m_syncApFound = true;
+      m_clusterId = cluster.GetClusterID ();
+      m_clusterTimeReference = biStart;
+      m_beaconInterval = MicroSeconds (beacon.GetBeaconIntervalUs ());
+      m_beaconSpDuration = MicroSeconds (cluster.GetBeaconSpDuration ());
+      m_clusterMaxMem = cluster.GetClusterMaxMem ();
+
+      /* Record the sectors of the S-AP to feed back the best one in the Cluster Request */
+      DMG_SSW_Field ssw = beacon.GetSSWField ();
+      MapTxSnr (hdr->GetAddr1 (), ssw.GetSectorID (), ssw.GetDMGAntennaID (), m_stationManager->GetRxSnr ());
+    }
+  m_monitoredBeaconSps[hdr->GetAddr1 ()] = biStart;
+}
+
+Time
+DmgApWifiMac::GetBeaconIntervalStart (ExtDMGBeacon &beacon, const WifiMacHeader *hdr) const
+{
+  /* Derive the start of the BI of the sender the same way the DMG STAs do */
+  ExtDMGBeaconIntervalCtrlField ctrl = beacon.GetBeaconIntervalControlField ();
+  Ptr<DmgOperationElement> operationElement
+      = StaticCast<DmgOperationElement> (beacon.GetInformationElement (IE_DMG_OPERATION));
+  Ptr<NextDmgAti> atiElement = StaticCast<NextDmgAti> (beacon.GetInformationElement (IE_NEXT_DMG_ATI));
+  Time abftDuration = NanoSeconds (ctrl.GetABFT_Length () * (1 + ctrl.GetABFT_Multiplier ())
+                                   * m_low->GetSectorSweepSlotTime (ctrl.GetFSS ()));
+  abftDuration = MicroSeconds (ceil ((double) abftDuration.GetNanoSeconds () / 1000));
+  Time btiDuration = MicroSeconds (operationElement->GetMinBHIDuration ()) - abftDuration
+                     - MicroSeconds (atiElement->GetAtiDuration ()) - 2 * GetMbifs ();
+  return MicroSeconds (beacon.GetTimestamp ()) + hdr->GetDuration () - btiDuration;
+}
+
+uint8_t
+DmgApWifiMac::SelectEmptyBeaconSp (void)
+{
+  NS_LOG_FUNCTION (this);
+  /* Mark the Beacon SPs in which we received DMG Beacons as occupied */
+  std::vector<bool> occupied (m_clusterMaxMem, false);
+  int64_t spacing = GetBeaconSpSpacing ().GetTimeStep ();
+  int64_t interval = m_beaconInterval.GetTimeStep ();
+  for (std::map<Mac48Address, Time>::const_iterator it = m_monitoredBeaconSps.begin ();
+       it != m_monitoredBeaconSps.end (); it++)
+    {
+      int64_t offset = (it->second - m_clusterTimeReference).GetTimeStep () % interval;
+      if (offset < 0)
+        {
+          offset += interval;
+        }
+      occupied[((offset + spacing / 2) / spacing) % m_clusterMaxMem] = true;
+    }
+  if (m_clusterRole != NOT_PARTICIPATING)
+    {
+      occupied[m_beaconSpIndex - 1] = true;
+    }
+
+  /* Pick one of the empty Beacon SPs at random, the PCP/APs that monitored the cluster
+     together are less likely to pick the same one */
+  std::vector<uint8_t> emptySlots;
+  for (uint8_t slot = 1; slot < m_clusterMaxMem; slot++)
+    {
+      if (!occupied[slot])
+        {
+          emptySlots.push_back (slot);
+        }
+    }
+  if (emptySlots.empty ())
+    {
+      return 0;
+    }
+  return emptySlots[m_clusterMonitorJitter->GetInteger (0, emptySlots.size () - 1)] + 1;
+}
+
+void
+DmgApWifiMac::ResolveBeaconSpCollision (ExtDMGBeacon &beacon, const WifiMacHeader *hdr)
+{
+  NS_LOG_FUNCTION (this << hdr->GetAddr1 ());
+  ExtDMGBeaconIntervalCtrlField ctrl = beacon.GetBeaconIntervalControlField ();
+  if (!ctrl.IsCCPresent () || (beacon.GetClusterControlField ().GetClusterID () != m_clusterId))
+    {
+      return;
+    }
+  Time biStart = GetBeaconIntervalStart (beacon, hdr);
+  m_monitoredBeaconSps[hdr->GetAddr1 ()] = biStart;
+  if ((Abs (biStart - m_biStartTime) >= GetBeaconSpSpacing () / 2) || (GetAddress () < hdr->GetAddr1 ()))
+    {
+      return;
+    }
+
+  uint8_t beaconSpIndex = SelectEmptyBeaconSp ();
+  if (beaconSpIndex == 0)
+    {
+      NS_LOG_INFO ("No empty Beacon SP left for " << GetAddress () << " in cluster " << m_clusterId);
+      return;
+    }
+  /* Shift our next BI to the start of the new Beacon SP */
+  Time shift = GetBeaconSpSpacing () * int64_t (beaconSpIndex - m_beaconSpIndex);
+  if (shift.IsNegative ())
+    {
+      shift += m_beaconInterval;
+    }
+  NS_LOG_INFO ("DMG AP " << hdr->GetAddr1 () << " shares Beacon SP " << uint16_t (m_beaconSpIndex)
+               << ", " << GetAddress () << " moves to Beacon SP " << uint16_t (beaconSpIndex));
+  m_biStartTime += shift;
+  m_beaconSpIndex = beaconSpIndex;
+  m_clusterProbeBIs = 2 * m_clusterMaxMem;
+  m_clusterJoined (GetAddress (), m_clusterId, m_beaconSpIndex);
+}
+
+void
+DmgApWifiMac::EndClusterMonitoring (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_monitoringCluster = false;
+  if (!m_syncApFound)
+    {
+      FormCluster ();
+      return;
+    }
+
+  if (m_clusteringMode == DECENTRALIZED_CLUSTERING)
+    {
+      uint8_t beaconSpIndex = SelectEmptyBeaconSp ();
+      if (beaconSpIndex != 0)
+        {
+          JoinCluster (beaconSpIndex);
+          return;
+        }
+      NS_LOG_INFO ("No empty Beacon SP in cluster " << m_clusterId << ", " << GetAddress ()
+                   << " operates without clustering");
+      StartBeaconInterval ();
+    }
+  else
+    {
+      /* Ask the S-AP for a Beacon SP right after its own Beacon SP */
+      m_clusterRequests = 0;
+      m_clusterEvent = Simulator::Schedule (GetNextBeaconSpStart (1) + m_beaconSpDuration - Simulator::Now (),
+                                            &DmgApWifiMac::StartClusterRequestSweep, this);
+    }
+}
+
+void
+DmgApWifiMac::StartClusterRequestSweep (void)
+{
+  NS_LOG_FUNCTION (this << uint16_t (m_clusterRequests));
+  if (m_clusterRequests == dot11MaxClusterRequests)
+    {
+      NS_LOG_INFO ("No Cluster Response from the S-AP " << m_clusterId << ", " << GetAddress ()
+                   << " operates without clustering");
+      m_clusterRequests = 0;
+      StartBeaconInterval ();
+      return;
+    }
+  m_clusterRequests++;
+
+  /* Sweep the Cluster Request through all our sectors */
+  m_sendingClusterRequests = true;
+  m_totalSectors = m_antennaConfigurationTable.size () - 1;
+  m_antennaConfigurationIndex = 0;
+  ANTENNA_CONFIGURATION config = m_antennaConfigurationTable[m_antennaConfigurationIndex];
+  SendClusterRequest (config.first, config.second, m_totalSectors);
+
+  /* Retry in the next BI of the S-AP if we do not receive a Cluster Response */
+  m_clusterEvent = Simulator::Schedule (m_beaconInterval, &DmgApWifiMac::StartClusterRequestSweep, this);
+}
+
+void
+DmgApWifiMac::SendClusterRequest (uint8_t sectorID, uint8_t antennaID, uint16_t count)
+{
+  NS_LOG_FUNCTION (this << uint16_t (sectorID) << uint16_t (antennaID) << count);
+  WifiMacHeader hdr;
+  hdr.SetActionNoAck ();
+  hdr.SetAddr1 (m_clusterId);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (GetAddress ());
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  hdr.SetNoOrder ();
+  hdr.SetDuration (Seconds (0));
+  hdr.SetNoRetry ();
+  hdr.SetNoMoreFragments ();
+  hdr.SetFragmentNumber (0);
+  hdr.SetSequenceNumber (m_txMiddle->GetNextSequenceNumberfor (&hdr));
+
+  ExtClusterRequestHeader requestHdr;
+  requestHdr.SetClusterID (m_clusterId);
+  requestHdr.SetSectorID (sectorID);
+  requestHdr.SetAntennaID (antennaID);
+  requestHdr.SetCountDown (count);
+  /* Feed back the best sector of the S-AP measured on its DMG Beacons */
+  ANTENNA_CONFIGURATION bestConfig = GetBestAntennaConfiguration (m_clusterId, true);
+  requestHdr.SetBestSectorID (bestConfig.first);
+  requestHdr.SetBestAntennaID (bestConfig.second);
+
+  WifiActionHeader actionHdr;
+  WifiActionHeader::ActionValue action;
+  action.dmgAction = WifiActionHeader::DMG_CLUSTER_REQUEST;
+  actionHdr.SetAction (WifiActionHeader::DMG, action);
+
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (requestHdr);
+  packet->AddHeader (actionHdr);
+
+  /* Set Antenna Direction */
+  m_phy->GetDirectionalAntenna ()->SetCurrentTxSectorID (sectorID);
+  m_phy->GetDirectionalAntenna ()->SetCurrentTxAntennaID (antennaID);
+
+  /* Send the sweep directly without DCA + DCF Manager, we do not have a BSS yet */
+  MacLowTransmissionParameters params;
+  params.EnableOverrideDurationId (hdr.GetDuration ());
+  params.DisableRts ();
+  params.DisableAck ();
+  params.DisableNextData ();
+  m_low->StartTransmission (packet,
+                            &hdr,
+                            params,
+                            MakeCallback (&DmgApWifiMac::FrameTxOk, this));
+}
+
+void
+DmgApWifiMac::SendClusterResponse (Mac48Address to, uint8_t bestSectorId, uint8_t bestAntennaId)
+{
+  NS_LOG_FUNCTION (this << to << uint16_t (bestSectorId) << uint16_t (bestAntennaId));
+  /* Assign the first empty Beacon SP, the S-AP occupies the first one */
+  uint16_t status = 0;
+  uint8_t beaconSpIndex = 0;
+  std::map<Mac48Address, uint8_t>::const_iterator member = m_clusterMembers.find (to);
+  if (member != m_clusterMembers.end ())
+    {
+      beaconSpIndex = member->second;
+    }
+  else
+    {
+      for (uint8_t index = 2; (index <= m_clusterMaxMem) && (beaconSpIndex == 0); index++)
+        {
+          beaconSpIndex = index;
+          for (member = m_clusterMembers.begin (); member != m_clusterMembers.end (); member++)
+            {
+              if (member->second == index)
+                {
+                  beaconSpIndex = 0;
+                  break;
+                }
+            }
+        }
+      if (beaconSpIndex == 0)
+        {
+          status = 1;
+        }
+      else
+        {
+          m_clusterMembers[to] = beaconSpIndex;
+        }
+    }
+
+  /* Reach the requesting PCP/AP through the sector it fed back */
+  ANTENNA_CONFIGURATION_TX antennaConfigTx = std::make_pair (bestSectorId, bestAntennaId);
+  ANTENNA_CONFIGURATION_RX antennaConfigRx = std::make_pair (NO_ANTENNA_CONFIG, NO_ANTENNA_CONFIG);
+  STATION_ANTENNA_CONFIG_MAP::const_iterator it = m_bestAntennaConfig.find (to);
+  if (it != m_bestAntennaConfig.end ())
+    {
+      antennaConfigRx = it->second.second;
+    }
+  m_bestAntennaConfig[to] = std::make_pair (antennaConfigTx, antennaConfigRx);
+
+  WifiMacHeader hdr;
+  hdr.SetActionNoAck ();
+  hdr.SetAddr1 (to);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (GetAddress ());
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  hdr.SetNoOrder ();
+
+  ExtClusterResponseHeader responseHdr;
+  responseHdr.SetClusterID (GetAddress ());
+  responseHdr.SetStatusCode (status);
+  responseHdr.SetBeaconSpIndex (beaconSpIndex);
+  ANTENNA_CONFIGURATION bestConfig = GetBestAntennaConfiguration (to, true);
+  responseHdr.SetBestSectorID (bestConfig.first);
+  responseHdr.SetBestAntennaID (bestConfig.second);
+
+  WifiActionHeader actionHdr;
+  WifiActionHeader::ActionValue action;
+  action.dmgAction = WifiActionHeader::DMG_CLUSTER_RESPONSE;
+  actionHdr.SetAction (WifiActionHeader::DMG, action);
+
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (responseHdr);
+  packet->AddHeader (actionHdr);
+
+  NS_LOG_INFO ("Sending Cluster Response to " << to << " with Beacon SP " << uint16_t (beaconSpIndex));
+  m_dca->Queue (packet, hdr);
+}
+
+void
+DmgApWifiMac::UpdateQuietPeriods (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_quietPeriods.clear ();
+  if (m_clusterRole == NOT_PARTICIPATING)
+    {
+      return;
+    }
+
+  /* The allocations are relative to the start of the DTI */
+  Time dtiOffset = Seconds (0);
+  if (m_btiPeriodicity == 0)
+    {
+      dtiOffset = m_btiDuration + m_mbifs;
+      if (m_nextAbft == 0)
+        {
+          dtiOffset += m_abftDuration + m_mbifs;
+        }
+    }
+  if (m_atiPresent)
+    {
+      dtiOffset += m_atiDuration;
+    }
+  Time spacing = GetBeaconSpSpacing ();
+  NS_ASSERT_MSG ((m_beaconSpDuration <= spacing) && (dtiOffset <= spacing),
+                 "The Beacon SPs of the cluster should not overlap.");
+  if (dtiOffset > m_beaconSpDuration)
+    {
+      NS_LOG_WARN ("The BHI of " << GetAddress () << " exceeds the Beacon SP duration of the cluster");
+    }
+
+  /* The Beacon SPs of the other members follow ours every BI/ClusterMaxMem */
+  for (uint8_t i = 1; i < m_clusterMaxMem; i++)
+    {
+      AllocationField field;
+      field.SetAllocationType (SERVICE_PERIOD_ALLOCATION);
+      field.SetAsPseudoStatic (false);
+      field.SetSourceAid (AID_BROADCAST);
+      field.SetDestinationAid (AID_BROADCAST);
+      field.SetAllocationStart ((spacing * int64_t (i) - dtiOffset).GetMicroSeconds ());
+      field.SetAllocationBlockDuration (m_beaconSpDuration.GetMicroSeconds ());
+      field.SetNumberOfBlocks (1);
+      m_quietPeriods.push_back (field);
+    }
+}
+
+/**
+ * PCP Handover
+ */
+bool
+DmgApWifiMac::IsPcp (void) const
+{
+  return (!m_followingPcp && !m_leftPbss);
+}
+
+bool
+DmgApWifiMac::InitiatePcpHandover (enum HandoverReason reason, uint8_t remainingBIs)
+{
+  NS_LOG_FUNCTION (this << reason << uint16_t (remainingBIs));
+  if (!IsPcp () || (m_newPcp != Mac48Address ()) || m_nextPcpList.empty ())
+    {
+      NS_LOG_INFO ("No PCP handover possible for " << GetAddress ());
+      return false;
+    }
+  /* Hand the PBSS over to the first DMG STA in the NextPCP List */
+  m_handoverCandidate = m_aidMap[m_nextPcpList.front ()];
+  m_requestedRemainingBIs = std::max<uint8_t> (remainingBIs, 1);
+  SendHandoverRequest (m_handoverCandidate, reason, m_requestedRemainingBIs);
+  return true;
+}
+
+void
+DmgApWifiMac::UpdateNextPcpList (void)
+{
+  NS_LOG_FUNCTION (this);
+  /* The NextPCP List holds the AIDs of the associated DMG STAs capable of becoming PCP, in association order */
+  NextPcpAidList nextPcpList;
+  for (std::map<uint16_t, WifiInformationElementMap>::const_iterator it = m_associatedStationsInfoByAid.begin ();
+       it != m_associatedStationsInfoByAid.end (); it++)
+    {
+      WifiInformationElementMap::const_iterator element = it->second.find (IE_DMG_CAPABILITIES);
+      if (element == it->second.end ())
+        {
+          continue;
+        }
+      Ptr<DmgCapabilities> capabilities = StaticCast<DmgCapabilities> (element->second);
+      if (capabilities->GetPcpHandover ())
+        {
+          nextPcpList.push_back (it->first);
+        }
+    }
+  if (nextPcpList != m_nextPcpList)
+    {
+      m_nextPcpList = nextPcpList;
+      m_nextPcpToken++;
+    }
+  if (m_nextPcpList.empty ())
+    {
+      return;
+    }
+
+  /* Keep the first DMG STA of the list synchronized with our association table and schedule */
+  Mac48Address nextPcp = m_aidMap[m_nextPcpList.front ()];
+  if ((nextPcp != m_synchronizedNextPcp) || (m_associatedStationsInfoByAid.size () != m_synchronizedStations))
+    {
+      SendPcpStateTransfer (nextPcp);
+    }
+}
+
+void
+DmgApWifiMac::SendPcpStateTransfer (Mac48Address to)
+{
+  NS_LOG_FUNCTION (this << to);
+  ExtInformationResponse responseHdr;
+  responseHdr.SetSubjectAddress (Mac48Address::GetBroadcast ());
+  responseHdr.SetRequestInformationElement (Create<RequestElement> ());
+  for (std::map<uint16_t, WifiInformationElementMap>::const_iterator it = m_associatedStationsInfoByAid.begin ();
+       it != m_associatedStationsInfoByAid.end (); it++)
+    {
+      WifiInformationElementMap::const_iterator element = it->second.find (IE_DMG_CAPABILITIES);
+      if (element != it->second.end ())
+        {
+          responseHdr.AddDmgCapabilitiesElement (StaticCast<DmgCapabilities> (element->second));
+        }
+    }
+  responseHdr.AddWifiInformationElement (GetExtendedScheduleElement ());
+
+  m_synchronizedNextPcp = to;
+  m_synchronizedStations = m_associatedStationsInfoByAid.size ();
+  SendInformationResponse (to, responseHdr);
+}
+
+void
+DmgApWifiMac::SendHandoverRequest (Mac48Address to, enum HandoverReason reason, uint8_t remainingBIs)
+{
+  NS_LOG_FUNCTION (this << to << reason << uint16_t (remainingBIs));
+  WifiMacHeader hdr;
+  hdr.SetAction ();
+  hdr.SetAddr1 (to);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (GetAddress ());
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  hdr.SetNoOrder ();
+
+  ExtHandoverRequestHeader requestHdr;
+  requestHdr.SetHandoverReason (reason);
+  requestHdr.SetHandoverRemainingBI (remainingBIs);
+
+  WifiActionHeader actionHdr;
+  WifiActionHeader::ActionValue action;
+  action.dmgAction = WifiActionHeader::DMG_HANDOVER_REQUEST;
+  actionHdr.SetAction (WifiActionHeader::DMG, action);
+
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (requestHdr);
+  packet->AddHeader (actionHdr);
+
+  m_dca->Queue (packet, hdr);
+}
+
+void
+DmgApWifiMac::SendHandoverResponse (Mac48Address to, bool accept)
+{
+  NS_LOG_FUNCTION (this << to << accept);
+  WifiMacHeader hdr;
+  hdr.SetAction ();
+  hdr.SetAddr1 (to);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (to);
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  hdr.SetNoOrder ();
+
+  /* A Handover Result of 0 accepts the handover */
+  ExtHandoverResponseHeader responseHdr;
+  responseHdr.SetHandoverResult (!accept);
+  if (!accept)
+    {
+      responseHdr.SetHandoverRejectReason (UnspecifiedReason);
+    }
+
+  WifiActionHeader actionHdr;
+  WifiActionHeader::ActionValue action;
+  action.dmgAction = WifiActionHeader::DMG_HANDOVER_RESPONSE;
+  actionHdr.SetAction (WifiActionHeader::DMG, action);
+
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (responseHdr);
+  packet->AddHeader (actionHdr);
+
+  m_dca->Queue (packet, hdr);
+}
+
+void
+DmgApWifiMac::LeavePbss (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_LOG_INFO ("PCP " << GetAddress () << " hands its PBSS over to " << m_newPcp << " at " << Simulator::Now ());
+  m_leftPbss = true;
+  m_accessPeriod = CHANNEL_ACCESS_BHI;
+  EndContentionPeriod ();
+  m_pcpHandover (GetAddress (), m_newPcp);
+  m_newPcp = Mac48Address ();
+}
+
+void
+DmgApWifiMac::StartStandbyPcp (void)
+{
+  NS_LOG_FUNCTION (this);
+  /* Act as a PCP capable DMG STA until the PCP hands its PBSS over or disappears */
+  m_followingPcp = true;
+  m_accessPeriod = CHANNEL_ACCESS_BHI;
+  m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
+  m_pcpLostEvent = Simulator::Schedule (m_beaconInterval * m_implicitHandoverLostBeacons,
+                                        &DmgApWifiMac::PcpLost, this);
+}
+
+void
+DmgApWifiMac::ReceivePcpBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr)
+{
+  NS_LOG_FUNCTION (this << hdr->GetAddr1 ());
+  if (!(beacon.GetSsid ().IsEqual (GetSsid ())))
+    {
+      return;
+    }
+  Mac48Address bssid = hdr->GetAddr1 ();
+  Ptr<PcpHandoverElement> handoverElement
+      = StaticCast<PcpHandoverElement> (beacon.GetInformationElement (IE_PCP_HANDOVER));
+
+  if (m_pcpAddress == Mac48Address ())
+    {
+      m_pcpAddress = bssid;
+      NS_LOG_INFO ("Standby PCP " << GetAddress () << " follows PCP " << m_pcpAddress);
+    }
+  else if (bssid != m_pcpAddress)
+    {
+      /* Only follow another PCP if it announces that it took over the PBSS of ours */
+      if ((handoverElement == 0) || (handoverElement->GetOldBssID () != m_pcpAddress)
+          || (handoverElement->GetNewPcpAddress () != bssid))
+        {
+          return;
+        }
+      NS_LOG_INFO ("Standby PCP " << GetAddress () << " follows the new PCP " << bssid);
+      m_pcpAddress = bssid;
+      m_standbyBeamformed = false;
+      m_standbyAid = 0;
+      m_nextPcp = false;
+      m_takeOverEvent.Cancel ();
+    }
+
+  /* Record the sectors of the PCP to feed back the best one in our sector sweep */
+  DMG_SSW_Field ssw = beacon.GetSSWField ();
+  MapTxSnr (bssid, ssw.GetSectorID (), ssw.GetDMGAntennaID (), m_stationManager->GetRxSnr ());
+
+  /* Process the BHI of the PCP only once per BI */
+  Time biStart = GetBeaconIntervalStart (beacon, hdr);
+  if ((m_pcpBiStart >= Seconds (0)) && (biStart - m_pcpBiStart < m_beaconInterval / 2))
+    {
+      return;
+    }
+  m_pcpBiStart = biStart;
+  m_beaconInterval = MicroSeconds (beacon.GetBeaconIntervalUs ());
+  m_pcpLostEvent.Cancel ();
+  m_pcpLostEvent = Simulator::Schedule (biStart + m_beaconInterval * m_implicitHandoverLostBeacons - Simulator::Now (),
+                                        &DmgApWifiMac::PcpLost, this);
+
+  /* We are the next PCP as long as we head the NextPCP List of the PCP */
+  Ptr<NextPcpListElement> nextPcpElement
+      = StaticCast<NextPcpListElement> (beacon.GetInformationElement (IE_NEXT_PCP_LIST));
+  if (nextPcpElement != 0)
+    {
+      NextPcpAidList list = nextPcpElement->GetListOfNextPcpAid ();
+      m_nextPcp = (m_standbyAid != 0) && !list.empty () && (list.front () == m_standbyAid);
+    }
+  else
+    {
+      m_nextPcp = false;
+    }
+
+  /* Explicit handover: take the PBSS over once the Remaining BIs elapsed */
+  if ((handoverElement != 0) && (handoverElement->GetOldBssID () == bssid)
+      && (handoverElement->GetNewPcpAddress () == GetAddress ()))
+    {
+      m_takeOverEvent.Cancel ();
+      Time takeOver = biStart + m_beaconInterval * handoverElement->GetRemainingBIs () - Simulator::Now ();
+      m_takeOverEvent = Simulator::Schedule (takeOver, &DmgApWifiMac::TakeOverPbss, this);
+      NS_LOG_INFO ("Standby PCP " << GetAddress () << " takes the PBSS over at " << Simulator::Now () + takeOver);
+    }
+
+  /* Follow the BHI of the PCP */
+  ExtDMGBeaconIntervalCtrlField ctrl = beacon.GetBeaconIntervalControlField ();
+  Ptr<DmgOperationElement> operationElement
+      = StaticCast<DmgOperationElement> (beacon.GetInformationElement (IE_DMG_OPERATION));
+  Ptr<NextDmgAti> atiElement = StaticCast<NextDmgAti> (beacon.GetInformationElement (IE_NEXT_DMG_ATI));
+  Time btiEnd = MicroSeconds (beacon.GetTimestamp ()) + hdr->GetDuration ();
+  Time abftDuration = NanoSeconds (ctrl.GetABFT_Length () * (1 + ctrl.GetABFT_Multiplier ())
+                                   * m_low->GetSectorSweepSlotTime (ctrl.GetFSS ()));
+  abftDuration = MicroSeconds (ceil ((double) abftDuration.GetNanoSeconds () / 1000));
+  Time dtiStart = btiEnd + GetMbifs ();
+  if (ctrl.GetNextABFT () == 0)
+    {
+      if (!m_standbyBeamformed)
+        {
+          /* Train our link with the PCP in a random SSW slot of the primary A-BFT */
+          uint32_t slot = m_standbySlotVariable->GetInteger (0, ctrl.GetABFT_Length () - 1);
+          Time sweepStart = btiEnd + GetMbifs () + slot * m_low->GetSectorSweepSlotTime (ctrl.GetFSS ());
+          Simulator::Schedule (sweepStart - Simulator::Now (), &DmgApWifiMac::StartStandbySectorSweep, this, ctrl.GetFSS ());
+        }
+      dtiStart += abftDuration + GetMbifs ();
+    }
+  if (atiElement != 0)
+    {
+      dtiStart += MicroSeconds (atiElement->GetAtiDuration ());
+    }
+  Time biEnd = biStart + m_beaconInterval;
+
+  /* Contend in the CBAPs of the PCP we are allowed to use */
+  ExtDMGParameters parameters = beacon.GetDMGParameters ();
+  if (parameters.Get_CBAP_Only ())
+    {
+      Simulator::Schedule (dtiStart - Simulator::Now (), &DmgApWifiMac::StartStandbyContention, this,
+                           BROADCAST_CBAP, biEnd - dtiStart);
+      Simulator::Schedule (biEnd - Simulator::Now (), &DmgApWifiMac::EndContentionPeriod, this);
+    }
+  else
+    {
+      Ptr<ExtendedScheduleElement> scheduleElement
+          = StaticCast<ExtendedScheduleElement> (beacon.GetInformationElement (IE_EXTENDED_SCHEDULE));
+      AllocationFieldList allocationList;
+      if (scheduleElement != 0)
+        {
+          allocationList = scheduleElement->GetAllocationFieldList ();
+        }
+      for (AllocationFieldList::iterator iter = allocationList.begin (); iter != allocationList.end (); iter++)
+        {
+          if ((iter->GetAllocationType () == CBAP_ALLOCATION)
+              && ((iter->GetSourceAid () == AID_BROADCAST)
+                  || ((m_standbyAid != 0) && ((iter->GetSourceAid () == m_standbyAid)
+                                              || (iter->GetDestinationAid () == m_standbyAid)))))
+            {
+              Time cbapStart = dtiStart + MicroSeconds (iter->GetAllocationStart ());
+              Time cbapDuration = MicroSeconds (iter->GetAllocationBlockDuration ());
+              Simulator::Schedule (cbapStart - Simulator::Now (), &DmgApWifiMac::StartStandbyContention, this,
+                                   iter->GetAllocationID (), cbapDuration);
+              Simulator::Schedule (cbapStart + cbapDuration - Simulator::Now (), &DmgApWifiMac::EndContentionPeriod, this);
+            }
+        }
+    }
+
+  /* Associate once our link with the PCP is trained */
+  if (m_standbyBeamformed && (m_standbyAid == 0) && !m_standbyAssocPending)
+    {
+      Simulator::Schedule (dtiStart - Simulator::Now (), &DmgApWifiMac::SendStandbyAssociationRequest, this);
+    }
+}
+
+void
+DmgApWifiMac::StartStandbySectorSweep (uint8_t ssFramesPerSlot)
+{
+  NS_LOG_FUNCTION (this << uint16_t (ssFramesPerSlot));
+  if (!m_followingPcp || m_standbyBeamformed)
+    {
+      return;
+    }
+  m_accessPeriod = CHANNEL_ACCESS_ABFT;
+  m_sendingStandbySweep = true;
+  m_totalSectors = std::min<uint16_t> (m_antennaConfigurationTable.size (), ssFramesPerSlot) - 1;
+  m_antennaConfigurationIndex = 0;
+  ANTENNA_CONFIGURATION config = m_antennaConfigurationTable[m_antennaConfigurationIndex];
+  SendStandbySectorSweepFrame (config.first, config.second, m_totalSectors);
+}
+
+void
+DmgApWifiMac::SendStandbySectorSweepFrame (uint8_t sectorID, uint8_t antennaID, uint16_t count)
+{
+  NS_LOG_FUNCTION (this << uint16_t (sectorID) << uint16_t (antennaID) << count);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_CTL_DMG_SSW);
+  hdr.SetAddr1 (m_pcpAddress);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetDuration (Seconds (0));
+  hdr.SetNoMoreFragments ();
+  hdr.SetNoRetry ();
+
+  DMG_SSW_Field ssw;
+  ssw.SetDirection (BeamformingResponder);
+  ssw.SetCountDown (count);
+  ssw.SetSectorID (sectorID);
+  ssw.SetDMGAntennaID (antennaID);
+
+  /* Feed back the best sector of the PCP measured on its DMG Beacons */
+  ANTENNA_CONFIGURATION bestConfig = GetBestAntennaConfiguration (m_pcpAddress, true);
+  DMG_SSW_FBCK_Field sswFeedback;
+  sswFeedback.IsPartOfISS (false);
+  sswFeedback.SetSector (bestConfig.first);
+  sswFeedback.SetDMGAntenna (bestConfig.second);
+  sswFeedback.SetPollRequired (false);
+
+  CtrlDMG_SSW sswFrame;
+  sswFrame.SetSswField (ssw);
+  sswFrame.SetSswFeedbackField (sswFeedback);
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (sswFrame);
+
+  /* Set Antenna Direction */
+  m_phy->GetDirectionalAntenna ()->SetCurrentTxSectorID (sectorID);
+  m_phy->GetDirectionalAntenna ()->SetCurrentTxAntennaID (antennaID);
+
+  /* Send Control Frames directly without DCA + DCF Manager */
+  MacLowTransmissionParameters params;
+  params.EnableOverrideDurationId (hdr.GetDuration ());
+  params.DisableRts ();
+  params.DisableAck ();
+  params.DisableNextData ();
+  m_low->StartTransmission (packet,
+                            &hdr,
+                            params,
+                            MakeCallback (&DmgApWifiMac::FrameTxOk, this));
+}
+
+void
+DmgApWifiMac::StartStandbyContention (AllocationID allocationID, Time contentionDuration)
+{
+  NS_LOG_FUNCTION (this << uint16_t (allocationID) << contentionDuration);
+  if (!m_followingPcp)
+    {
+      return;
+    }
+  m_accessPeriod = CHANNEL_ACCESS_DTI;
+  StartContentionPeriod (allocationID, contentionDuration);
+}
+
+void
+DmgApWifiMac::SendStandbyAssociationRequest (void)
+{
+  NS_LOG_FUNCTION (this << m_pcpAddress);
+  if (!m_followingPcp || (m_standbyAid != 0) || m_standbyAssocPending)
+    {
+      return;
+    }
+  WifiMacHeader hdr;
+  hdr.SetAssocReq ();
+  hdr.SetAddr1 (m_pcpAddress);
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (m_pcpAddress);
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  hdr.SetNoOrder ();
+
+  Ptr<Packet> packet = Create<Packet> ();
+  MgtAssocRequestHeader assoc;
+  assoc.SetSsid (GetSsid ());
+  assoc.AddWifiInformationElement (GetDmgCapabilities ());
+  assoc.AddWifiInformationElement (GetMultiBandElement ());
+  assoc.AddWifiInformationElement (GetRelayCapabilitiesElement ());
+  packet->AddHeader (assoc);
+
+  m_standbyAssocPending = true;
+  m_dca->Queue (packet, hdr);
+}
+
+void
+DmgApWifiMac::PcpLost (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_pcpAddress == Mac48Address ())
+    {
+      NS_LOG_INFO ("No PCP found by " << GetAddress () << ", start our own PBSS");
+      m_followingPcp = false;
+      StartBeaconInterval ();
+    }
+  else if (m_nextPcp && m_pcpHandoverSupport)
+    {
+      /* Implicit handover: the next PCP takes the PBSS over at the next BI boundary of the lost PCP */
+      NS_LOG_INFO ("PCP " << m_pcpAddress << " lost, " << GetAddress () << " takes its PBSS over");
+      Time elapsed = Simulator::Now () - m_pcpBiStart;
+      Time nextBi = m_beaconInterval - NanoSeconds (elapsed.GetNanoSeconds () % m_beaconInterval.GetNanoSeconds ());
+      m_takeOverEvent.Cancel ();
+      m_takeOverEvent = Simulator::Schedule (nextBi, &DmgApWifiMac::TakeOverPbss, this);
+    }
+  else
+    {
+      /* Without handover, the DMG STAs have to discover and associate with a new PBSS */
+      NS_LOG_INFO ("PCP " << m_pcpAddress << " lost, " << GetAddress () << " starts a new PBSS");
+      m_followingPcp = false;
+      EndContentionPeriod ();
+      StartBeaconInterval ();
+    }
+}
+
+void
+DmgApWifiMac::TakeOverPbss (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_followingPcp = false;
+  m_pcpLostEvent.Cancel ();
+  EndContentionPeriod ();
+
+  /* Inherit the association table of the old PCP, the DMG STAs keep their AIDs */
+  for (std::map<uint16_t, WifiInformationElementMap>::iterator it = m_pcpStationsInfo.begin ();
+       it != m_pcpStationsInfo.end (); it++)
+    {
+      Ptr<DmgCapabilities> capabilities = StaticCast<DmgCapabilities> (it->second[IE_DMG_CAPABILITIES]);
+      Mac48Address address = capabilities->GetStaAddress ();
+      if (address == GetAddress ())
+        {
+          continue;
+        }
+      m_associatedStationsInfoByAddress[address] = it->second;
+      m_associatedStationsInfoByAid[it->first] = it->second;
+      MapAidToMacAddress (it->first, address);
+      m_stationManager->RecordWaitAssocTxOk (address);
+      m_stationManager->RecordGotAssocTxOk (address);
+      m_aidCounter = std::max<uint16_t> (m_aidCounter, it->first);
+    }
+  m_pcpStationsInfo.clear ();
+
+  /* Inherit the schedule of the old PCP, its allocations now belong to us */
+  m_allocationList.clear ();
+  for (AllocationFieldList::iterator iter = m_pcpAllocationList.begin (); iter != m_pcpAllocationList.end (); iter++)
+    {
+      AllocationField field = *iter;
+      if ((field.GetSourceAid () == AID_AP) || (field.GetDestinationAid () == AID_AP))
+        {
+          continue;
+        }
+      if (field.GetSourceAid () == m_standbyAid)
+        {
+          field.SetSourceAid (AID_AP);
+        }
+      if (field.GetDestinationAid () == m_standbyAid)
+        {
+          field.SetDestinationAid (AID_AP);
+        }
+      m_allocationList.push_back (field);
+    }
+  m_pcpAllocationList.clear ();
+
+  /* Announce in our DMG Beacons that we took over the PBSS of the old PCP */
+  m_oldBssid = m_pcpAddress;
+  m_handoverAnnouncements = dot11PcpHandoverAnnouncements;
+  NS_LOG_INFO ("DMG STA " << GetAddress () << " took the PBSS of " << m_oldBssid << " over at " << Simulator::Now ());
+  m_pcpHandover (m_oldBssid, GetAddress ());
+  StartBeaconInterval ();
+}
+
 void 
 DmgApWifiMac::DoInitialize (void)
 {
@@ -1295,9 +2998,18 @@ DmgApWifiMac::DoInitialize (void)
   m_beaconDca->Initialize ();
   m_beaconEvent.Cancel ();
 
-  /* Calculate A-BFT Duration (Constant during the entire simulation) */
-  m_abftDuration = NanoSeconds (m_ssSlotsPerABFT * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot));
+  /* Calculate A-BFT Duration including the secondary A-BFTs (Constant during the entire simulation) */
+  m_abftDuration = NanoSeconds (m_ssSlotsPerABFT * (1 + m_abftMultiplier) * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot));
   m_abftDuration = MicroSeconds (ceil ((double) m_abftDuration.GetNanoSeconds () / 1000));
+  /* The attributes are not set yet when the constructor runs */
+  m_nextAbft = m_abftPeriodicity;
+
+  /* Create the beacon interval clock of the BSS */
+  if (m_shareBiClock)
+    {
+      m_biClock = CreateObject<DmgBeaconIntervalClock> ();
+      m_biClock->SetBssid (GetAddress ());
+    }
 
   /* Generate Antenna Configuration Table */
   m_antennaConfigurationOffset = 0;
@@ -1309,9 +3021,24 @@ DmgApWifiMac::DoInitialize (void)
         }
     }
 
-  /* Start Beacon Interval */
+  /* Start Beacon Interval, unless we first look for the Beacon SPs of a cluster to join */
   NS_LOG_DEBUG ("Starting DMG Access Point " << GetAddress () << " at time " << Simulator::Now ());
-  StartBeaconInterval ();
+  if (m_standbyPcp)
+    {
+      StartStandbyPcp ();
+    }
+  else if (m_clusteringMode == NO_CLUSTERING)
+    {
+      StartBeaconInterval ();
+    }
+  else if (m_synchronizationAp)
+    {
+      FormCluster ();
+    }
+  else
+    {
+      StartClusterMonitoring ();
+    }
 
   DmgWifiMac::DoInitialize ();
 }
@@ -7,9 +7,12 @@
 #define DMG_AP_WIFI_MAC_H
 
 #include "ns3/random-variable-stream.h"
+#include <set>
 
 #include "amsdu-subframe-header.h"
+#include "ctrl-headers.h"
 #include "dmg-beacon-dca.h"
+#include "dmg-beacon-interval-clock.h"
 #include "dmg-wifi-mac.h"
 
 namespace ns3 {
@@ -20,6 +23,29 @@ namespace ns3 {
 #define aMinSSSlotsPerABFT      1               /* Minimum Number of Sector Sweep Slots Per A-BFT */
 #define aSSFramesPerSlot        8               /* Number of SSW Frames per Sector Sweep Slot */
 #define aDMGPPMinListeningTime  150             /* The minimum time between two adjacent SPs with the same source or destination AIDs*/
+#define aMaxAllocationBlockDuration 32767      /* Maximum duration of an allocation block in microseconds */
+#define MAX_ALLOCATION_ID       15              /* Largest value of the 4-bit Allocation ID subfield */
+#define dot11MaxClusterRequests 3               /* Number of BIs during which a PCP/AP retries to join a centralized cluster */
+#define dot11PcpHandoverAnnouncements 10       /* Number of BIs during which a new PCP announces that it took over a PBSS */
+
+/**
+ * The clustering mode of a DMG PCP/AP, see 802.11ad 10.37 (PCP/AP clustering).
+ */
+enum ClusteringMode
+{
+  NO_CLUSTERING = 0,
+  DECENTRALIZED_CLUSTERING = 1,
+  CENTRALIZED_CLUSTERING = 2
+};
+
+/**
+ * The order in which a DMG PCP/AP polls its associated DMG STAs during the ATI.
+ */
+enum AtiPollingPolicy
+{
+  ATI_POLL_ROUND_ROBIN = 0,     //!< Start each ATI with the DMG STA following the first one polled in the previous ATI.
+  ATI_POLL_PRIORITY = 1         //!< Poll the DMG STAs with the largest buffered traffic reported so far first.
+};
 
 /**
  * \brief Wi-Fi DMG AP state machine
@@ -119,6 +145,30 @@ public:
    */
   uint32_t AllocateBeamformingServicePeriod (uint8_t sourceAid, uint8_t destAid,
                                              uint32_t allocationStart, bool isTxss);
+  /**
+   * \return The beacon interval clock shared with the associated DMG STAs or 0 if disabled.
+   */
+  Ptr<DmgBeaconIntervalClock> GetBeaconIntervalClock (void) const;
+  /**
+   * \return The role of this PCP/AP in its cluster.
+   */
+  enum ClusterMemberRole GetClusterMemberRole (void) const;
+  /**
+   * \return The index of the Beacon SP of this PCP/AP in its cluster (1 for the S-AP) or 0 if not clustered.
+   */
+  uint8_t GetBeaconSpIndex (void) const;
+  /**
+   * Hand our PBSS over to the first DMG STA of the next PCP list (explicit PCP handover). The DMG STA
+   * receives our association table and allocation schedule and takes over after remainingBIs BIs.
+   * \param reason The reason of the handover announced in the Handover Request.
+   * \param remainingBIs The number of BIs, following the current one, before the new PCP takes over.
+   * \return False if none of the associated DMG STAs supports PCP handover.
+   */
+  bool InitiatePcpHandover (enum HandoverReason reason, uint8_t remainingBIs);
+  /**
+   * \return True if we operate the BIs of a PBSS, false as a standby PCP or after handing our PBSS over.
+   */
+  bool IsPcp (void) const;
 
 protected:
   friend class DmgBeaconDca;
@@ -131,6 +181,10 @@ private:
 
   void StartBeaconInterval (void);
   void StartBeaconTransmissionInterval (void);
+  /**
+   * Spend the BTI of this BI listening for DMG Beacons of cluster members sharing our Beacon SP.
+   */
+  void ListenBeaconTransmissionInterval (void);
   void StartAssociationBeamformTraining (void);
   void StartAnnouncementTransmissionInterval (void);
   void StartDataTransmissionInterval (void);
@@ -175,6 +229,10 @@ private:
    * Start A-BFT Sector Sweep Slot.
    */
   void StartSectorSweepSlot (void);
+  /**
+   * End the current A-BFT Sector Sweep Slot and report its occupancy.
+   */
+  void EndSectorSweepSlot (void);
   /**
    * Establish BRP Setup Subphase
    */
@@ -217,6 +275,33 @@ private:
    * \param to The MAC address of the DMG STA.
    */
   void SendAnnounceFrame (Mac48Address to);
+  /**
+   * Build the list of the associated DMG STAs to poll one after the other during the ATI for their SP requests.
+   */
+  void StartAtiPolling (void);
+  /**
+   * Poll the next DMG STA of this ATI, if the remaining ATI still fits a Poll/SPR exchange.
+   */
+  void PollNextStation (void);
+  /**
+   * Send a Poll frame during the ATI.
+   * \param to The MAC address of the DMG STA.
+   */
+  void SendPollFrame (Mac48Address to);
+  /**
+   * The polled DMG STA did not answer within AtiPollTimeout.
+   */
+  void PollTimeout (void);
+  /**
+   * Record the SP request of the polled DMG STA.
+   * \param from The MAC address of the DMG STA.
+   * \param spr The SPR frame of the DMG STA.
+   */
+  void ReceiveSprFrame (Mac48Address from, const CtrlDMG_SPR &spr);
+  /**
+   * Report the ATI utilization and turn the SP requests collected during the ATI into SPs of the next BI.
+   */
+  void EndAtiPolling (void);
   /**
    * Return the DMG capability of the current AP.
    * \return the DMG capability that we support
@@ -248,6 +333,156 @@ private:
    * \param count Number of remaining DMG Beacons till the end of BTI.
    */
   void SendOneDMGBeacon (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Get the Clustering Control field announced in our DMG Beacons.
+   * \return The Clustering Control field.
+   */
+  ExtDMGClusteringControlField GetClusteringControlField (void) const;
+  /**
+   * Listen to the channel for ClusterMonitorDuration before starting the first BI, in order to
+   * find the Beacon SPs of the cluster we are about to join.
+   */
+  void StartClusterMonitoring (void);
+  /**
+   * Select a Beacon SP of the monitored cluster or form a new cluster if we did not find any.
+   */
+  void EndClusterMonitoring (void);
+  /**
+   * Record the Beacon SP occupied by the sender of a DMG Beacon received during cluster monitoring.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ReceiveClusterBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * Move to another empty Beacon SP if a member of our decentralized cluster sends its DMG Beacons in ours.
+   * Of the two colliding PCP/APs, the one with the higher MAC address moves.
+   * \param beacon The DMG Beacon received during our BTI.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ResolveBeaconSpCollision (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * \return The index of a randomly selected Beacon SP without DMG Beacons, or 0 if all of them are occupied.
+   */
+  uint8_t SelectEmptyBeaconSp (void);
+  /**
+   * Start our BIs in the Beacon SP of the cluster with the given index.
+   * \param beaconSpIndex The index of the Beacon SP (1 for the S-AP).
+   */
+  void JoinCluster (uint8_t beaconSpIndex);
+  /**
+   * Operate as the S-AP of a new cluster.
+   */
+  void FormCluster (void);
+  /**
+   * \param beaconSpIndex The index of a Beacon SP in the cluster.
+   * \return The earliest start time of the Beacon SP strictly after now.
+   */
+  Time GetNextBeaconSpStart (uint8_t beaconSpIndex) const;
+  /**
+   * \return The time between the start of two consecutive Beacon SPs of the cluster.
+   */
+  Time GetBeaconSpSpacing (void) const;
+  /**
+   * Recompute the quiet periods of the DTI protecting the Beacon SPs of the other cluster members.
+   * Called at the start of each BI, before the DMG Beacons announcing them are sent.
+   */
+  void UpdateQuietPeriods (void);
+  /**
+   * Start a Cluster Request sweep toward the S-AP of a centralized cluster.
+   */
+  void StartClusterRequestSweep (void);
+  /**
+   * Send one Cluster Request frame of the sweep toward the S-AP.
+   * \param sectorID The ID of the current sector.
+   * \param antennaID The ID of the current antenna.
+   * \param count Number of remaining Cluster Request frames till the end of the sweep.
+   */
+  void SendClusterRequest (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Send a Cluster Response assigning a Beacon SP to the requesting PCP/AP.
+   * \param to The MAC address of the requesting PCP/AP.
+   * \param bestSectorId The best sector to reach the requesting PCP/AP as fed back in its Cluster Request.
+   * \param bestAntennaId The best antenna to reach the requesting PCP/AP as fed back in its Cluster Request.
+   */
+  void SendClusterResponse (Mac48Address to, uint8_t bestSectorId, uint8_t bestAntennaId);
+  /**
+   * Derive the start of the BI of another PCP/AP from one of its DMG Beacons, the same way the DMG STAs do.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   * \return The start time of the BI in which the DMG Beacon was sent.
+   */
+  Time GetBeaconIntervalStart (ExtDMGBeacon &beacon, const WifiMacHeader *hdr) const;
+  /**
+   * Recompute the next PCP list from the DMG Capabilities of the associated DMG STAs, and send a copy of
+   * our association table and allocation schedule to the first next PCP whenever it changes.
+   * Called at the start of each BI.
+   */
+  void UpdateNextPcpList (void);
+  /**
+   * Send an Information Response carrying the DMG Capabilities of all the associated DMG STAs and our
+   * allocation schedule to the DMG STA that takes over our PBSS.
+   * \param to The MAC address of the next PCP.
+   */
+  void SendPcpStateTransfer (Mac48Address to);
+  /**
+   * Send a Handover Request frame to a DMG STA of the next PCP list.
+   * \param to The MAC address of the candidate PCP.
+   * \param reason The reason of the handover.
+   * \param remainingBIs The number of BIs before the handover takes effect.
+   */
+  void SendHandoverRequest (Mac48Address to, enum HandoverReason reason, uint8_t remainingBIs);
+  /**
+   * Send a Handover Response frame to the PCP.
+   * \param to The MAC address of the PCP.
+   * \param accept Whether we accept to take over the PBSS.
+   */
+  void SendHandoverResponse (Mac48Address to, bool accept);
+  /**
+   * Stop our BIs once the new PCP has taken over our PBSS.
+   */
+  void LeavePbss (void);
+  /**
+   * Listen to the DMG Beacons of the PCP of our SSID instead of starting our own PBSS.
+   */
+  void StartStandbyPcp (void);
+  /**
+   * Follow the BIs of the PCP from one of its DMG Beacons: train our link with the PCP in the A-BFT,
+   * contend in its DTI and watch for the loss of the PCP or for a handover to us.
+   * \param beacon The received DMG Beacon.
+   * \param hdr The MAC header of the DMG Beacon.
+   */
+  void ReceivePcpBeacon (ExtDMGBeacon &beacon, const WifiMacHeader *hdr);
+  /**
+   * Start our responder sector sweep toward the PCP in an SSW slot of its A-BFT.
+   * \param ssFramesPerSlot The number of SSW frames per SSW slot announced by the PCP.
+   */
+  void StartStandbySectorSweep (uint8_t ssFramesPerSlot);
+  /**
+   * Send one SSW frame of our responder sector sweep toward the PCP.
+   * \param sectorID The ID of the current sector.
+   * \param antennaID The ID of the current antenna.
+   * \param count Number of remaining SSW frames till the end of the sweep.
+   */
+  void SendStandbySectorSweepFrame (uint8_t sectorID, uint8_t antennaID, uint16_t count);
+  /**
+   * Contend for the channel in a CBAP of the DTI of the PCP.
+   * \param allocationID The ID of the CBAP.
+   * \param contentionDuration The duration of the CBAP.
+   */
+  void StartStandbyContention (AllocationID allocationID, Time contentionDuration);
+  /**
+   * Associate with the PCP as a PCP-capable DMG STA.
+   */
+  void SendStandbyAssociationRequest (void);
+  /**
+   * We did not receive any DMG Beacon from the PCP for ImplicitHandoverLostBeacons BIs.
+   */
+  void PcpLost (void);
+  /**
+   * Take over the PBSS of the PCP we followed: install the association table and the allocation schedule
+   * transferred by the PCP and start our BIs on its BI grid.
+   */
+  void TakeOverPbss (void);
 
   /** BTI Period Variables **/
   Ptr<DmgBeaconDca> m_beaconDca;        //!< Dedicated DcaTxop for beacons.
@@ -266,9 +501,85 @@ private:
   /* Ensure only one DMG STA is communicating with us during single A-BFT slot */
   bool m_receivedOneSSW;                //!< Flag to indicate if we received SSW Frame during SSW-Slot in A-BFT.
   Mac48Address m_peerAbftStation;       //!< The MAC address of the station we received SSW from.
-  uint8_t m_remainingSlots;
+  uint8_t m_remainingSlots;             //!< The number of SSW slots remaining in the current A-BFT.
+  uint8_t m_abftMultiplier;             //!< The number of secondary A-BFTs appended to the primary A-BFT (802.11ay).
+  uint8_t m_currentSlotIndex;           //!< The index of the current SSW slot within the A-BFT.
+  std::set<Mac48Address> m_slotResponders; //!< The DMG STAs from which we received SSW frames in the current slot.
   Time m_atiStartTime;                  //!< The start time of ATI Period.
 
+  /** PCP/AP Clustering Variables **/
+  enum ClusteringMode m_clusteringMode;  //!< The clustering mode of the PCP/AP.
+  bool m_synchronizationAp;             //!< Flag to indicate whether we start a cluster as its S-AP.
+  uint8_t m_clusterMaxMem;              //!< The maximum number of Beacon SPs in the cluster.
+  Time m_beaconSpDuration;              //!< The duration of each Beacon SP of the cluster.
+  Time m_clusterMonitorDuration;        //!< The time we monitor the channel for a cluster before starting our BIs.
+  Ptr<UniformRandomVariable> m_clusterMonitorJitter;  //!< Random number of BIs added to the cluster monitoring.
+  enum ClusterMemberRole m_clusterRole; //!< Our role in the cluster.
+  Mac48Address m_clusterId;             //!< The ID of our cluster (the MAC address of the S-AP).
+  uint8_t m_beaconSpIndex;              //!< The index of our Beacon SP in the cluster.
+  uint8_t m_clusterProbeBIs;            //!< The number of BIs left in which we may listen for a Beacon SP collision.
+  bool m_monitoringCluster;             //!< Flag to indicate whether we are monitoring the channel for a cluster.
+  bool m_syncApFound;                   //!< Flag to indicate whether we received a DMG Beacon from the S-AP.
+  Time m_clusterTimeReference;          //!< The start of a BI of the S-AP, the reference of the Beacon SPs.
+  std::map<Mac48Address, Time> m_monitoredBeaconSps; //!< The BI start of each PCP/AP heard during cluster monitoring.
+  std::map<Mac48Address, uint8_t> m_clusterMembers;  //!< The Beacon SP assigned by the S-AP to each cluster member.
+  std::map<Mac48Address, EventId> m_clusterResponseEvents; //!< Events to respond to Cluster Request sweeps.
+  EventId m_clusterEvent;               //!< Event ending the cluster monitoring or retrying a Cluster Request.
+  uint8_t m_clusterRequests;            //!< The number of Cluster Request sweeps sent so far.
+  bool m_sendingClusterRequests;        //!< Flag to indicate whether we are sweeping Cluster Request frames.
+
+  /** PCP Handover Variables **/
+  bool m_standbyPcp;                    //!< Flag to indicate whether we start as a standby PCP in the PBSS of another PCP.
+  uint32_t m_implicitHandoverLostBeacons; //!< The number of BIs without DMG Beacon after which the next PCP takes over.
+  bool m_followingPcp;                  //!< Flag to indicate whether we currently follow the BIs of another PCP.
+  Mac48Address m_pcpAddress;            //!< The MAC address of the PCP we follow.
+  uint16_t m_standbyAid;                //!< Our AID in the PBSS of the PCP, 0 before association.
+  bool m_standbyBeamformed;             //!< Flag to indicate whether we trained our link with the PCP in its A-BFT.
+  bool m_standbyAssocPending;           //!< Flag to indicate whether our Association Request is in flight.
+  bool m_sendingStandbySweep;           //!< Flag to indicate whether we are sweeping SSW frames toward the PCP.
+  bool m_nextPcp;                       //!< Flag to indicate whether we head the next PCP list of the PCP.
+  Time m_pcpBiStart;                    //!< The start of the last BI of the PCP we heard.
+  AllocationFieldList m_pcpAllocationList; //!< The allocation schedule of the PCP.
+  std::map<uint16_t, WifiInformationElementMap> m_pcpStationsInfo; //!< The association table transferred by the PCP.
+  Ptr<UniformRandomVariable> m_standbySlotVariable; //!< Random A-BFT slot of our sector sweep toward the PCP.
+  EventId m_pcpLostEvent;               //!< Event detecting the loss of the PCP.
+  EventId m_takeOverEvent;              //!< Event taking over the PBSS of the PCP.
+  NextPcpAidList m_nextPcpList;         //!< The AIDs of the DMG STAs supporting PCP handover, in association order.
+  uint8_t m_nextPcpToken;               //!< The token of the next PCP list, incremented at each update.
+  Mac48Address m_synchronizedNextPcp;   //!< The next PCP holding a copy of our association table.
+  size_t m_synchronizedStations;        //!< The number of DMG STAs in the copy held by the next PCP.
+  Mac48Address m_handoverCandidate;     //!< The DMG STA we sent a Handover Request to.
+  uint8_t m_requestedRemainingBIs;      //!< The number of remaining BIs of our Handover Request.
+  Mac48Address m_newPcp;                //!< The new PCP of the explicit handover in progress.
+  uint8_t m_handoverRemainingBIs;       //!< The number of BIs, including the current one, before the new PCP takes over.
+  bool m_leftPbss;                      //!< Flag to indicate whether we handed our PBSS over.
+  Mac48Address m_oldBssid;              //!< The BSSID of the PBSS we took over.
+  uint8_t m_handoverAnnouncements;      //!< The number of BIs during which we still announce the takeover.
+
+  /** ATI Polling Variables **/
+  bool m_atiPolling;                    //!< Flag to indicate whether we poll the DMG STAs during the ATI.
+  enum AtiPollingPolicy m_atiPollingPolicy; //!< The order in which we poll the DMG STAs.
+  Time m_atiPollTimeout;                //!< The time we wait for the SPR of a polled DMG STA.
+  bool m_atiAllocation;                 //!< Flag to indicate whether we allocate SPs for the collected SP requests.
+  std::vector<Mac48Address> m_atiPollList; //!< The DMG STAs left to poll in the current ATI.
+  uint32_t m_atiPollOffset;             //!< The round robin position of the first DMG STA polled in the next ATI.
+  Mac48Address m_polledStation;         //!< The DMG STA we are waiting an SPR from.
+  Time m_pollStartTime;                 //!< The start of the current Poll/SPR exchange.
+  EventId m_pollTimeoutEvent;           //!< Event ending the current Poll/SPR exchange without SPR.
+  Time m_atiBusyTime;                   //!< The time spent in Poll/SPR exchanges during the current ATI.
+  uint32_t m_atiPolls;                  //!< The number of DMG STAs polled during the current ATI.
+  std::map<Mac48Address, Dynamic_Allocation_Info_Field> m_sprRequests; //!< The SP requests of the current ATI.
+  std::map<Mac48Address, uint16_t> m_bufferedTraffic; //!< The latest SP duration requested by each DMG STA.
+  AllocationFieldList m_pendingAtiAllocations; //!< The SPs granted in the last ATI, announced in the next BTI.
+  AllocationFieldList m_atiAllocations; //!< The SPs granted by ATI polling for the current BI.
+
+  /** Power Management Variables **/
+  Time m_awakeWindow;                   //!< The awake window announced to the DMG STAs in power save mode.
+
+  /** Beacon Interval Clock Variables **/
+  bool m_shareBiClock;                  //!< Flag to indicate whether we drive the DMG STAs from a shared BI clock.
+  Ptr<DmgBeaconIntervalClock> m_biClock; //!< The beacon interval clock shared with the associated DMG STAs.
+
   /** BRP Phase Variables **/
   typedef std::map<Mac48Address, bool> STATION_BRP_MAP;
   STATION_BRP_MAP m_stationBrpMap;      //!< Map to indicate if a station has conducted BRP Phase or not.
@@ -288,9 +599,55 @@ private:
    * \param duration The duration of the DTI period.
    */
   typedef void (* DtiStartedCallback)(Mac48Address address, Time duration);
+  /**
+   * TracedCallback signature for the end of an A-BFT SSW slot.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param slotIndex The index of the SSW slot within the A-BFT.
+   * \param responders The number of distinct DMG STAs heard during the slot (more than one means a collision).
+   * \param served The MAC address of the DMG STA that is trained in this slot, if any.
+   */
+  typedef void (* AbftSlotCompletedCallback)(Mac48Address address, uint8_t slotIndex, uint32_t responders, Mac48Address served);
+  /**
+   * TracedCallback signature for joining a PCP/AP cluster.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param clusterId The ID of the cluster (the MAC address of the S-AP).
+   * \param beaconSpIndex The index of the Beacon SP assigned to the DMG AP (1 for the S-AP).
+   */
+  typedef void (* ClusterJoinedCallback)(Mac48Address address, Mac48Address clusterId, uint8_t beaconSpIndex);
+  /**
+   * TracedCallback signature for a PCP handover.
+   *
+   * \param oldBssid The BSSID of the PBSS, i.e. the MAC address of the old PCP.
+   * \param newPcp The MAC address of the new PCP.
+   */
+  typedef void (* PcpHandoverCallback)(Mac48Address oldBssid, Mac48Address newPcp);
+  /**
+   * TracedCallback signature for the SPR of a DMG STA polled during the ATI.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param station The MAC address of the DMG STA.
+   * \param duration The SP duration requested by the DMG STA.
+   */
+  typedef void (* ServicePeriodRequestedCallback)(Mac48Address address, Mac48Address station, Time duration);
+  /**
+   * TracedCallback signature for the end of an ATI with polling.
+   *
+   * \param address The MAC address of the DMG AP.
+   * \param polls The number of DMG STAs polled during the ATI.
+   * \param responses The number of SPR frames received during the ATI.
+   * \param utilization The fraction of the ATI spent in Poll/SPR exchanges.
+   */
+  typedef void (* AtiCompletedCallback)(Mac48Address address, uint32_t polls, uint32_t responses, double utilization);
 
   TracedCallback<Mac48Address> m_biStarted;         //!< New BI Started has started.
   TracedCallback<Mac48Address, Time> m_dtiStarted;  //!< DTI Started has started.
+  TracedCallback<Mac48Address, uint8_t, uint32_t, Mac48Address> m_abftSlotCompleted;  //!< A-BFT SSW slot completed.
+  TracedCallback<Mac48Address, Mac48Address, uint8_t> m_clusterJoined;  //!< Joined or formed a PCP/AP cluster.
+  TracedCallback<Mac48Address, Mac48Address> m_pcpHandover;  //!< Handed our PBSS over or took over a PBSS.
+  TracedCallback<Mac48Address, Mac48Address, Time> m_servicePeriodRequested;  //!< SPR received during the ATI.
+  TracedCallback<Mac48Address, uint32_t, uint32_t, double> m_atiCompleted;  //!< ATI with polling completed.
 
 };
 
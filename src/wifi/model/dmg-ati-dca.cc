@@ -376,6 +376,27 @@ DmgAtiDca::NotifyAccessGranted (void)
                     ", seq=" << m_currentHdr.GetSequenceControl ());
     }
 
+  /* The frame exchange must complete before the end of the ATI, the next ATI starts with an empty queue */
+  Ptr<WifiPhy> phy = Low ()->GetPhy ();
+  WifiMacTrailer fcs;
+  WifiTxVector txVector = m_stationManager->GetDmgTxVector (m_currentHdr.GetAddr1 (), &m_currentHdr, m_currentPacket);
+  Time exchangeDuration = phy->CalculateTxDuration (m_currentPacket->GetSize () + m_currentHdr.GetSize () + fcs.GetSerializedSize (),
+                                                    txVector, WIFI_PREAMBLE_LONG, phy->GetFrequency ());
+  if (!m_currentHdr.IsCtl () && !m_currentHdr.IsActionNoAck ())
+    {
+      WifiMacHeader ackHdr;
+      ackHdr.SetType (WIFI_MAC_CTL_ACK);
+      exchangeDuration += Low ()->GetSifs ()
+        + phy->CalculateTxDuration (ackHdr.GetSize () + fcs.GetSerializedSize (), txVector, WIFI_PREAMBLE_LONG, phy->GetFrequency ());
+    }
+  if (exchangeDuration > m_remainingDuration)
+    {
+      NS_LOG_DEBUG ("No enough time to complete this frame exchange in the ATI");
+      m_currentPacket = 0;
+      m_allowTransmission = false;
+      return;
+    }
+
   MacLowTransmissionParameters params;
   params.SetAsBoundedTransmission ();
   params.SetMaximumTransmissionDuration (m_remainingDuration);
@@ -0,0 +1,263 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "dmg-beacon-interval-clock.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgBeaconIntervalClock");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgBeaconIntervalClock);
+
+TypeId
+DmgBeaconIntervalClock::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgBeaconIntervalClock")
+    .SetParent<Object> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgBeaconIntervalClock> ()
+  ;
+  return tid;
+}
+
+DmgBeaconIntervalClock::DmgBeaconIntervalClock ()
+  : m_dispatching (false),
+    m_purgeSubscribers (false),
+    m_nextEntry (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgBeaconIntervalClock::~DmgBeaconIntervalClock ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DmgBeaconIntervalClock::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  Stop ();
+  ClockRegistry *registry = GetRegistry ();
+  ClockRegistry::iterator it = registry->find (m_bssid);
+  if ((it != registry->end ()) && (it->second == this))
+    {
+      registry->erase (it);
+    }
+  m_subscribers.clear ();
+  m_allocationList.clear ();
+  m_timeline.clear ();
+  Object::DoDispose ();
+}
+
+DmgBeaconIntervalClock::ClockRegistry *
+DmgBeaconIntervalClock::GetRegistry (void)
+{
+  static ClockRegistry registry;
+  return &registry;
+}
+
+void
+DmgBeaconIntervalClock::SetBssid (Mac48Address bssid)
+{
+  NS_LOG_FUNCTION (this << bssid);
+  ClockRegistry *registry = GetRegistry ();
+  ClockRegistry::iterator it = registry->find (m_bssid);
+  if ((it != registry->end ()) && (it->second == this))
+    {
+      registry->erase (it);
+    }
+  m_bssid = bssid;
+  (*registry)[bssid] = this;
+}
+
+Mac48Address
+DmgBeaconIntervalClock::GetBssid (void) const
+{
+  return m_bssid;
+}
+
+Ptr<DmgBeaconIntervalClock>
+DmgBeaconIntervalClock::Find (Mac48Address bssid)
+{
+  ClockRegistry *registry = GetRegistry ();
+  ClockRegistry::const_iterator it = registry->find (bssid);
+  if (it == registry->end ())
+    {
+      return 0;
+    }
+  return it->second;
+}
+
+void
+DmgBeaconIntervalClock::Subscribe (Mac48Address address, PhaseCallback callback)
+{
+  NS_LOG_FUNCTION (this << address);
+  m_subscribers[address] = callback;
+}
+
+void
+DmgBeaconIntervalClock::Unsubscribe (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  SubscriberMap::iterator it = m_subscribers.find (address);
+  if (it == m_subscribers.end ())
+    {
+      return;
+    }
+  if (m_dispatching)
+    {
+      /* Do not invalidate the iterator of the ongoing dispatch */
+      it->second = MakeNullCallback<void, BeaconIntervalPhase, const AllocationField &> ();
+      m_purgeSubscribers = true;
+    }
+  else
+    {
+      m_subscribers.erase (it);
+    }
+}
+
+bool
+DmgBeaconIntervalClock::IsSubscribed (Mac48Address address) const
+{
+  SubscriberMap::const_iterator it = m_subscribers.find (address);
+  return (it != m_subscribers.end ()) && !it->second.IsNull ();
+}
+
+uint32_t
+DmgBeaconIntervalClock::GetNSubscribers (void) const
+{
+  return m_subscribers.size ();
+}
+
+void
+DmgBeaconIntervalClock::SetAllocationList (const AllocationFieldList &allocationList)
+{
+  NS_LOG_FUNCTION (this << allocationList.size ());
+  m_allocationList = allocationList;
+}
+
+bool
+DmgBeaconIntervalClock::CompareTimelineEntry (const TimelineEntry &a, const TimelineEntry &b)
+{
+  if (a.offset != b.offset)
+    {
+      return a.offset < b.offset;
+    }
+  return a.phase < b.phase;
+}
+
+void
+DmgBeaconIntervalClock::AddPhase (Time offset, BeaconIntervalPhase phase, const AllocationField &field)
+{
+  TimelineEntry entry;
+  entry.offset = offset;
+  entry.phase = phase;
+  entry.field = field;
+  m_timeline.push_back (entry);
+}
+
+void
+DmgBeaconIntervalClock::StartBeaconInterval (bool btiPresent, Time btiDuration, bool abftPresent, Time abftDuration,
+                                             bool atiPresent, Time atiDuration, Time mbifs)
+{
+  NS_LOG_FUNCTION (this << btiPresent << btiDuration << abftPresent << abftDuration
+                   << atiPresent << atiDuration << mbifs);
+  m_phaseEvent.Cancel ();
+  m_biStartTime = Simulator::Now ();
+
+  /* Precompute the timeline of the BI, the same way the DMG STAs derive it from the DMG Beacon */
+  AllocationField empty;
+  m_timeline.clear ();
+  m_nextEntry = 0;
+  Time offset = Seconds (0);
+  if (btiPresent)
+    {
+      offset = btiDuration + mbifs;
+      if (abftPresent)
+        {
+          AddPhase (offset, ABFT_START, empty);
+          offset += abftDuration + mbifs;
+        }
+    }
+  if (atiPresent)
+    {
+      AddPhase (offset, ATI_START, empty);
+      offset += atiDuration;
+    }
+  AddPhase (offset, DTI_START, empty);
+  for (AllocationFieldList::const_iterator it = m_allocationList.begin (); it != m_allocationList.end (); it++)
+    {
+      Time allocationStart = offset + MicroSeconds (it->GetAllocationStart ());
+      AddPhase (allocationStart, ALLOCATION_START, *it);
+      AddPhase (allocationStart + MicroSeconds (it->GetAllocationBlockDuration ()), ALLOCATION_END, *it);
+    }
+  std::stable_sort (m_timeline.begin (), m_timeline.end (), &DmgBeaconIntervalClock::CompareTimelineEntry);
+  NS_LOG_DEBUG ("BI timeline of BSS " << m_bssid << " has " << m_timeline.size () << " phases for "
+                << m_subscribers.size () << " subscribers");
+
+  Dispatch (BI_START, empty);
+  DispatchNextPhases ();
+}
+
+void
+DmgBeaconIntervalClock::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_phaseEvent.Cancel ();
+  m_nextEntry = m_timeline.size ();
+}
+
+void
+DmgBeaconIntervalClock::DispatchNextPhases (void)
+{
+  NS_LOG_FUNCTION (this);
+  Time elapsed = Simulator::Now () - m_biStartTime;
+  while ((m_nextEntry < m_timeline.size ()) && (m_timeline[m_nextEntry].offset <= elapsed))
+    {
+      const TimelineEntry &entry = m_timeline[m_nextEntry++];
+      Dispatch (entry.phase, entry.field);
+    }
+  if (m_nextEntry < m_timeline.size ())
+    {
+      m_phaseEvent = Simulator::Schedule (m_timeline[m_nextEntry].offset - elapsed,
+                                          &DmgBeaconIntervalClock::DispatchNextPhases, this);
+    }
+}
+
+void
+DmgBeaconIntervalClock::Dispatch (BeaconIntervalPhase phase, const AllocationField &field)
+{
+  NS_LOG_FUNCTION (this << phase);
+  m_dispatching = true;
+  for (SubscriberMap::iterator it = m_subscribers.begin (); it != m_subscribers.end (); it++)
+    {
+      if (!it->second.IsNull ())
+        {
+          it->second (phase, field);
+        }
+    }
+  m_dispatching = false;
+  if (m_purgeSubscribers)
+    {
+      m_purgeSubscribers = false;
+      for (SubscriberMap::iterator it = m_subscribers.begin (); it != m_subscribers.end ();)
+        {
+          if (it->second.IsNull ())
+            {
+              m_subscribers.erase (it++);
+            }
+          else
+            {
+              it++;
+            }
+        }
+    }
+}
+
+} // namespace ns3
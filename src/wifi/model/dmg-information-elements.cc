@@ -2564,7 +2564,7 @@ NextPcpListElement::DeserializeInformationField (Buffer::Iterator start, uint8_t
   uint8_t value;
 
   m_token = i.ReadU8 ();
-  while (!i.IsEnd ())
+  for (uint8_t j = 1; j < length; j++)
     {
       value = i.ReadU8 ();
       m_list.push_back (value);
@@ -2642,7 +2642,7 @@ PcpHandoverElement::SerializeInformationField (Buffer::Iterator start) const
   Buffer::Iterator i = start;
   WriteTo (i, m_oldBssID);
   WriteTo (i, m_newPcpAddress);
-  start.WriteU8 (m_remaining);
+  i.WriteU8 (m_remaining);
 }
 
 uint8_t
@@ -2688,7 +2688,7 @@ PcpHandoverElement::GetNewPcpAddress (void) const
 }
 
 uint8_t
-PcpHandoverElement::PcpHandoverElement::GetRemainingBIs (void) const
+PcpHandoverElement::GetRemainingBIs (void) const
 {
   return m_remaining;
 }
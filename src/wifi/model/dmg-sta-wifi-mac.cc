@@ -10,6 +10,7 @@
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/trace-source-accessor.h"
 
 #include "amsdu-subframe-header.h"
@@ -21,6 +22,7 @@
 #include "mac-low.h"
 #include "msdu-aggregator.h"
 #include "wifi-mac-header.h"
+#include "wifi-mac-queue.h"
 #include "random-stream.h"
 #include <cmath>
 
@@ -67,7 +69,34 @@ DmgStaWifiMac::GetTypeId (void)
     .AddAttribute ("RSSBackoff", "Maximum Responder Sector Sweep Backoff value.",
                    UintegerValue (dot11RSSBackoff),
                    MakeUintegerAccessor (&DmgStaWifiMac::m_rssBackoffLimit),
-                   MakeUintegerChecker<uint32_t> ())
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("ABFTSlotSelection", "The strategy used to select the SSW slot in the A-BFT.",
+                   EnumValue (ABFT_SLOT_UNIFORM),
+                   MakeEnumAccessor (&DmgStaWifiMac::m_abftSlotSelection),
+                   MakeEnumChecker (ABFT_SLOT_UNIFORM, "Uniform",
+                                    ABFT_SLOT_ADDRESS_HASHED, "AddressHashed",
+                                    ABFT_SLOT_ADAPTIVE, "Adaptive"))
+    .AddAttribute ("RepeatABFT", "Whether we keep performing RSS in every A-BFT after receiving SSW-FBCK from the PCP/AP. "
+                   "If false, we contend again only after losing the DMG Beacons of the PCP/AP.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&DmgStaWifiMac::m_repeatAbft),
+                   MakeBooleanChecker ())
+
+    /* Power Management Attributes */
+    .AddAttribute ("PowerSaveMode", "Whether the DMG STA dozes during the DTI periods not allocated to it "
+                   "and during the BHI of the doze BIs of its wakeup schedule once associated.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgStaWifiMac::m_powerSave),
+                   MakeBooleanChecker ())
+    .AddAttribute ("SleepCycle", "The number of BIs in one cycle of the wakeup schedule.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&DmgStaWifiMac::m_sleepCycle),
+                   MakeUintegerChecker<uint16_t> (1))
+    .AddAttribute ("AwakeBIs", "The number of BIs at the beginning of each sleep cycle during which the DMG STA "
+                   "wakes up for the BTI, A-BFT and ATI.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&DmgStaWifiMac::m_awakeBIs),
+                   MakeUintegerChecker<uint16_t> (1))
 
     /* DMG Relay Capabilities */
     .AddAttribute ("RDSDuplexMode", "0 = HD-DF, 1 = FD-AF.",
@@ -83,12 +112,63 @@ DmgStaWifiMac::GetTypeId (void)
                     MakeUintegerAccessor (&DmgStaWifiMac::m_relayDataSensingTime),
                     MakeUintegerChecker<uint8_t> (1, std::numeric_limits<uint8_t>::max ()))
 
+    /* Relay Selection and Link Switching */
+    .AddAttribute ("RelaySelectionPolicy", "The built-in policy used to select an RDS when no relay selector function is registered.",
+                    EnumValue (RELAY_SELECTION_MAX_MIN_SNR),
+                    MakeEnumAccessor (&DmgStaWifiMac::m_relaySelectionPolicy),
+                    MakeEnumChecker (RELAY_SELECTION_USER_CALLBACK, "UserCallback",
+                                     RELAY_SELECTION_MAX_MIN_SNR, "MaxMinSnr",
+                                     RELAY_SELECTION_MAX_CAPACITY, "MaxCapacity",
+                                     RELAY_SELECTION_LOAD_AWARE, "LoadAware"))
+    .AddAttribute ("AutomaticLinkSwitching", "Whether the source REDS switches between the direct and relay links "
+                   "based on the measured quality of the direct link.",
+                    BooleanValue (false),
+                    MakeBooleanAccessor (&DmgStaWifiMac::m_automaticLinkSwitching),
+                    MakeBooleanChecker ())
+    .AddAttribute ("LinkSwitchThreshold", "The direct link SNR (dB) below which the source REDS switches to the relay link.",
+                    DoubleValue (5.0),
+                    MakeDoubleAccessor (&DmgStaWifiMac::m_linkSwitchThreshold),
+                    MakeDoubleChecker<double> ())
+    .AddAttribute ("LinkSwitchHysteresis", "The SNR margin (dB) above LinkSwitchThreshold required to switch back to the direct link.",
+                    DoubleValue (3.0),
+                    MakeDoubleAccessor (&DmgStaWifiMac::m_linkSwitchHysteresis),
+                    MakeDoubleChecker<double> (0))
+    .AddAttribute ("LinkSnrSmoothingFactor", "The weight of the latest SNR sample in the smoothed link quality.",
+                    DoubleValue (0.25),
+                    MakeDoubleAccessor (&DmgStaWifiMac::m_linkSnrSmoothingFactor),
+                    MakeDoubleChecker<double> (0, 1))
+
     .AddTraceSource ("Assoc", "Associated with an access point.",
                      MakeTraceSourceAccessor (&DmgStaWifiMac::m_assocLogger),
                      "ns3::Mac48Address::TracedCallback")
     .AddTraceSource ("DeAssoc", "Association with an access point lost.",
                      MakeTraceSourceAccessor (&DmgStaWifiMac::m_deAssocLogger),
                      "ns3::Mac48Address::TracedCallback")
+    .AddTraceSource ("BeaconMissed", "The DMG STA has missed MaxLostBeacons consecutive DMG Beacons from its PCP/AP.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_beaconMissed),
+                     "ns3::Mac48Address::TracedCallback")
+    .AddTraceSource ("PcpHandover", "The DMG STA follows the PCP that took over its PBSS.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_pcpHandover),
+                     "ns3::Mac48Address::TracedCallback")
+
+    /* A-BFT Related Traces */
+    .AddTraceSource ("RSSAttempt", "The DMG STA has started RSS in an A-BFT SSW slot.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_rssAttempt),
+                     "ns3::DmgStaWifiMac::AbftSlotCallback")
+    .AddTraceSource ("RSSFailed", "The DMG STA did not receive SSW-FBCK in its A-BFT SSW slot (collision or loss).",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_rssFailed),
+                     "ns3::DmgStaWifiMac::AbftSlotCallback")
+    .AddTraceSource ("RSSBackoff", "The DMG STA exceeded RSSRetryLimit and backs off for a number of A-BFTs.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_rssBackoff),
+                     "ns3::DmgStaWifiMac::RssBackoffCallback")
+    .AddTraceSource ("ABFTCompleted", "The DMG STA has received SSW-FBCK from the PCP/AP in an A-BFT.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_abftCompletedTrace),
+                     "ns3::DmgStaWifiMac::AbftCompletedCallback")
+
+    /* Power Management Traces */
+    .AddTraceSource ("DozeStateChanged", "The DMG STA has entered or left the doze state.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_dozeStateChanged),
+                     "ns3::DmgStaWifiMac::DozeStateChangedCallback")
 
     /* Relay Procedure Related Traces */
     .AddTraceSource ("ChannelReportReceived", "The DMG STA has received a channel report.",
@@ -97,6 +177,9 @@ DmgStaWifiMac::GetTypeId (void)
     .AddTraceSource ("TransmissionLinkChanged", "The current transmission link has been changed.",
                      MakeTraceSourceAccessor (&DmgStaWifiMac::m_transmissionLinkChanged),
                      "ns3::DmgStaWifiMac::TransmissionLinkChangedTracedCallback")
+    .AddTraceSource ("LinkSwitchLatency", "The time elapsed between a link switching decision and the actual link change.",
+                     MakeTraceSourceAccessor (&DmgStaWifiMac::m_linkSwitchLatency),
+                     "ns3::DmgStaWifiMac::LinkSwitchLatencyCallback")
     .AddTraceSource ("BeamLinkMaintenanceTimerExpired",
                      "The BeamLink maintenance timer associated to a link has expired.",
                      MakeTraceSourceAccessor (&DmgStaWifiMac::m_beamLinkMaintenanceTimerExpired),
@@ -118,14 +201,25 @@ DmgStaWifiMac::DmgStaWifiMac ()
 
   /* RSS Backoff Random Variables */
   m_rssBackoffVariable = CreateObject<UniformRandomVariable> ();
-  m_rssBackoffVariable->SetAttribute ("Min", DoubleValue (0));
-  m_rssBackoffVariable->SetAttribute ("Max", DoubleValue (m_rssBackoffLimit));
   m_failedRssAttemptsCounter = 0;
   m_rssBackoffRemaining = 0;
+  m_abftMultiplier = 0;
+  m_slotOffset = 0;
+  m_abftCompleted = false;
+  m_abftAttempts = 0;
   m_nextBeacon = 0;
+  m_lastBiStart = Seconds (-1);
+
+  /* Power Management Variables */
+  m_dozeBi = false;
+  m_biCounter = 0;
+  m_wakeupScheduleStart = 0;
 
   /* Relay Variables */
   m_relayMode = false;
+  m_periodProtected = false;
+  m_relayLinkInfo.switchTransmissionLink = false;
+  m_relayLinkInfo.transmissionLink = DIRECT_LINK;
   m_sp->SetMissedAckCallback (MakeCallback (&DmgStaWifiMac::MissedAck, this));
 
   /* Let the lower layers know that we are acting as a non-AP DMG STA in an infrastructure BSS. */
@@ -150,6 +244,11 @@ void
 DmgStaWifiMac::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  if (m_biClock != 0)
+    {
+      m_biClock->Unsubscribe (GetAddress ());
+      m_biClock = 0;
+    }
   DmgWifiMac::DoDispose ();
 }
 
@@ -258,6 +357,10 @@ DmgStaWifiMac::SendAssociationRequest (void)
   assoc.AddWifiInformationElement (GetDmgCapabilities ());
   assoc.AddWifiInformationElement (GetMultiBandElement ());
   assoc.AddWifiInformationElement (GetRelayCapabilitiesElement ());
+  if (m_powerSave)
+    {
+      assoc.AddWifiInformationElement (GetWakeupScheduleElement ());
+    }
   packet->AddHeader (assoc);
 
   // The standard is not clear on the correct queue for management
@@ -397,7 +500,12 @@ DmgStaWifiMac::MissedBeacons (void)
     return;
   }
   NS_LOG_DEBUG ("beacon missed");
+  m_beaconMissed (GetBssid ());
+  m_lostBssid = GetBssid ();
+  m_abftCompleted = false;
   SetState (BEACON_MISSED);
+  WakeUp ();
+  LeaveBeaconIntervalClock ();
   TryToEnsureAssociated ();
 }
 
@@ -549,9 +657,50 @@ DmgStaWifiMac::StartBeaconInterval (void)
 {
   NS_LOG_FUNCTION (this << "DMG AP Starting BI at " << Simulator::Now ());
 
+  /* We may start following the PCP/AP clock at the same time it starts this BI */
+  if (m_lastBiStart == Simulator::Now ())
+    {
+      return;
+    }
+  m_lastBiStart = Simulator::Now ();
+  m_biCounter++;
+
   /* Disable Channel Access by CBAP */
   EndContentionPeriod ();
 
+  /* In the doze BIs of the wakeup schedule we skip the BHI and wake up only for our allocations in the DTI */
+  m_dozeBi = IsPowerSaving () && ((m_biCounter - m_wakeupScheduleStart) % m_sleepCycle >= m_awakeBIs);
+  if (m_dozeBi)
+    {
+      NS_LOG_DEBUG ("Doze BI for Station:" << GetAddress ());
+      m_biStartTime = Simulator::Now ();
+      Time dtiStart = m_dtiOffset;
+      if (m_nextBeacon != 0)
+        {
+          m_nextBeacon--;
+          dtiStart = (m_atiPresent ? m_atiDuration : Seconds (0));
+        }
+      Doze ();
+      if (m_biClock == 0)
+        {
+          Simulator::Schedule (dtiStart, &DmgStaWifiMac::StartDataTransmissionInterval, this);
+        }
+      return;
+    }
+  WakeUp ();
+
+  /* Once associated, follow the beacon interval clock of the PCP/AP if it shares one. We only
+   * switch in a BI with BTI so that the remaining access periods of this BI come from the clock. */
+  if ((m_biClock == 0) && IsAssociated () && (m_nextBeacon == 0))
+    {
+      m_biClock = DmgBeaconIntervalClock::Find (GetBssid ());
+      if (m_biClock != 0)
+        {
+          NS_LOG_DEBUG ("Follow the beacon interval clock of " << GetBssid ());
+          m_biClock->Subscribe (GetAddress (), MakeCallback (&DmgStaWifiMac::BeaconIntervalPhaseChanged, this));
+        }
+    }
+
   /* Schedule the next period */
   if (m_nextBeacon == 0)
     {
@@ -562,7 +711,11 @@ DmgStaWifiMac::StartBeaconInterval (void)
       /* We will not receive DMG Beacon during this BI */
       m_nextBeacon--;
       m_biStartTime = Simulator::Now ();
-      if (m_atiPresent)
+      if (m_biClock != 0)
+        {
+          return;
+        }
+      else if (m_atiPresent)
         {
           StartAnnouncementTransmissionInterval ();
           NS_LOG_DEBUG ("ATI for Station:" << GetAddress () << " is scheduled at " << Simulator::Now ());
@@ -595,7 +748,11 @@ DmgStaWifiMac::StartAssociationBeamformTraining (void)
   m_accessPeriod = CHANNEL_ACCESS_ABFT;
 
   /* Schedule access period after A-BFT */
-  if (m_atiPresent)
+  if (m_biClock != 0)
+    {
+      NS_LOG_DEBUG ("The access period after A-BFT is started by the beacon interval clock");
+    }
+  else if (m_atiPresent)
     {
       Simulator::Schedule (m_abftDuration + m_mbifs, &DmgStaWifiMac::StartAnnouncementTransmissionInterval, this);
       NS_LOG_DEBUG ("ATI for Station:" << GetAddress () << " is scheduled at " << Simulator::Now () + m_abftDuration + m_mbifs);
@@ -614,28 +771,64 @@ void
 DmgStaWifiMac::DoAssociationBeamformingTraining (void)
 {
   NS_LOG_FUNCTION (this);
+  if (m_abftCompleted && !m_repeatAbft)
+    {
+      return;
+    }
+
   if ((m_rssBackoffRemaining == 0))
     {
-      /* Choose a random SSW Slot to transmit SSW Frames in it */
-      a_bftSlot->SetAttribute ("Min", DoubleValue (0));
-      a_bftSlot->SetAttribute ("Max", DoubleValue (m_remainingSlotsPerABFT - 1));
-      m_slotIndex = a_bftSlot->GetInteger ();
+      /* The primary A-BFT is open to all DMG STAs, the secondary A-BFTs (if any) are used
+       * by the DMG STAs retrying RSS after failing to receive SSW-FBCK. */
+      uint8_t firstSlot = 0;
+      uint8_t lastSlot = m_ssSlotsPerABFT - 1;
+      if (m_failedRssAttemptsCounter > 0)
+        {
+          if (m_abftMultiplier > 0)
+            {
+              firstSlot = m_ssSlotsPerABFT;
+            }
+          lastSlot = m_ssSlotsPerABFT * (1 + m_abftMultiplier) - 1;
+        }
+      firstSlot = std::max (firstSlot, m_slotOffset);
+      if (firstSlot > lastSlot)
+        {
+          NS_LOG_DEBUG ("No more SSW slots available in the current A-BFT");
+          return;
+        }
+
+      /* In the adaptive strategy, a DMG STA that failed RSS defers to the next A-BFT with
+       * a probability that doubles at each failure, this thins out association storms. */
+      if ((m_abftSlotSelection == ABFT_SLOT_ADAPTIVE) && (m_slotOffset == 0) && (m_failedRssAttemptsCounter > 0))
+        {
+          double accessProbability = 1.0 / (1 << std::min<uint32_t> (m_failedRssAttemptsCounter, 4));
+          if (a_bftSlot->GetValue (0, 1) >= accessProbability)
+            {
+              NS_LOG_DEBUG ("Defer RSS to the next A-BFT, access probability=" << accessProbability);
+              return;
+            }
+        }
 
-      Time rssTime = m_slotIndex * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot);
+      /* Choose SSW Slot to transmit SSW Frames in it */
+      m_slotIndex = SelectAbftSlot (firstSlot, lastSlot);
+
+      Time rssTime = (m_slotIndex - m_slotOffset) * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot);
       Simulator::Schedule (rssTime, &DmgStaWifiMac::StartAbftResponderSectorSweep, this, GetBssid (), m_isResponderTXSS);
-      NS_LOG_DEBUG ("Selected Sector Slot Index=" << uint (m_slotOffset + m_slotIndex)
+      NS_LOG_DEBUG ("Selected Sector Slot Index=" << uint (m_slotIndex)
                     << ", Start RSS at " << Simulator::Now () + rssTime);
 
-      /* Update upper bound of slots */
-      m_remainingSlotsPerABFT -= (m_slotIndex + 1);
-      if (m_remainingSlotsPerABFT > 0)
+      if (m_abftAttempts == 0)
         {
-          /* Schedule SSW FBCK Timeout to detect a collision i.e. missing SSW-FBCK */
-          Time timeout = (m_slotIndex + 1) * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot);
-          NS_LOG_DEBUG ("Scheduled SSW-FBCK Timeout Event at " << Simulator::Now () + timeout);
-          m_sswFbckTimeout = Simulator::Schedule (timeout, &DmgStaWifiMac::MissedSswFeedback, this);
-          m_slotOffset += (m_slotIndex + 1);
+          m_abftContentionStart = Simulator::Now () + rssTime;
         }
+      m_abftAttempts++;
+      m_rssAttempt (GetBssid (), m_slotIndex, m_failedRssAttemptsCounter);
+
+      /* Schedule SSW FBCK Timeout to detect a collision i.e. missing SSW-FBCK */
+      Time timeout = (m_slotIndex - m_slotOffset + 1) * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot);
+      NS_LOG_DEBUG ("Scheduled SSW-FBCK Timeout Event at " << Simulator::Now () + timeout);
+      m_sswFbckTimeout = Simulator::Schedule (timeout, &DmgStaWifiMac::MissedSswFeedback, this);
+      m_slotOffset = m_slotIndex + 1;
     }
   else
     {
@@ -643,6 +836,25 @@ DmgStaWifiMac::DoAssociationBeamformingTraining (void)
     }
 }
 
+uint8_t
+DmgStaWifiMac::SelectAbftSlot (uint8_t firstSlot, uint8_t lastSlot)
+{
+  NS_LOG_FUNCTION (this << uint (firstSlot) << uint (lastSlot));
+  if ((m_abftSlotSelection == ABFT_SLOT_ADDRESS_HASHED) && (m_failedRssAttemptsCounter == 0))
+    {
+      /* Spread the first attempts of co-located DMG STAs deterministically over the slots */
+      uint8_t address[6];
+      GetAddress ().CopyTo (address);
+      uint32_t hash = 0;
+      for (uint8_t i = 0; i < 6; i++)
+        {
+          hash = hash * 31 + address[i];
+        }
+      return firstSlot + hash % (lastSlot - firstSlot + 1);
+    }
+  return a_bftSlot->GetInteger (firstSlot, lastSlot);
+}
+
 void
 DmgStaWifiMac::MissedSswFeedback (void)
 {
@@ -656,6 +868,7 @@ DmgStaWifiMac::MissedSswFeedback (void)
    * count becomes zero. The STA shall set FailedRSSAttempts to 0 upon successfully receiving an SSW-
    * Feedback frame during the A-BFT. */
   m_failedRssAttemptsCounter++;
+  m_rssFailed (GetBssid (), m_slotIndex, m_failedRssAttemptsCounter);
   if (m_failedRssAttemptsCounter < m_rssAttemptsLimit)
     {
       DoAssociationBeamformingTraining ();
@@ -663,7 +876,8 @@ DmgStaWifiMac::MissedSswFeedback (void)
   else
     {
       /* Extract random backoff for backing-off */
-      m_rssBackoffRemaining = m_rssBackoffVariable->GetInteger ();
+      m_rssBackoffRemaining = m_rssBackoffVariable->GetInteger (0, m_rssBackoffLimit - 1);
+      m_rssBackoff (GetBssid (), m_rssBackoffRemaining);
     }
 }
 
@@ -671,10 +885,17 @@ void
 DmgStaWifiMac::StartAnnouncementTransmissionInterval (void)
 {
   NS_LOG_FUNCTION (this << "DMG STA Starting ATI at " << Simulator::Now ());
+  if (m_dozeBi)
+    {
+      return;
+    }
   m_accessPeriod = CHANNEL_ACCESS_ATI;
   /* We started ATI Period we should stay in Omni Drectional waiting for packets */
   m_phy->GetDirectionalAntenna ()->SetInOmniReceivingMode ();
-  Simulator::Schedule (m_atiDuration, &DmgStaWifiMac::StartDataTransmissionInterval, this);
+  if (m_biClock == 0)
+    {
+      Simulator::Schedule (m_atiDuration, &DmgStaWifiMac::StartDataTransmissionInterval, this);
+    }
   m_dmgAtiDca->InitiateAtiAccessPeriod (m_atiDuration);
 }
 
@@ -686,11 +907,19 @@ DmgStaWifiMac::StartDataTransmissionInterval (void)
 
   /* Initialize DMG Reception */
   m_receivedDmgBeacon = false;
+  m_dtiStartTime = Simulator::Now ();
+  if (!m_dozeBi)
+    {
+      m_dtiOffset = Simulator::Now () - m_biStartTime;
+    }
 
-  /* Schedule the beginning of the next BI interval */
+  /* Schedule the beginning of the next BI interval, unless the PCP/AP clock drives us */
   Time nextBeaconInterval = m_beaconInterval - (Simulator::Now () - m_biStartTime);
-  Simulator::Schedule (nextBeaconInterval, &DmgStaWifiMac::StartBeaconInterval, this);
-  NS_LOG_DEBUG ("Next Beacon Interval will start at " << Simulator::Now () + nextBeaconInterval);
+  if (m_biClock == 0)
+    {
+      Simulator::Schedule (nextBeaconInterval, &DmgStaWifiMac::StartBeaconInterval, this);
+      NS_LOG_DEBUG ("Next Beacon Interval will start at " << Simulator::Now () + nextBeaconInterval);
+    }
 
   /* Send Association Request if we are not assoicated */
   if (!IsAssociated ())
@@ -713,172 +942,420 @@ DmgStaWifiMac::StartDataTransmissionInterval (void)
   if (m_isCbapOnly && !m_isCbapSource)
     {
       NS_LOG_INFO ("CBAP allocation only in DTI");
-      Simulator::ScheduleNow (&DmgStaWifiMac::StartContentionPeriod, this, BROADCAST_CBAP, nextBeaconInterval);
+      WakeUp ();
+      Simulator::ScheduleNow (&DmgStaWifiMac::StartContentionPeriod, this, BROADCAST_CBAP, GetCbapOnlyContentionDuration ());
+      /* Stop contending during the Beacon SPs of the other PCP/APs of the cluster */
+      if (m_biClock == 0)
+        {
+          for (AllocationFieldList::iterator iter = m_quietPeriods.begin (); iter != m_quietPeriods.end (); iter++)
+            {
+              Time quietStart = MicroSeconds (iter->GetAllocationStart ());
+              Simulator::Schedule (quietStart, &DmgStaWifiMac::StartAllocation, this, *iter);
+              Simulator::Schedule (quietStart + MicroSeconds (iter->GetAllocationBlockDuration ()),
+                                   &DmgStaWifiMac::EndAllocation, this, *iter);
+            }
+        }
     }
   else
     {
+      /* Doze until the first allocation we take part in, after the awake window announced by the PCP/AP */
+      if (IsPowerSaving ())
+        {
+          if (m_awakeWindow.IsStrictlyPositive ())
+            {
+              WakeUp ();
+              m_dozeEvent = Simulator::Schedule (m_awakeWindow, &DmgStaWifiMac::Doze, this);
+            }
+          else
+            {
+              Doze ();
+            }
+        }
+
       AllocationField field;
       for (AllocationFieldList::iterator iter = m_allocationList.begin (); iter != m_allocationList.end (); iter++)
         {
           field = (*iter);
+          Time allocationStart = MicroSeconds (field.GetAllocationStart ());
+          Time allocationLength = MicroSeconds (field.GetAllocationBlockDuration ());
           if (field.GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
             {
-              Time spStart = MicroSeconds (field.GetAllocationStart ());
-              Time servicePeriodLength = MicroSeconds (field.GetAllocationBlockDuration ());
-              NS_ASSERT_MSG (spStart + servicePeriodLength <= nextBeaconInterval,
+              NS_ASSERT_MSG (allocationStart + allocationLength <= nextBeaconInterval,
                              "Allocation should not exceed DTI period.");
-
-              if (field.GetSourceAid () == m_aid)
+              if ((field.GetSourceAid () == m_aid) && !field.GetBfControl ().IsBeamformTraining ())
                 {
-                  uint8_t destAid = field.GetDestinationAid ();
-                  Mac48Address destAddress = m_aidMap[destAid];
-                  if (field.GetBfControl ().IsBeamformTraining ())
+                  /* Data to the destination of our SP is only transmitted during the SP */
+                  DataForwardingTableIterator forwardingIterator = m_dataForwardingTable.find (m_aidMap[field.GetDestinationAid ()]);
+                  if (forwardingIterator != m_dataForwardingTable.end ())
                     {
-                      Simulator::Schedule (spStart, &DmgStaWifiMac::StartBeamformingServicePeriod, this, destAid, destAddress,
-                                           true, field.GetBfControl ().IsInitiatorTxss (), servicePeriodLength);
+                      forwardingIterator->second.isCbapPeriod = false;
                     }
-                  else
-                    {
-                      /* Add station to the list of stations we can communicate with directly in Service Period */
-                      DataForwardingTableIterator forwardingIterator = m_dataForwardingTable.find (destAddress);
-                      if (forwardingIterator == m_dataForwardingTable.end ())
-                        {
-                          NS_LOG_ERROR ("Did not perform Beamforing Training with " << destAddress);
-                          continue;
-                        }
-                      else
-                        {
-                          forwardingIterator->second.isCbapPeriod = false;
-                        }
+                }
+            }
+          /* The beacon interval clock of the PCP/AP starts and ends the allocations for us */
+          if ((m_biClock == 0) && IsAllocationOfInterest (field))
+            {
+              Simulator::Schedule (allocationStart, &DmgStaWifiMac::StartAllocation, this, field);
+              Simulator::Schedule (allocationStart + allocationLength, &DmgStaWifiMac::EndAllocation, this, field);
+            }
+        }
+    }
+}
 
-                      /* We are the source REDS, check if this SP allocation is protected by an RDS */
-                      REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
-                      RELAY_LINK_MAP_ITERATOR it = m_relayLinkMap.find (redsPair);
-                      if (it != m_relayLinkMap.end ())
-                        {
-                          RELAY_LINK_INFO info = it->second;
-
-                          /* Schedule events related to the beginning and end of relay period */
-                          Simulator::Schedule (spStart, &DmgStaWifiMac::InitiateRelayPeriods, this, info);
-                          Simulator::Schedule (spStart + servicePeriodLength, &DmgStaWifiMac::EndRelayPeriods, this, redsPair);
-
-                          /* Schedule events related to the intervals within the relay period */
-                          if ((info.transmissionLink == DIRECT_LINK) && (info.rdsDuplexMode == 0))
-                            {
-                              /* Schedule the beginning of this service period */
-                              Simulator::Schedule (spStart, &DmgStaWifiMac::StartServicePeriod,
-                                                   this, field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
-                            }
-                          else if (info.rdsDuplexMode == 1)
-                            {
-                              Simulator::Schedule (spStart, &DmgStaWifiMac::StartFullDuplexRelay,
-                                                   this, field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
-                            }
-                        }
-                      else
-                        {
-                          /* No relay link has been established so schedule normal service period */
-                          Simulator::Schedule (spStart, &DmgStaWifiMac::StartServicePeriod,
-                                               this, field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
-                        }
+void
+DmgStaWifiMac::BeaconIntervalPhaseChanged (BeaconIntervalPhase phase, const AllocationField &field)
+{
+  NS_LOG_FUNCTION (this << phase);
+  switch (phase)
+    {
+    case BI_START:
+      StartBeaconInterval ();
+      break;
+    case ABFT_START:
+      /* A STA shall not transmit in the A-BFT of a beacon interval if it does not receive at least one
+       * DMG Beacon frame during the BTI of that beacon interval. */
+      if (m_receivedDmgBeacon && !m_dozeBi)
+        {
+          m_slotIndex = 0;
+          StartAssociationBeamformTraining ();
+        }
+      break;
+    case ATI_START:
+      StartAnnouncementTransmissionInterval ();
+      break;
+    case DTI_START:
+      StartDataTransmissionInterval ();
+      break;
+    case ALLOCATION_START:
+      StartAllocation (field);
+      break;
+    case ALLOCATION_END:
+      EndAllocation (field);
+      break;
+    }
+}
 
-                      Simulator::Schedule (spStart + servicePeriodLength, &DmgStaWifiMac::EndServicePeriod, this);
-                    }
-                }
-              else if ((field.GetSourceAid () == AID_BROADCAST) && (field.GetDestinationAid () == AID_BROADCAST))
+void
+DmgStaWifiMac::LeaveBeaconIntervalClock (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_biClock == 0)
+    {
+      return;
+    }
+  m_biClock->Unsubscribe (GetAddress ());
+  m_biClock = 0;
+  /* Keep our own BIs aligned with the ones of the PCP/AP */
+  int64_t elapsed = (Simulator::Now () - m_biStartTime).GetTimeStep () % m_beaconInterval.GetTimeStep ();
+  Simulator::Schedule (m_beaconInterval - TimeStep (elapsed), &DmgStaWifiMac::StartBeaconInterval, this);
+}
+
+void
+DmgStaWifiMac::FollowPcpHandover (Mac48Address newPcp)
+{
+  NS_LOG_FUNCTION (this << newPcp);
+  NS_LOG_INFO ("DMG STA " << GetAddress () << " follows the PCP handover from " << GetBssid () << " to " << newPcp);
+  Mac48Address oldBssid = GetBssid ();
+  SetBssid (newPcp);
+  RedirectPendingFrames (oldBssid);
+  MapAidToMacAddress (AID_AP, newPcp);
+  LeaveBeaconIntervalClock ();
+  /* Train our link with the new PCP in its next A-BFT */
+  m_abftCompleted = false;
+  m_failedRssAttemptsCounter = 0;
+  m_rssBackoffRemaining = 0;
+  m_pcpHandover (newPcp);
+}
+
+void
+DmgStaWifiMac::RedirectPendingFrames (Mac48Address oldBssid)
+{
+  NS_LOG_FUNCTION (this << oldBssid);
+  /* The old PCP/AP does not answer anymore */
+  for (EdcaQueues::iterator it = m_edca.begin (); it != m_edca.end (); it++)
+    {
+      it->second->ChangePacketsAddress (oldBssid, GetBssid ());
+    }
+}
+
+bool
+DmgStaWifiMac::IsAllocationOfInterest (const AllocationField &field) const
+{
+  if (field.GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
+    {
+      if (field.GetSourceAid () == m_aid)
+        {
+          return true;
+        }
+      else if ((field.GetSourceAid () == AID_BROADCAST) && (field.GetDestinationAid () == AID_BROADCAST))
+        {
+          /* The PCP/AP may create SPs in its beacon interval with the source and destination AID
+           * subfields within an Allocation field set to 255 to prevent transmissions during
+           * specific periods in the beacon interval. This period can used for Dynamic Allocation
+           * of service peridos (Polling) */
+          NS_LOG_INFO ("No transmission is allowed from " << field.GetAllocationStart () <<
+                       " till " << field.GetAllocationBlockDuration ());
+          return false;
+        }
+      else if ((field.GetDestinationAid () == m_aid) || (field.GetDestinationAid () == AID_BROADCAST))
+        {
+          return true;
+        }
+      else
+        {
+          /* Check if we protect this service period as an RDS */
+          REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
+          return (m_relayLinkMap.find (redsPair) != m_relayLinkMap.end ());
+        }
+    }
+  else if (field.GetAllocationType () == CBAP_ALLOCATION)
+    {
+      return ((field.GetSourceAid () == AID_BROADCAST) || (field.GetSourceAid () == m_aid)
+              || (field.GetDestinationAid () == m_aid));
+    }
+  return false;
+}
+
+void
+DmgStaWifiMac::StartAllocation (AllocationField field)
+{
+  NS_LOG_FUNCTION (this << uint (field.GetAllocationID ()) << field.GetAllocationStart ());
+  if (IsQuietPeriod (field))
+    {
+      if (m_isCbapOnly && !m_isCbapSource)
+        {
+          EndContentionPeriod ();
+        }
+      return;
+    }
+  if ((m_isCbapOnly && !m_isCbapSource) || !IsAllocationOfInterest (field))
+    {
+      return;
+    }
+
+  /* Stay awake for the duration of the allocation */
+  m_activeAllocations.insert (field.GetAllocationStart ());
+  WakeUp ();
+
+  uint8_t endActions = 0;
+  Time servicePeriodLength = MicroSeconds (field.GetAllocationBlockDuration ());
+  if (field.GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
+    {
+      if (field.GetSourceAid () == m_aid)
+        {
+          uint8_t destAid = field.GetDestinationAid ();
+          Mac48Address destAddress = m_aidMap[destAid];
+          if (field.GetBfControl ().IsBeamformTraining ())
+            {
+              StartBeamformingServicePeriod (destAid, destAddress, true,
+                                             field.GetBfControl ().IsInitiatorTxss (), servicePeriodLength);
+            }
+          else
+            {
+              /* We can communicate directly in the Service Period only with beamformed stations,
+               * the link with the PCP/AP is trained in the BHI */
+              if ((destAid != AID_AP) && (m_dataForwardingTable.find (destAddress) == m_dataForwardingTable.end ()))
                 {
-                  /* The PCP/AP may create SPs in its beacon interval with the source and destination AID
-                   * subfields within an Allocation field set to 255 to prevent transmissions during
-                   * specific periods in the beacon interval. This period can used for Dynamic Allocation
-                   * of service peridos (Polling) */
-                  NS_LOG_INFO ("No transmission is allowed from " << field.GetAllocationStart () <<
-                               " till " << field.GetAllocationBlockDuration ());
+                  NS_LOG_ERROR ("Did not perform Beamforing Training with " << destAddress);
+                  return;
                 }
-              else if ((field.GetDestinationAid () == m_aid) || (field.GetDestinationAid () == AID_BROADCAST))
+
+              /* We are the source REDS, check if this SP allocation is protected by an RDS */
+              REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
+              RELAY_LINK_MAP_ITERATOR it = m_relayLinkMap.find (redsPair);
+              if (it != m_relayLinkMap.end ())
                 {
-                  /* The STA identified by the Destination AID field in the Extended Schedule element
-                   * should be in the receive state for the duration of the SP in order to receive
-                   * transmissions from the source DMG STA. */
-                  uint8_t sourceAid = field.GetSourceAid ();
-                  Mac48Address sourceAddress = m_aidMap[sourceAid];
+                  RELAY_LINK_INFO info = it->second;
 
-                  if (field.GetBfControl ().IsBeamformTraining ())
+                  /* Start the relay period, the intervals within it depend on the relay link */
+                  InitiateRelayPeriods (info);
+                  endActions |= END_RELAY_PERIODS;
+                  if ((info.transmissionLink == DIRECT_LINK) && (info.rdsDuplexMode == 0))
                     {
-                      Simulator::Schedule (spStart, &DmgStaWifiMac::StartBeamformingServicePeriod, this, sourceAid, sourceAddress,
-                                           false, field.GetBfControl ().IsResponderTxss (), servicePeriodLength);
+                      StartServicePeriod (field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
                     }
-                  else
+                  else if (info.rdsDuplexMode == 1)
                     {
-                      /* Check if this SP allocation is protected by relay */
-                      REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
-                      RELAY_LINK_MAP_ITERATOR it = m_relayLinkMap.find (redsPair);
-                      if (it != m_relayLinkMap.end ())
-                        {
-                          RELAY_LINK_INFO info = it->second;
-
-                          /* Schedule events related to the beginning and end of relay period */
-                          Simulator::Schedule (spStart, &DmgStaWifiMac::InitiateRelayPeriods, this, info);
-                          Simulator::Schedule (spStart + servicePeriodLength, &DmgStaWifiMac::EndRelayPeriods, this, redsPair);
-
-                          /* Schedule Data Sensing Timeout to detect missing frame transmission */
-                          Simulator::Schedule (MicroSeconds (m_relayDataSensingTime), &DmgStaWifiMac::RelayDataSensingTimeout, this);
-
-                          /* Schedule events related to the intervals within the relay period */
-                          if ((info.transmissionLink == DIRECT_LINK) && (info.rdsDuplexMode == 0))
-                            {
-                              Simulator::Schedule (spStart, &DmgStaWifiMac::StartServicePeriod, this,
-                                                   field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
-                            }
-                          else if (info.rdsDuplexMode == 1)
-                            {
-                              Simulator::Schedule (spStart, &DmgStaWifiMac::StartFullDuplexRelay, this,
-                                                   field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
-                            }
-                        }
-                      else
-                        {
-                          Simulator::Schedule (spStart, &DmgStaWifiMac::StartServicePeriod, this,
-                                               field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
-                        }
+                      StartFullDuplexRelay (field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
                     }
                 }
-              else if ((field.GetSourceAid () != m_aid) && (field.GetDestinationAid () != m_aid))
+              else
                 {
-                  /* Check if we protect this service period as an RDS */
-                  REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
-                  RELAY_LINK_MAP_ITERATOR it = m_relayLinkMap.find (redsPair);
-                  if (it != m_relayLinkMap.end ())
-                    {
-                      RELAY_LINK_INFO info = it->second;
-                      Simulator::Schedule (spStart, &DmgStaWifiMac::SwitchToRelayOpertionalMode, this);
-                      Simulator::Schedule (spStart + servicePeriodLength, &DmgStaWifiMac::RelayOperationTimeout, this);
+                  /* No relay link has been established so start normal service period */
+                  StartServicePeriod (field.GetAllocationID (), servicePeriodLength, destAid, destAddress, true);
+                }
+              endActions |= END_SERVICE_PERIOD;
+            }
+        }
+      else if ((field.GetDestinationAid () == m_aid) || (field.GetDestinationAid () == AID_BROADCAST))
+        {
+          /* The STA identified by the Destination AID field in the Extended Schedule element
+           * should be in the receive state for the duration of the SP in order to receive
+           * transmissions from the source DMG STA. */
+          uint8_t sourceAid = field.GetSourceAid ();
+          Mac48Address sourceAddress = m_aidMap[sourceAid];
+          if (field.GetBfControl ().IsBeamformTraining ())
+            {
+              StartBeamformingServicePeriod (sourceAid, sourceAddress, false,
+                                             field.GetBfControl ().IsResponderTxss (), servicePeriodLength);
+            }
+          else
+            {
+              /* Check if this SP allocation is protected by relay */
+              REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
+              RELAY_LINK_MAP_ITERATOR it = m_relayLinkMap.find (redsPair);
+              if (it != m_relayLinkMap.end ())
+                {
+                  RELAY_LINK_INFO info = it->second;
+                  InitiateRelayPeriods (info);
+                  endActions |= END_RELAY_PERIODS;
 
-                      if (info.rdsDuplexMode == 1) // FD-AF
-                        {
-                          NS_LOG_INFO ("Protecting the SP between by an RDS in FD-AF Mode: Source AID=" << info.srcRedsAid <<
-                                       " and Destination AID=" << info.dstRedsAid);
-                          ANTENNA_CONFIGURATION_TX antennaConfigTxSrc = m_bestAntennaConfig[info.srcRedsAddress].first;
-                          ANTENNA_CONFIGURATION_TX antennaConfigTxDst = m_bestAntennaConfig[info.dstRedsAddress].first;
-                          Simulator::Schedule (spStart, &WifiPhy::ActivateRdsOpereation, m_phy,
-                                               antennaConfigTxSrc.first, antennaConfigTxSrc.second,
-                                               antennaConfigTxDst.first, antennaConfigTxDst.second);
-                          Simulator::Schedule (spStart + servicePeriodLength, &WifiPhy::SuspendRdsOperation, m_phy);
-                        }
+                  /* Schedule Data Sensing Timeout to detect missing frame transmission */
+                  Simulator::Schedule (MicroSeconds (m_relayDataSensingTime), &DmgStaWifiMac::RelayDataSensingTimeout, this);
+
+                  if ((info.transmissionLink == DIRECT_LINK) && (info.rdsDuplexMode == 0))
+                    {
+                      StartServicePeriod (field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
+                    }
+                  else if (info.rdsDuplexMode == 1)
+                    {
+                      StartFullDuplexRelay (field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
                     }
                 }
+              else
+                {
+                  StartServicePeriod (field.GetAllocationID (), servicePeriodLength, sourceAid, sourceAddress, false);
+                }
             }
-          else if ((field.GetAllocationType () == CBAP_ALLOCATION) &&
-                  ((field.GetSourceAid () == AID_BROADCAST) || (field.GetSourceAid () == m_aid) || (field.GetDestinationAid () == m_aid)))
-
+        }
+      else
+        {
+          /* We protect this service period as an RDS */
+          REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
+          RELAY_LINK_INFO info = m_relayLinkMap[redsPair];
+          SwitchToRelayOpertionalMode ();
+          endActions |= RELAY_OPERATION_TIMEOUT;
+          if (info.rdsDuplexMode == 1) // FD-AF
             {
-              Time cbapEnd = MicroSeconds (field.GetAllocationStart ()) + MicroSeconds (field.GetAllocationBlockDuration ());
-              /* Schedule two events for the beginning of the relay mode */
-              Simulator::Schedule (MicroSeconds (field.GetAllocationStart ()), &DmgStaWifiMac::StartContentionPeriod, this,
-                                   field.GetAllocationID () ,MicroSeconds (field.GetAllocationBlockDuration ()));
-              Simulator::Schedule (cbapEnd, &DmgStaWifiMac::EndContentionPeriod, this);
+              NS_LOG_INFO ("Protecting the SP between by an RDS in FD-AF Mode: Source AID=" << info.srcRedsAid <<
+                           " and Destination AID=" << info.dstRedsAid);
+              ANTENNA_CONFIGURATION_TX antennaConfigTxSrc = m_bestAntennaConfig[info.srcRedsAddress].first;
+              ANTENNA_CONFIGURATION_TX antennaConfigTxDst = m_bestAntennaConfig[info.dstRedsAddress].first;
+              m_phy->ActivateRdsOpereation (antennaConfigTxSrc.first, antennaConfigTxSrc.second,
+                                            antennaConfigTxDst.first, antennaConfigTxDst.second);
+              endActions |= SUSPEND_RDS_OPERATION;
             }
         }
     }
+  else
+    {
+      StartContentionPeriod (field.GetAllocationID (), servicePeriodLength);
+      endActions |= END_CONTENTION_PERIOD;
+    }
+
+  if (endActions != 0)
+    {
+      m_allocationEndActions[field.GetAllocationStart ()] = endActions;
+    }
+}
+
+void
+DmgStaWifiMac::EndAllocation (AllocationField field)
+{
+  NS_LOG_FUNCTION (this << uint (field.GetAllocationID ()) << field.GetAllocationStart ());
+  if (IsQuietPeriod (field))
+    {
+      if (m_isCbapOnly && !m_isCbapSource)
+        {
+          ResumeContentionPeriod ();
+        }
+      return;
+    }
+  AllocationEndActions::iterator it = m_allocationEndActions.find (field.GetAllocationStart ());
+  uint8_t endActions = 0;
+  if (it != m_allocationEndActions.end ())
+    {
+      endActions = it->second;
+      m_allocationEndActions.erase (it);
+    }
+
+  if (endActions & END_RELAY_PERIODS)
+    {
+      REDS_PAIR redsPair = std::make_pair (field.GetSourceAid (), field.GetDestinationAid ());
+      EndRelayPeriods (redsPair);
+    }
+  if (endActions & END_SERVICE_PERIOD)
+    {
+      EndServicePeriod ();
+    }
+  if (endActions & RELAY_OPERATION_TIMEOUT)
+    {
+      RelayOperationTimeout ();
+    }
+  if (endActions & SUSPEND_RDS_OPERATION)
+    {
+      m_phy->SuspendRdsOperation ();
+    }
+  if (endActions & END_CONTENTION_PERIOD)
+    {
+      EndContentionPeriod ();
+    }
+
+  /* Doze again until our next allocation */
+  if ((m_activeAllocations.erase (field.GetAllocationStart ()) > 0) && m_activeAllocations.empty ()
+      && IsPowerSaving () && (m_accessPeriod == CHANNEL_ACCESS_DTI))
+    {
+      Doze ();
+    }
+}
+
+bool
+DmgStaWifiMac::IsPowerSaving (void) const
+{
+  return m_powerSave && IsAssociated ();
+}
+
+void
+DmgStaWifiMac::Doze (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_dozeEvent.Cancel ();
+  if (m_phy->IsStateSleep () || !m_activeAllocations.empty ())
+    {
+      return;
+    }
+  if (m_phy->IsStateTx () || m_phy->IsStateRx () || m_phy->IsStateSwitching ())
+    {
+      /* Do not interrupt the ongoing frame exchange */
+      m_dozeEvent = Simulator::Schedule (m_phy->GetDelayUntilIdle (), &DmgStaWifiMac::Doze, this);
+      return;
+    }
+  NS_LOG_DEBUG ("DMG STA " << GetAddress () << " enters doze state at " << Simulator::Now ());
+  m_phy->SetSleepMode ();
+  m_dozeStateChanged (GetAddress (), true);
+}
+
+void
+DmgStaWifiMac::WakeUp (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_dozeEvent.Cancel ();
+  if (m_phy->IsStateSleep ())
+    {
+      NS_LOG_DEBUG ("DMG STA " << GetAddress () << " enters awake state at " << Simulator::Now ());
+      m_phy->ResumeFromSleep ();
+      m_dozeStateChanged (GetAddress (), false);
+    }
+}
+
+Ptr<WakeupScheduleElement>
+DmgStaWifiMac::GetWakeupScheduleElement (void) const
+{
+  Ptr<WakeupScheduleElement> element = Create<WakeupScheduleElement> ();
+  element->SetBiStartTime ((m_biStartTime + m_beaconInterval).GetMicroSeconds ());
+  element->SetSleepCycle (m_sleepCycle);
+  element->SetNumberOfAwakeDozeBIs (m_awakeBIs);
+  return element;
 }
 
 void
@@ -910,6 +1387,171 @@ DmgStaWifiMac::RegisterRelaySelectorFunction (ChannelMeasurementCallback callbac
   m_channelMeasurementCallback = callback;
 }
 
+uint8_t
+DmgStaWifiMac::SelectRelay (ChannelMeasurementInfoList rdsMeasurements, ChannelMeasurementInfoList dstRedsMeasurements,
+                            Mac48Address &rdsAddress)
+{
+  NS_LOG_FUNCTION (this << m_relaySelectionPolicy);
+  /* The measurements reported by the RDSs are indexed by the AID of the reporting RDS */
+  std::map<uint16_t, double> firstHop;
+  for (ChannelMeasurementInfoList::const_iterator iter = rdsMeasurements.begin (); iter != rdsMeasurements.end (); iter++)
+    {
+      firstHop[(*iter)->GetPeerStaAid ()] = (*iter)->GetSnrDb ();
+    }
+
+  uint16_t selectedAid = 0;
+  double bestMetric = -std::numeric_limits<double>::max ();
+  for (ChannelMeasurementInfoList::const_iterator iter = dstRedsMeasurements.begin (); iter != dstRedsMeasurements.end (); iter++)
+    {
+      uint16_t relayAid = (*iter)->GetPeerStaAid ();
+      std::map<uint16_t, double>::const_iterator hop = firstHop.find (relayAid);
+      if ((hop == firstHop.end ()) || (m_rdsList.find (relayAid) == m_rdsList.end ()))
+        {
+          /* We need the measurements of both hops to evaluate an RDS */
+          continue;
+        }
+
+      double metric;
+      double secondHopSnr = (*iter)->GetSnrDb ();
+      RelayDuplexMode duplex = m_rdsList[relayAid].GetDuplex ();
+      switch (m_relaySelectionPolicy)
+        {
+        case RELAY_SELECTION_MAX_CAPACITY:
+          metric = GetRelayLinkCapacity (hop->second, secondHopSnr, duplex);
+          break;
+        case RELAY_SELECTION_LOAD_AWARE:
+          metric = GetRelayLinkCapacity (hop->second, secondHopSnr, duplex) / (1 + GetRelayLoad (relayAid));
+          break;
+        case RELAY_SELECTION_MAX_MIN_SNR:
+        default:
+          metric = std::min (hop->second, secondHopSnr);
+          break;
+        }
+
+      NS_LOG_DEBUG ("RDS AID=" << relayAid << ", FirstHopSnr=" << hop->second << " dB, SecondHopSnr="
+                    << secondHopSnr << " dB, Metric=" << metric);
+      if (metric > bestMetric)
+        {
+          bestMetric = metric;
+          selectedAid = relayAid;
+        }
+    }
+
+  NS_ASSERT_MSG (selectedAid != 0, "No RDS has been reported by both the RDSs and the destination REDS");
+  rdsAddress = m_aidMap[selectedAid];
+  return selectedAid;
+}
+
+double
+DmgStaWifiMac::GetRelayLinkCapacity (double firstHopSnr, double secondHopSnr, RelayDuplexMode duplex) const
+{
+  double snr1 = std::pow (10.0, firstHopSnr / 10.0);
+  double snr2 = std::pow (10.0, secondHopSnr / 10.0);
+  if (duplex == RELAY_FD_AF)
+    {
+      /* The RDS amplifies the received signal, so the noise of the first hop is forwarded as well */
+      return std::log (1 + snr1 * snr2 / (snr1 + snr2 + 1)) / std::log (2.0);
+    }
+  else
+    {
+      /* The RDS decodes and forwards the frame, so the two hops share the allocation time */
+      double c1 = std::log (1 + snr1) / std::log (2.0);
+      double c2 = std::log (1 + snr2) / std::log (2.0);
+      return (c1 * c2) / (c1 + c2);
+    }
+}
+
+uint32_t
+DmgStaWifiMac::GetRelayLoad (uint16_t relayAid) const
+{
+  uint32_t load = 0;
+  for (RELAY_LINK_MAP::const_iterator iter = m_relayLinkMap.begin (); iter != m_relayLinkMap.end (); iter++)
+    {
+      if (iter->second.selectedRelayAid == relayAid)
+        {
+          load++;
+        }
+    }
+  return load;
+}
+
+void
+DmgStaWifiMac::MacRxOk (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  RegularWifiMac::MacRxOk (address);
+  if (m_automaticLinkSwitching)
+    {
+      double snr = 10 * std::log10 (m_stationManager->GetRxSnr ());
+      LinkQualityMap::iterator it = m_linkQuality.find (address);
+      if (it == m_linkQuality.end ())
+        {
+          m_linkQuality[address] = snr;
+        }
+      else
+        {
+          it->second = m_linkSnrSmoothingFactor * snr + (1 - m_linkSnrSmoothingFactor) * it->second;
+        }
+    }
+}
+
+void
+DmgStaWifiMac::EvaluateTransmissionLink (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_automaticLinkSwitching || (m_relayLinkInfo.srcRedsAid != m_aid) || m_relayLinkInfo.switchTransmissionLink)
+    {
+      return;
+    }
+  if (m_relayLinkInfo.transmissionLink == DIRECT_LINK)
+    {
+      /* The destination REDS responds over the direct link, so its frames measure the direct link quality */
+      LinkQualityMap::const_iterator it = m_linkQuality.find (m_relayLinkInfo.dstRedsAddress);
+      if ((it != m_linkQuality.end ()) && (it->second < m_linkSwitchThreshold))
+        {
+          NS_LOG_DEBUG ("Direct link SNR=" << it->second << " dB is below the threshold, so switch to the relay link");
+          RequestTransmissionLinkSwitch ();
+        }
+    }
+  else
+    {
+      /* While using the relay link, the direct link is only measured by beamforming training */
+      double snr = 0;
+      STATION_SNR_PAIR_MAP::const_iterator it = m_stationSnrMap.find (m_relayLinkInfo.dstRedsAddress);
+      if ((it != m_stationSnrMap.end ()) && !it->second.first.empty ())
+        {
+          GetBestAntennaConfiguration (m_relayLinkInfo.dstRedsAddress, true, snr);
+          snr = 10 * std::log10 (snr);
+          if (snr > m_linkSwitchThreshold + m_linkSwitchHysteresis)
+            {
+              NS_LOG_DEBUG ("Direct link SNR=" << snr << " dB has recovered, so switch back to the direct link");
+              m_linkQuality.erase (m_relayLinkInfo.dstRedsAddress);
+              RequestTransmissionLinkSwitch ();
+            }
+        }
+    }
+}
+
+void
+DmgStaWifiMac::RequestTransmissionLinkSwitch (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_relayLinkInfo.switchTransmissionLink)
+    {
+      m_relayLinkInfo.switchTransmissionLink = true;
+      m_relayLinkInfo.switchRequestTime = Simulator::Now ();
+    }
+}
+
+void
+DmgStaWifiMac::ChangeTransmissionLink (TransmissionLink link)
+{
+  NS_LOG_FUNCTION (this << link);
+  m_relayLinkInfo.transmissionLink = link;
+  m_transmissionLinkChanged (GetAddress (), link);
+  m_linkSwitchLatency (GetAddress (), link, Simulator::Now () - m_relayLinkInfo.switchRequestTime);
+}
+
 void
 DmgStaWifiMac::RelayLinkChangeIntervalTimeout (void)
 {
@@ -927,6 +1569,7 @@ DmgStaWifiMac::RelayLinkChangeIntervalTimeout (void)
           if (m_relayLinkInfo.dstRedsAid == m_aid)
             {
               m_relayDataExchanged = false;
+              m_relayLinkInfo.switchRequestTime = Simulator::Now ();
 
               /* Schedule Data Sensing Timeout to detect missing frame transmission */
               Simulator::Schedule (MicroSeconds (m_relayLinkInfo.relayDataSensingTime),
@@ -940,17 +1583,22 @@ DmgStaWifiMac::RelayLinkChangeIntervalTimeout (void)
               m_relayLinkInfo.switchTransmissionLink = false;
               if (m_relayLinkInfo.transmissionLink == DIRECT_LINK)
                 {
-                  m_relayLinkInfo.transmissionLink = RELAY_LINK;
+                  ChangeTransmissionLink (RELAY_LINK);
+                  SteerAntennaToward (m_relayLinkInfo.selectedRelayAddress);
                 }
               else
                 {
-                  m_relayLinkInfo.transmissionLink = RELAY_LINK;
+                  ChangeTransmissionLink (DIRECT_LINK);
+                  SteerAntennaToward (m_relayLinkInfo.dstRedsAddress);
                 }
-              m_transmissionLinkChanged (GetAddress (), m_relayLinkInfo.transmissionLink);
-              SteerAntennaToward (m_relayLinkInfo.selectedRelayAddress);
               Simulator::Schedule (MicroSeconds (m_relayLinkInfo.relayDataSensingTime),
                                    &DmgStaWifiMac::ResumeServicePeriodTransmission, this);
             }
+          else if (m_relayLinkInfo.srcRedsAid == m_aid)
+            {
+              /* Decide whether to change the link at the start of the following Link Change Interval */
+              EvaluateTransmissionLink ();
+            }
         }
     }
 }
@@ -1008,7 +1656,7 @@ DmgStaWifiMac::MissedAck (const WifiMacHeader &hdr)
        * expected ACK frame or BA frame from the destination REDS during a Link Change Interval period, the
        * source REDS should change the link used for frame transmission at the start of the following Link Change
        * Interval period and use the RDS to forward frames to the destination REDS. */
-      m_relayLinkInfo.switchTransmissionLink = true;
+      RequestTransmissionLinkSwitch ();
       SuspendServicePeriodTransmission ();
     }
 }
@@ -1031,16 +1679,15 @@ DmgStaWifiMac::RelayDataSensingTimeout (void)
                * link in the next Link Change Interval period even if it does not receive a frame during the Data Sensing
                * Time. An example of frame transfer under Normal mode with FD-AF RDS is illustrated in Figure 9-77. */
               NS_LOG_DEBUG ("Destinations REDS did not receive frames during data sensing interval so switch to the relay link");
-              m_relayLinkInfo.transmissionLink = RELAY_LINK;
+              ChangeTransmissionLink (RELAY_LINK);
               SteerAntennaToward (m_relayLinkInfo.selectedRelayAddress);
             }
           else
             {
               NS_LOG_DEBUG ("Destinations REDS did not receive frames during data sensing interval so switch to the direct link");
-              m_relayLinkInfo.transmissionLink = DIRECT_LINK;
+              ChangeTransmissionLink (DIRECT_LINK);
               SteerAntennaToward (m_relayLinkInfo.srcRedsAddress);
             }
-          m_transmissionLinkChanged (GetAddress (), m_relayLinkInfo.transmissionLink);
         }
     }
 }
@@ -1056,7 +1703,7 @@ DmgStaWifiMac::SwitchTransmissionLink (uint8_t srcAid, uint8_t dstAid)
       /* Check if we are currently in a service period being protected by an RDS */
       if (m_periodProtected && (srcAid == m_relayLinkInfo.srcRedsAid) && (dstAid == m_relayLinkInfo.dstRedsAid))
         {
-          m_relayLinkInfo.switchTransmissionLink = true;
+          RequestTransmissionLinkSwitch ();
         }
       else
         {
@@ -1411,6 +2058,45 @@ DmgStaWifiMac::SendSswFbckFrame (Mac48Address receiver)
                             MakeCallback (&DmgStaWifiMac::FrameTxOk, this));
 }
 
+void
+DmgStaWifiMac::SendSprFrame (Mac48Address to)
+{
+  NS_LOG_FUNCTION (this << to);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_CTL_DMG_SPR);
+  hdr.SetAddr1 (to);              // Receiver.
+  hdr.SetAddr2 (GetAddress ());   // Transmiter.
+
+  /* Report the airtime of the frames buffered for the PCP/AP at our current data rate */
+  uint32_t nBytes = m_edca.find (AC_BE)->second->GetEdcaQueue ()->GetNBytesForReceiver (to);
+  uint64_t duration = 0;
+  if (nBytes > 0)
+    {
+      WifiMacHeader dataHdr;
+      dataHdr.SetType (WIFI_MAC_QOSDATA);
+      dataHdr.SetAddr1 (to);
+      Ptr<Packet> dataPacket = Create<Packet> ();
+      m_stationManager->PrepareForQueue (to, &dataHdr, dataPacket);
+      WifiTxVector txVector = m_stationManager->GetDataTxVector (to, &dataHdr, dataPacket);
+      duration = std::ceil (nBytes * 8.0 * 1e6 / txVector.GetMode ().GetDataRate ());
+    }
+
+  Dynamic_Allocation_Info_Field info;
+  info.SetTID (AC_BE);
+  info.SetAllocationType (SERVICE_PERIOD_ALLOCATION);
+  info.SetSourceAID (m_aid);
+  info.SetDestinationAID (AID_AP);
+  info.SetAllocationDuration (std::min<uint64_t> (duration, 65535));
+
+  CtrlDMG_SPR spr;
+  spr.SetDynamicAllocationInfo (info);
+  Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (spr);
+
+  NS_LOG_INFO ("Sending SPR Frame to " << to << " for " << duration << " us at " << Simulator::Now ());
+  m_dmgAtiDca->Queue (packet, hdr);
+}
+
 void
 DmgStaWifiMac::SendSswAckFrame (Mac48Address receiver)
 {
@@ -1974,17 +2660,15 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                 /* Prepare the Channel Report */
                 ChannelMeasurementInfoList list;
                 Ptr<ExtChannelMeasurementInfo> elem;
-                double measuredsnr;
-                uint8_t snr;
+                double measuredsnr = 0;
                 if (m_rdsActivated)
                   {
                     /** We are the RDS and we received the request from the source REDS **/
                     /* Obtain Channel Measurement between the source REDS and RDS */
                     GetBestAntennaConfiguration (hdr->GetAddr2 (), true, measuredsnr);
-                    snr = -(unsigned int) (4 * (measuredsnr - 19));
                     elem = Create<ExtChannelMeasurementInfo> ();
                     elem->SetPeerStaAid (m_macMap[hdr->GetAddr2 ()]);
-                    elem->SetSnr (snr);
+                    elem->SetSnrDb (10 * std::log10 (measuredsnr));
                     list.push_back (elem);
                   }
                 else
@@ -1996,10 +2680,9 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                     for (RelayCapableStaList::iterator iter = m_rdsList.begin (); iter != m_rdsList.end (); iter++)
                       {
                         elem = Create<ExtChannelMeasurementInfo> ();
-                        GetBestAntennaConfiguration (hdr->GetAddr2 (), true, measuredsnr);
-                        snr = -(unsigned int) (4 * (measuredsnr - 19));
+                        GetBestAntennaConfiguration (m_aidMap[iter->first], true, measuredsnr);
                         elem->SetPeerStaAid (iter->first);
-                        elem->SetSnr (snr);
+                        elem->SetSnrDb (10 * std::log10 (measuredsnr));
                         list.push_back (elem);
                       }
                   }
@@ -2012,7 +2695,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                   {
                     ExtMultiRelayChannelMeasurementReport responseHdr;
                     packet->RemoveHeader (responseHdr);
-                    if (!m_relayLinkInfo.waitingDestinationRedsReports)
+                    if (hdr->GetAddr2 () != m_relayLinkInfo.dstRedsAddress)
                       {
                         /* Perform BF with the destination REDS, currently this is done by invoking a callback function
                          * to the main program. The main program schedules manually a service period between the source REDS
@@ -2020,8 +2703,14 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
 
                         /* Send Multi-Relay Channel Measurement Request to the Destination REDS */
                         m_relayLinkInfo.waitingDestinationRedsReports = true;
-                        /* Store the measurement values between the source REDS and the RDS */
-                        m_channelMeasurementList = responseHdr.GetChannelMeasurementInfoList ();
+                        /* Store the measurement values between the source REDS and the RDS, the RDS reports the link
+                         * towards us, so we index its measurement by the AID of the reporting RDS */
+                        ChannelMeasurementInfoList list = responseHdr.GetChannelMeasurementInfoList ();
+                        for (ChannelMeasurementInfoList::iterator iter = list.begin (); iter != list.end (); iter++)
+                          {
+                            (*iter)->SetPeerStaAid (m_macMap[hdr->GetAddr2 ()]);
+                            m_channelMeasurementList.push_back (*iter);
+                          }
                       }
                     else
                       {
@@ -2031,14 +2720,21 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                          * 2. Between Destination REDS and zero or more RDS.
                          * The Source REDS shall select on of the previous RDS.
                          */
-
-                        /* Report the measurements to the user to decide relay selection */
-                        m_relayLinkInfo.selectedRelayAid = m_channelMeasurementCallback (m_channelMeasurementList,
-                                                                                         responseHdr.GetChannelMeasurementInfoList (),
-                                                                                         m_relayLinkInfo.selectedRelayAddress);
-
+                        if ((m_relaySelectionPolicy == RELAY_SELECTION_USER_CALLBACK) || !m_channelMeasurementCallback.IsNull ())
+                          {
+                            /* Report the measurements to the user to decide relay selection */
+                            m_relayLinkInfo.selectedRelayAid = m_channelMeasurementCallback (m_channelMeasurementList,
+                                                                                             responseHdr.GetChannelMeasurementInfoList (),
+                                                                                             m_relayLinkInfo.selectedRelayAddress);
+                          }
+                        else
+                          {
+                            m_relayLinkInfo.selectedRelayAid = SelectRelay (m_channelMeasurementList,
+                                                                            responseHdr.GetChannelMeasurementInfoList (),
+                                                                            m_relayLinkInfo.selectedRelayAddress);
+                          }
                         m_relayLinkInfo.rdsCapabilitiesInfo = m_rdsList[m_relayLinkInfo.selectedRelayAid];
-
+                        m_channelMeasurementList.clear ();
                       }
                     m_channelReportReceived (hdr->GetAddr2 ());
                   }
@@ -2181,6 +2877,15 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
           return;
         }
     }
+  else if (hdr->IsPollFrame ())
+    {
+      /* The PCP/AP polls its DMG STAs for their SP requests during the ATI */
+      if (IsAssociated () && (hdr->GetAddr2 () == GetBssid ()) && (m_accessPeriod == CHANNEL_ACCESS_ATI))
+        {
+          SendSprFrame (hdr->GetAddr2 ());
+        }
+      return;
+    }
   else if (hdr->IsSSW ())
     {
       CtrlDMG_SSW sswFrame;
@@ -2267,6 +2972,12 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
           m_slotIndex = 0;
           m_failedRssAttemptsCounter = 0;
           m_sswFbckTimeout.Cancel ();
+          if (m_abftAttempts > 0)
+            {
+              m_abftCompletedTrace (hdr->GetAddr2 (), Simulator::Now () - m_abftContentionStart, m_abftAttempts);
+              m_abftAttempts = 0;
+            }
+          m_abftCompleted = true;
         }
       else if (m_accessPeriod == CHANNEL_ACCESS_DTI)
         {
@@ -2314,6 +3025,27 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
         {
           goodBeacon = true;
         }
+      /* A DMG Beacon deferred past its BTI by an overlapping BSS comes too late to follow its BI */
+      if (MicroSeconds (beacon.GetTimestamp ()) + hdr->GetDuration () + GetMbifs () < Simulator::Now ())
+        {
+          goodBeacon = false;
+        }
+
+      if (goodBeacon && (m_state == ASSOCIATED) && (hdr->GetAddr1 () != GetBssid ()))
+        {
+          /* Follow the PCP that announces it took over the PBSS of ours, ignore the other PBSSs */
+          Ptr<PcpHandoverElement> handoverElement
+              = StaticCast<PcpHandoverElement> (beacon.GetInformationElement (IE_PCP_HANDOVER));
+          if ((handoverElement != 0) && (handoverElement->GetOldBssID () == GetBssid ())
+              && (handoverElement->GetNewPcpAddress () == hdr->GetAddr1 ()))
+            {
+              FollowPcpHandover (hdr->GetAddr1 ());
+            }
+          else
+            {
+              goodBeacon = false;
+            }
+        }
 
       if (goodBeacon)
         {
@@ -2323,9 +3055,11 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
               m_receivedDmgBeacon = true;
               m_stationSnrMap.erase (hdr->GetAddr1 ());
 
-              if ((m_state == ASSOCIATED) && (beacon.GetBSSID () == GetBssid ()))
+              if ((m_state == ASSOCIATED) && (hdr->GetAddr1 () == GetBssid ()))
                 {
-                  Time delay = MicroSeconds (beacon.GetBeaconIntervalUs () * m_maxLostBeacons);
+                  /* We do not listen to the DMG Beacons during the doze BIs of our wakeup schedule */
+                  uint32_t dozeBIs = (m_powerSave ? m_sleepCycle - std::min (m_awakeBIs, m_sleepCycle) : 0);
+                  Time delay = MicroSeconds (beacon.GetBeaconIntervalUs () * (m_maxLostBeacons + dozeBIs));
                   RestartBeaconWatchdog (delay);
                 }
 
@@ -2336,6 +3070,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
               m_nextAbft = beaconInterval.GetNextABFT ();
               m_nBI = beaconInterval.GetN_BI ();
               m_ssSlotsPerABFT = beaconInterval.GetABFT_Length ();
+              m_abftMultiplier = beaconInterval.GetABFT_Multiplier ();
               m_ssFramesPerSlot = beaconInterval.GetFSS ();
               m_isResponderTXSS = beaconInterval.IsResponderTXSS ();
 
@@ -2352,8 +3087,13 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
               Ptr<NextDmgAti> atiElement = StaticCast<NextDmgAti> (beacon.GetInformationElement (IE_NEXT_DMG_ATI));
               m_atiDuration = MicroSeconds (atiElement->GetAtiDuration ());
 
+              /* Awake Window Element */
+              Ptr<AwakeWindowElement> awakeElement
+                  = StaticCast<AwakeWindowElement> (beacon.GetInformationElement (IE_AWAKE_WINDOW));
+              m_awakeWindow = (awakeElement != 0) ? MicroSeconds (awakeElement->GetAwakeWindow ()) : Seconds (0);
+
               /* Organizing medium access periods (Synchronization with TSF) */
-              m_abftDuration = NanoSeconds (m_ssSlotsPerABFT * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot));
+              m_abftDuration = NanoSeconds (m_ssSlotsPerABFT * (1 + m_abftMultiplier) * m_low->GetSectorSweepSlotTime (m_ssFramesPerSlot));
               m_abftDuration = MicroSeconds (ceil ((double) m_abftDuration.GetNanoSeconds () / 1000));
               m_btiDuration = MicroSeconds (operationElement->GetMinBHIDuration ()) - m_abftDuration - m_atiDuration - 2 * GetMbifs ();
               m_biStartTime = MicroSeconds (beacon.GetTimestamp ()) + hdr->GetDuration () - m_btiDuration;
@@ -2366,7 +3106,12 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                             << ", HDR-Duration=" << hdr->GetDuration ().As (Time::US)
                             << ", FrameDuration=" << m_phy->GetLastRxDuration ());
 
-              if (!beaconInterval.IsCCPresent () && !beaconInterval.IsDiscoveryMode ())
+              if (m_biClock != 0)
+                {
+                  /* The beacon interval clock of the PCP/AP starts the following access periods */
+                  SetBssid (hdr->GetAddr1 ());
+                }
+              else if (!beaconInterval.IsDiscoveryMode ())
                 {
                   Time startTime = m_btiDuration + m_mbifs - (Simulator::Now () - m_biStartTime);
                   if (m_nextAbft == 0)
@@ -2374,7 +3119,6 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                       /* Schedule A-BFT following the end of the BTI Period */
                       SetBssid (hdr->GetAddr1 ());
                       m_slotIndex = 0;
-                      m_remainingSlotsPerABFT = m_ssSlotsPerABFT;
                       m_abftEvent = Simulator::Schedule (startTime, &DmgStaWifiMac::StartAssociationBeamformTraining, this);
                       NS_LOG_DEBUG ("A-BFT Period for Station=" << GetAddress () << " is scheduled at " << Simulator::Now () + startTime);
                     }
@@ -2406,6 +3150,15 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                 {
                   m_allocationList = scheduleElement->GetAllocationFieldList ();
                 }
+              m_quietPeriods.clear ();
+              for (AllocationFieldList::const_iterator iter = m_allocationList.begin ();
+                   iter != m_allocationList.end (); iter++)
+                {
+                  if (IsQuietPeriod (*iter))
+                    {
+                      m_quietPeriods.push_back (*iter);
+                    }
+                }
             }
 
           /* Sector Sweep Field */
@@ -2453,8 +3206,17 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
           if (assocResp.GetStatusCode ().IsSuccess ())
             {
               m_aid = assocResp.GetAid ();
+              /* SPs toward the PCP/AP carry its AID as destination */
+              MapAidToMacAddress (AID_AP, GetBssid ());
               SetState (ASSOCIATED);
+              /* Our wakeup schedule starts with the next BI */
+              m_wakeupScheduleStart = m_biCounter + 1;
               NS_LOG_DEBUG ("Association completed with " << hdr->GetAddr1 ());
+              if ((m_lostBssid != Mac48Address ()) && (m_lostBssid != GetBssid ()))
+                {
+                  RedirectPendingFrames (m_lostBssid);
+                }
+              m_lostBssid = Mac48Address ();
               if (!m_linkUp.IsNull ())
                 {
                   m_linkUp ();
@@ -7,6 +7,8 @@
 #define DMG_STA_WIFI_MAC_H
 
 #include "dmg-wifi-mac.h"
+#include "dmg-beacon-interval-clock.h"
+#include <set>
 
 #include "ns3/event-id.h"
 #include "ns3/packet.h"
@@ -25,12 +27,34 @@ typedef enum {
   RELAY_LINK = 1
 } TransmissionLink;
 
+/**
+ * Built-in policies used by the source REDS to select an RDS once the channel
+ * measurement reports from both the RDSs and the destination REDS are available.
+ */
+typedef enum {
+  RELAY_SELECTION_USER_CALLBACK = 0,  //!< Delegate the selection to the registered relay selector function.
+  RELAY_SELECTION_MAX_MIN_SNR,        //!< Select the RDS which maximizes the weakest hop SNR.
+  RELAY_SELECTION_MAX_CAPACITY,       //!< Select the RDS which maximizes the end-to-end capacity.
+  RELAY_SELECTION_LOAD_AWARE          //!< Maximize the end-to-end capacity shared among the relay links of the RDS.
+} RelaySelectionPolicy;
+
+/**
+ * Strategies used by a DMG STA to select the SSW slot in which it performs
+ * the responder sector sweep during the A-BFT.
+ */
+typedef enum {
+  ABFT_SLOT_UNIFORM = 0,              //!< Select a slot uniformly at random among the remaining slots (802.11ad).
+  ABFT_SLOT_ADDRESS_HASHED,           //!< Derive the first attempt slot from the MAC address, retries are uniform.
+  ABFT_SLOT_ADAPTIVE                  //!< Uniform slot, but contend in an A-BFT with a probability halved at each failure.
+} AbftSlotSelection;
+
 typedef struct {
   bool relayForwardingActivated;              //!< Flag to indicate if a relay link has been aactivated.
   bool relayLinkEstablished;                  //!< Flag to indicate if a relay link has been established.
   bool rdsDuplexMode;                         //!< The duplex mode of the RDS.
   bool waitingDestinationRedsReports;         //!< Flag to indicate that we are waiting for the destination REDS report.
   bool switchTransmissionLink;                //!< Flag to indicate that we want to change the current transmission link.
+  Time switchRequestTime;                     //!< The time at which the link switch has been decided.
 
   uint8_t relayLinkChangeInterval;            //!< Relay Link Change Interval reported by the source REDS (MicroSeconds).
   uint8_t relayDataSensingTime;               //!< Relay Data Sensing Time reported by the source REDS (MicroSeconds).
@@ -154,10 +178,20 @@ public:
    */
   void SendChannelMeasurementRequest (Mac48Address to, uint8_t token);
   /**
-   * RegisterRelaySelectorFunction
-   * \param callback
+   * Register a user defined relay selector. The callback takes precedence over the
+   * built-in relay selection policies.
+   * \param callback The relay selector function.
    */
   void RegisterRelaySelectorFunction (ChannelMeasurementCallback callback);
+  /**
+   * Select an RDS using the configured built-in relay selection policy.
+   * \param rdsMeasurements The channel measurements between the source REDS and each RDS.
+   * \param dstRedsMeasurements The channel measurements between the destination REDS and each RDS.
+   * \param rdsAddress The MAC address of the selected RDS.
+   * \return The AID of the selected RDS.
+   */
+  uint8_t SelectRelay (ChannelMeasurementInfoList rdsMeasurements, ChannelMeasurementInfoList dstRedsMeasurements,
+                       Mac48Address &rdsAddress);
   /**
    * Switch transmission link for a specific service period to an alternative path.
    * \param srcAid The AID of the source DMG STA.
@@ -261,11 +295,69 @@ protected:
    * Do Association Beamforming Training in the A-BFT period.
    */
   void DoAssociationBeamformingTraining (void);
+  /**
+   * Select the A-BFT SSW slot for the next responder sector sweep according to the slot selection strategy.
+   * \param firstSlot The first eligible slot index in the A-BFT.
+   * \param lastSlot The last eligible slot index in the A-BFT.
+   * \return The index of the selected slot in the A-BFT.
+   */
+  uint8_t SelectAbftSlot (uint8_t firstSlot, uint8_t lastSlot);
   /**
    * Add new data forwarding entry.
    * \param nextHopAddress The MAC Address of the next hop.
    */
   void AddForwardingEntry (Mac48Address nextHopAddress);
+  /**
+   * Follow the access periods of the BI from the beacon interval clock of the PCP/AP.
+   * \param phase The phase of the BI that starts.
+   * \param field The allocation that starts or ends in the DTI.
+   */
+  void BeaconIntervalPhaseChanged (BeaconIntervalPhase phase, const AllocationField &field);
+  /**
+   * Stop following the beacon interval clock of the PCP/AP and schedule our own BIs again.
+   */
+  void LeaveBeaconIntervalClock (void);
+  /**
+   * Move to the PCP that took over the PBSS of our PCP, we keep our association and AID.
+   * \param newPcp The MAC address of the new PCP.
+   */
+  void FollowPcpHandover (Mac48Address newPcp);
+  /**
+   * Send our pending frames for the old PCP/AP to the PCP/AP we are associated with now.
+   * \param oldBssid The BSSID of the old PCP/AP.
+   */
+  void RedirectPendingFrames (Mac48Address oldBssid);
+  /**
+   * \param field The allocation announced in the Extended Schedule element.
+   * \return True if we have to start or end any access period in this allocation.
+   */
+  bool IsAllocationOfInterest (const AllocationField &field) const;
+  /**
+   * \return True if we are associated and in power save mode.
+   */
+  bool IsPowerSaving (void) const;
+  /**
+   * Put the PHY in the doze (sleep) state once the ongoing frame exchange is over.
+   */
+  void Doze (void);
+  /**
+   * Bring the PHY back to the awake state if it is dozing.
+   */
+  void WakeUp (void);
+  /**
+   * \return The Wakeup Schedule element describing our awake and doze BIs.
+   */
+  Ptr<WakeupScheduleElement> GetWakeupScheduleElement (void) const;
+  /**
+   * Start the access periods of an allocation in the DTI.
+   * \param field The allocation announced in the Extended Schedule element.
+   */
+  void StartAllocation (AllocationField field);
+  /**
+   * End the access periods started at the beginning of an allocation.
+   * \param field The allocation announced in the Extended Schedule element.
+   */
+  void EndAllocation (AllocationField field);
   /**
    * Send Relay Search Request.
    * \param token The dialog token.
@@ -328,6 +420,39 @@ protected:
    * Relay Operation Timeout.
    */
   void RelayOperationTimeout (void);
+  /**
+   * Calculate the end-to-end capacity of a two-hop relay link.
+   * \param firstHopSnr The SNR between the source REDS and the RDS in dB.
+   * \param secondHopSnr The SNR between the RDS and the destination REDS in dB.
+   * \param duplex The duplex mode of the RDS.
+   * \return The end-to-end capacity in bit/s/Hz.
+   */
+  double GetRelayLinkCapacity (double firstHopSnr, double secondHopSnr, RelayDuplexMode duplex) const;
+  /**
+   * Get the number of relay links for which a specific RDS has been selected.
+   * \param relayAid The AID of the RDS.
+   * \return The number of relay links.
+   */
+  uint32_t GetRelayLoad (uint16_t relayAid) const;
+  /**
+   * Evaluate the quality of the direct link at the start of a Link Change Interval and
+   * decide whether the source REDS should switch its transmission link.
+   */
+  void EvaluateTransmissionLink (void);
+  /**
+   * Change the current transmission link of the relay link being served.
+   * \param link The new transmission link.
+   */
+  void ChangeTransmissionLink (TransmissionLink link);
+  /**
+   * Request a transmission link change at the start of the following Link Change Interval.
+   */
+  void RequestTransmissionLinkSwitch (void);
+  /**
+   * Update the link quality towards a peer station upon a successfully received frame.
+   * \param address The MAC address of the peer station.
+   */
+  virtual void MacRxOk (Mac48Address address);
 
 private:
   /**
@@ -354,6 +479,12 @@ private:
    * queue for management frames if QoS is supported. We always use the DCF.
    */
   void SendAssociationRequest (void);
+  /**
+   * Answer the Poll of the PCP/AP during the ATI with an SPR frame, requesting an SP long enough
+   * to send the frames buffered for the PCP/AP.
+   * \param to The MAC address of the PCP/AP.
+   */
+  void SendSprFrame (Mac48Address to);
   /**
    * Try to ensure that we are associated with an AP by taking an appropriate action
    * depending on the current association status.
@@ -484,6 +615,9 @@ private:
 
   TracedCallback<Mac48Address> m_assocLogger;
   TracedCallback<Mac48Address> m_deAssocLogger;
+  TracedCallback<Mac48Address> m_beaconMissed;  //!< Trace callback for losing the DMG Beacons of the PCP/AP.
+  TracedCallback<Mac48Address> m_pcpHandover;   //!< Trace callback for following the new PCP of our PBSS.
+  Mac48Address m_lostBssid;                     //!< The BSSID of the PCP/AP whose DMG Beacons we missed.
 
   bool m_moreData;                              //! More data field in the last received Data Frame to indicate that the STA
                                                 //! has MSDUs or A-MSDUs buffered for transmission to the frame’s recipient
@@ -501,8 +635,13 @@ private:
   Ptr<UniformRandomVariable> a_bftSlot;         //!< Random variable for A-BFT slot.
   bool    m_isIssInitiator;                     //!< Flag to indicate that we are ISS.
   EventId m_rssEvent;                           //!< Event related to scheduling
-  uint8_t m_remainingSlotsPerABFT;              //!< Remaining Slots in the current A-BFT.
-  uint8_t m_slotOffset;                         //!< Variable used to print the correct slot selected.
+  uint8_t m_abftMultiplier;                     //!< The number of secondary A-BFTs announced by the PCP/AP (802.11ay).
+  uint8_t m_slotOffset;                         //!< The index of the first slot we can still access in the current A-BFT.
+  AbftSlotSelection m_abftSlotSelection;        //!< The strategy to select the A-BFT SSW slot.
+  bool m_repeatAbft;                            //!< Flag to indicate whether we keep performing RSS after a successful A-BFT.
+  bool m_abftCompleted;                         //!< Flag to indicate that we received SSW-FBCK from the PCP/AP in an A-BFT.
+  Time m_abftContentionStart;                   //!< The time of our first RSS attempt towards the PCP/AP.
+  uint32_t m_abftAttempts;                      //!< The number of RSS attempts since the first one towards the PCP/AP.
   Time m_sswFbckDuration;                       //!< The duration in the SSW-FBCK Field.
 
   uint32_t m_failedRssAttemptsCounter;          //!< Counter for Failed RSS Attempts during A-BFT.
@@ -511,6 +650,68 @@ private:
   uint32_t m_rssBackoffLimit;                   //!< Maximum RSS Backoff value.
   Ptr<UniformRandomVariable> m_rssBackoffVariable;//!< Random variable for the RSS Backoff value.
 
+  /**
+   * TracedCallback signature for A-BFT slot events.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param slotIndex The index of the SSW slot within the A-BFT.
+   * \param failedAttempts The current value of the FailedRSSAttempts counter.
+   */
+  typedef void (* AbftSlotCallback)(Mac48Address address, uint8_t slotIndex, uint32_t failedAttempts);
+  /**
+   * TracedCallback signature for entering the RSS backoff.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param backoff The number of A-BFTs we skip.
+   */
+  typedef void (* RssBackoffCallback)(Mac48Address address, uint32_t backoff);
+  /**
+   * TracedCallback signature for the completion of the association beamforming training.
+   *
+   * \param address The MAC address of the PCP/AP.
+   * \param delay The time elapsed since our first RSS attempt towards the PCP/AP.
+   * \param attempts The number of RSS attempts it took.
+   */
+  typedef void (* AbftCompletedCallback)(Mac48Address address, Time delay, uint32_t attempts);
+  TracedCallback<Mac48Address, uint8_t, uint32_t> m_rssAttempt;  //!< Trace callback for starting RSS in an A-BFT slot.
+  TracedCallback<Mac48Address, uint8_t, uint32_t> m_rssFailed;   //!< Trace callback for missing the SSW-FBCK in an A-BFT slot.
+  TracedCallback<Mac48Address, uint32_t> m_rssBackoff;           //!< Trace callback for entering the RSS backoff.
+  TracedCallback<Mac48Address, Time, uint32_t> m_abftCompletedTrace; //!< Trace callback for a successful A-BFT.
+
+  /* Beacon Interval Clock */
+  enum AllocationEndAction
+  {
+    END_SERVICE_PERIOD = 1,
+    END_RELAY_PERIODS = 2,
+    RELAY_OPERATION_TIMEOUT = 4,
+    SUSPEND_RDS_OPERATION = 8,
+    END_CONTENTION_PERIOD = 16
+  };
+  typedef std::map<uint32_t, uint8_t> AllocationEndActions;
+  Ptr<DmgBeaconIntervalClock> m_biClock;        //!< The beacon interval clock of the PCP/AP we follow (if any).
+  Time m_lastBiStart;                           //!< The time at which we started the last BI.
+  AllocationEndActions m_allocationEndActions;  //!< The actions to take at the end of the ongoing allocations by start time.
+
+  /* Power Management */
+  bool m_powerSave;                             //!< Flag to indicate whether power save mode is enabled.
+  uint16_t m_sleepCycle;                        //!< The number of BIs in one cycle of the wakeup schedule.
+  uint16_t m_awakeBIs;                          //!< The number of awake BIs at the beginning of each sleep cycle.
+  uint32_t m_biCounter;                         //!< The number of BIs since we started.
+  uint32_t m_wakeupScheduleStart;               //!< The BI at which our wakeup schedule started.
+  bool m_dozeBi;                                //!< Flag to indicate that the current BI is a doze BI.
+  Time m_dtiOffset;                             //!< The offset of the DTI from the start of the last awake BI.
+  Time m_awakeWindow;                           //!< The awake window at the beginning of the DTI announced by the PCP/AP.
+  std::set<uint32_t> m_activeAllocations;       //!< The start times of the ongoing allocations we take part in.
+  EventId m_dozeEvent;                          //!< Event to enter the doze state.
+  /**
+   * TracedCallback signature for doze state changes.
+   *
+   * \param address The MAC address of the DMG STA.
+   * \param dozing True if the DMG STA entered the doze state, false if it woke up.
+   */
+  typedef void (* DozeStateChangedCallback)(Mac48Address address, bool dozing);
+  TracedCallback<Mac48Address, bool> m_dozeStateChanged; //!< Trace callback for doze state changes.
+
   /* DMG Relay Support Variables */
   bool m_relayMode;                             //!< Flag to indicate if we are in relay mode (For RDS).
   bool m_rdsDuplexMode;                         //!< The duplex mode of the RDS.
@@ -525,6 +726,25 @@ private:
 
   ChannelMeasurementInfoList m_channelMeasurementList;    //!< The channel measurement list between the source REDS and the RDS.
   ChannelMeasurementCallback m_channelMeasurementCallback;
+  RelaySelectionPolicy m_relaySelectionPolicy;            //!< The built-in relay selection policy.
+
+  /* Automatic Link Switching */
+  bool m_automaticLinkSwitching;                //!< Flag to indicate whether the source REDS switches links based on the link quality.
+  double m_linkSwitchThreshold;                 //!< The direct link SNR threshold (dB) below which we switch to the relay link.
+  double m_linkSwitchHysteresis;                //!< The SNR margin (dB) above the threshold required to switch back to the direct link.
+  double m_linkSnrSmoothingFactor;              //!< The weight of the latest SNR sample in the link quality average.
+  typedef std::map<Mac48Address, double> LinkQualityMap;
+  LinkQualityMap m_linkQuality;                 //!< Smoothed SNR (dB) of the frames received from each peer station.
+
+  /**
+   * TracedCallback signature for link switch latency.
+   *
+   * \param address The MAC address of the station.
+   * \param link The new transmission link.
+   * \param latency The time elapsed between the switching decision and the actual link change.
+   */
+  typedef void (* LinkSwitchLatencyCallback)(Mac48Address address, TransmissionLink link, Time latency);
+  TracedCallback<Mac48Address, TransmissionLink, Time> m_linkSwitchLatency;
 
   typedef std::map<REDS_PAIR, RELAY_LINK_INFO> RELAY_LINK_MAP;  //!< Typedef to identify relay link information for pair of REDS.
   typedef RELAY_LINK_MAP::iterator RELAY_LINK_MAP_ITERATOR;     //!< Typedef for Ralay Link Map Iterator.
@@ -100,7 +100,8 @@ DmgWifiMac::DmgWifiMac ()
   m_sp->SetTxMiddle (m_txMiddle);
   m_sp->SetTxOkCallback (MakeCallback (&DmgWifiMac::TxOk, this));
   m_sp->SetTxFailedCallback (MakeCallback (&DmgWifiMac::TxFailed, this));
-  m_sp->CompleteConfig ();
+  /* CBAP and SP access share the queue and the block ack agreements of AC_BE */
+  m_sp->SetEdcaTxopN (m_edca.find (AC_BE)->second);
 }
 
 DmgWifiMac::~DmgWifiMac ()
@@ -329,6 +330,11 @@ void
 DmgWifiMac::EndContentionPeriod (void)
 {
   NS_LOG_FUNCTION (this);
+  /* A CBAP ending with the BI is also closed by the start of the next BI, store its transmissions only once */
+  if (!m_dcfManager->IsAccessAllowed ())
+    {
+      return;
+    }
   m_dcfManager->DisableChannelAccess ();
   /* Signal Management DCA to suspend current transmission */
   m_dca->EndCurrentContentionPeriod ();
@@ -344,6 +350,36 @@ DmgWifiMac::EndContentionPeriod (void)
     }
 }
 
+void
+DmgWifiMac::ResumeContentionPeriod (void)
+{
+  NS_LOG_FUNCTION (this);
+  StartContentionPeriod (BROADCAST_CBAP, GetCbapOnlyContentionDuration ());
+}
+
+Time
+DmgWifiMac::GetCbapOnlyContentionDuration (void) const
+{
+  Time now = Simulator::Now ();
+  Time contentionEnd = m_biStartTime + m_beaconInterval;
+  for (AllocationFieldList::const_iterator iter = m_quietPeriods.begin (); iter != m_quietPeriods.end (); iter++)
+    {
+      Time quietStart = m_dtiStartTime + MicroSeconds (iter->GetAllocationStart ());
+      if ((quietStart > now) && (quietStart < contentionEnd))
+        {
+          contentionEnd = quietStart;
+        }
+    }
+  return contentionEnd - now;
+}
+
+bool
+DmgWifiMac::IsQuietPeriod (const AllocationField &field)
+{
+  return ((field.GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
+          && (field.GetSourceAid () == AID_BROADCAST) && (field.GetDestinationAid () == AID_BROADCAST));
+}
+
 void
 DmgWifiMac::StartServicePeriod (AllocationID allocationID, Time length, uint8_t peerAid, Mac48Address peerAddress, bool isSource)
 {
@@ -1061,9 +1097,9 @@ DmgWifiMac::GetBestAntennaConfiguration (const Mac48Address stationAddress, bool
         {
           highIter = iter;
           snr = highIter->second;
-          maxSnr = snr;
         }
     }
+  maxSnr = snr;
   return highIter->first;
 }
 
@@ -304,6 +304,22 @@ protected:
    * End Contention Period.
    */
   void EndContentionPeriod (void);
+  /**
+   * Resume the contention of a CBAP-only DTI at the end of a quiet period.
+   */
+  void ResumeContentionPeriod (void);
+  /**
+   * Get the duration of the contention of a CBAP-only DTI starting now, the contention lasts
+   * until the next quiet period or the end of the BI.
+   * \return The duration of the contention period.
+   */
+  Time GetCbapOnlyContentionDuration (void) const;
+  /**
+   * \param field The allocation field.
+   * \return True if the allocation is an SP with broadcast source and destination AIDs during
+   * which no transmission is allowed in the BSS.
+   */
+  static bool IsQuietPeriod (const AllocationField &field);
   /**
    * Start service  period (SP) allocation period.
    * \param length The length of the allocation period.
@@ -413,6 +429,8 @@ protected:
   Time m_allocationStarted;                     //!< The time we initiated the allocation.
   Time m_currentAllocationLength;               //!< The length of the current allocation period in MicroSeconds.
   AllocationFieldList m_allocationList;         //!< List of access periods allocation in DTI.
+  AllocationFieldList m_quietPeriods;           //!< Quiet periods of the DTI protecting the Beacon SPs of a PCP/AP cluster.
+  Time m_dtiStartTime;                          //!< The start time of the DTI of the current BI.
   uint8_t m_peerStationAid;                     //!< The AID of the peer DMG STA in the current SP.
   Mac48Address m_peerStationAddress;            //!< The MAC address of the peer DMG STA in the current SP.
   Time m_suspendedPeriodDuration;               //!< The remaining duration of the suspended SP.
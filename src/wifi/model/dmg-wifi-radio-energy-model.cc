@@ -0,0 +1,262 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015, 2016 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "directional-antenna.h"
+#include "dmg-wifi-radio-energy-model.h"
+#include "wifi-mac-header.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgWifiRadioEnergyModel");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgWifiRadioEnergyModel);
+
+TypeId
+DmgWifiRadioEnergyModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgWifiRadioEnergyModel")
+    .SetParent<WifiRadioEnergyModel> ()
+    .SetGroupName ("Energy")
+    .AddConstructor<DmgWifiRadioEnergyModel> ()
+    .AddAttribute ("BeamSweepingCurrentA",
+                   "The radio current in Ampere while transmitting or receiving DMG Beacons and SSW frames.",
+                   DoubleValue (0.450),
+                   MakeDoubleAccessor (&DmgWifiRadioEnergyModel::SetBeamSweepingCurrentA,
+                                       &DmgWifiRadioEnergyModel::GetBeamSweepingCurrentA),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("TrnRxCurrentA",
+                   "The radio current in Ampere while receiving the TRN fields of BRP packets.",
+                   DoubleValue (0.400),
+                   MakeDoubleAccessor (&DmgWifiRadioEnergyModel::SetTrnRxCurrentA,
+                                       &DmgWifiRadioEnergyModel::GetTrnRxCurrentA),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("RfChainSwitchingCurrentA",
+                   "The additional radio current in Ampere while switching to another DMG antenna.",
+                   DoubleValue (0.100),
+                   MakeDoubleAccessor (&DmgWifiRadioEnergyModel::SetRfChainSwitchingCurrentA,
+                                       &DmgWifiRadioEnergyModel::GetRfChainSwitchingCurrentA),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("RfChainSwitchingTime",
+                   "The time needed to switch to another DMG antenna.",
+                   TimeValue (NanoSeconds (100)),
+                   MakeTimeAccessor (&DmgWifiRadioEnergyModel::m_rfChainSwitchingTime),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+DmgWifiRadioEnergyModel::DmgWifiRadioEnergyModel ()
+  : m_txSweeping (false),
+    m_rxSweeping (false),
+    m_trnReceiving (false),
+    m_rfChainSwitching (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgWifiRadioEnergyModel::~DmgWifiRadioEnergyModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DmgWifiRadioEnergyModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_rfChainSwitchingEvent.Cancel ();
+  m_phy = 0;
+  WifiRadioEnergyModel::DoDispose ();
+}
+
+void
+DmgWifiRadioEnergyModel::SetPhy (Ptr<WifiPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  m_phy = phy;
+  phy->TraceConnectWithoutContext ("PhyTxBegin", MakeCallback (&DmgWifiRadioEnergyModel::PhyTxBegin, this));
+  phy->TraceConnectWithoutContext ("PhyRxBegin", MakeCallback (&DmgWifiRadioEnergyModel::PhyRxBegin, this));
+  /* Only the YansWifiPhy models the reception of TRN fields */
+  phy->TraceConnectWithoutContext ("PhyTrnRxBegin", MakeCallback (&DmgWifiRadioEnergyModel::PhyTrnRxBegin, this));
+  Ptr<DirectionalAntenna> antenna = phy->GetDirectionalAntenna ();
+  if (antenna != 0)
+    {
+      antenna->TraceConnectWithoutContext ("AntennaSwitch", MakeCallback (&DmgWifiRadioEnergyModel::AntennaSwitched, this));
+    }
+  else
+    {
+      NS_LOG_DEBUG ("No directional antenna attached to the PHY, RF chain switching is not accounted");
+    }
+}
+
+double
+DmgWifiRadioEnergyModel::GetBeamSweepingCurrentA (void) const
+{
+  return m_beamSweepingCurrentA;
+}
+
+void
+DmgWifiRadioEnergyModel::SetBeamSweepingCurrentA (double current)
+{
+  NS_LOG_FUNCTION (this << current);
+  m_beamSweepingCurrentA = current;
+}
+
+double
+DmgWifiRadioEnergyModel::GetTrnRxCurrentA (void) const
+{
+  return m_trnRxCurrentA;
+}
+
+void
+DmgWifiRadioEnergyModel::SetTrnRxCurrentA (double current)
+{
+  NS_LOG_FUNCTION (this << current);
+  m_trnRxCurrentA = current;
+}
+
+double
+DmgWifiRadioEnergyModel::GetRfChainSwitchingCurrentA (void) const
+{
+  return m_rfChainSwitchingCurrentA;
+}
+
+void
+DmgWifiRadioEnergyModel::SetRfChainSwitchingCurrentA (double current)
+{
+  NS_LOG_FUNCTION (this << current);
+  m_rfChainSwitchingCurrentA = current;
+}
+
+void
+DmgWifiRadioEnergyModel::ChangeState (int newState)
+{
+  NS_LOG_FUNCTION (this << newState);
+  WifiPhy::State oldState = GetCurrentState ();
+  WifiRadioEnergyModel::ChangeState (newState);
+  if (newState == oldState)
+    {
+      return;
+    }
+  /* The sweep frame or the TRN fields end with the TX or RX state carrying them */
+  if (oldState == WifiPhy::TX)
+    {
+      m_txSweeping = false;
+    }
+  else if (oldState == WifiPhy::RX)
+    {
+      m_rxSweeping = false;
+      m_trnReceiving = false;
+    }
+}
+
+double
+DmgWifiRadioEnergyModel::DoGetCurrentA (void) const
+{
+  double current;
+  WifiPhy::State state = GetCurrentState ();
+  if ((state == WifiPhy::RX) && m_trnReceiving)
+    {
+      current = m_trnRxCurrentA;
+    }
+  else if (((state == WifiPhy::TX) && m_txSweeping) || ((state == WifiPhy::RX) && m_rxSweeping))
+    {
+      current = m_beamSweepingCurrentA;
+    }
+  else
+    {
+      current = WifiRadioEnergyModel::DoGetCurrentA ();
+    }
+  if (m_rfChainSwitching)
+    {
+      current += m_rfChainSwitchingCurrentA;
+    }
+  return current;
+}
+
+bool
+DmgWifiRadioEnergyModel::IsBeamSweepingFrame (Ptr<const Packet> packet)
+{
+  WifiMacHeader hdr;
+  if (packet->GetSize () < hdr.GetSerializedSize ())
+    {
+      return false;
+    }
+  packet->PeekHeader (hdr);
+  return (hdr.IsDMGBeacon () || hdr.IsSSW ());
+}
+
+void
+DmgWifiRadioEnergyModel::UpdateEnergy (void)
+{
+  WifiRadioEnergyModel::ChangeState (GetCurrentState ());
+}
+
+void
+DmgWifiRadioEnergyModel::PhyTxBegin (Ptr<const Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  /* The PHY switches to TX right after this trace, so the flag only affects the coming TX state */
+  bool sweeping = IsBeamSweepingFrame (packet);
+  if (sweeping != m_txSweeping)
+    {
+      UpdateEnergy ();
+      m_txSweeping = sweeping;
+    }
+}
+
+void
+DmgWifiRadioEnergyModel::PhyRxBegin (Ptr<const Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  bool sweeping = IsBeamSweepingFrame (packet);
+  if (sweeping != m_rxSweeping)
+    {
+      UpdateEnergy ();
+      m_rxSweeping = sweeping;
+    }
+}
+
+void
+DmgWifiRadioEnergyModel::PhyTrnRxBegin (WifiTxVector txVector, uint8_t fieldsRemaining)
+{
+  NS_LOG_FUNCTION (this << uint16_t (fieldsRemaining));
+  if (!m_trnReceiving)
+    {
+      UpdateEnergy ();
+      m_trnReceiving = true;
+    }
+}
+
+void
+DmgWifiRadioEnergyModel::AntennaSwitched (uint8_t oldAntennaId, uint8_t newAntennaId)
+{
+  NS_LOG_FUNCTION (this << uint16_t (oldAntennaId) << uint16_t (newAntennaId));
+  if (m_rfChainSwitchingTime.IsZero ())
+    {
+      return;
+    }
+  if (!m_rfChainSwitching)
+    {
+      UpdateEnergy ();
+      m_rfChainSwitching = true;
+    }
+  m_rfChainSwitchingEvent.Cancel ();
+  m_rfChainSwitchingEvent = Simulator::Schedule (m_rfChainSwitchingTime,
+                                                 &DmgWifiRadioEnergyModel::EndRfChainSwitching, this);
+}
+
+void
+DmgWifiRadioEnergyModel::EndRfChainSwitching (void)
+{
+  NS_LOG_FUNCTION (this);
+  UpdateEnergy ();
+  m_rfChainSwitching = false;
+}
+
+} // namespace ns3
@@ -875,6 +875,20 @@ EdcaTxopN::NotifyChannelSwitching (void)
   m_currentPacket = 0;
 }
 
+void
+EdcaTxopN::ChangePacketsAddress (Mac48Address oldAddress, Mac48Address newAddress)
+{
+  NS_LOG_FUNCTION (this << oldAddress << newAddress);
+  m_queue->ChangePacketsReceiverAddress (oldAddress, newAddress);
+  for (uint8_t tid = 0; tid < 8; tid++)
+    {
+      if (m_baManager->ExistsAgreement (oldAddress, tid))
+        {
+          m_baManager->TearDownBlockAck (oldAddress, tid);
+        }
+    }
+}
+
 void
 EdcaTxopN::NotifySleep (void)
 {
@@ -1279,6 +1293,12 @@ EdcaTxopN::InitiateTransmission (AllocationID allocationID, Time cbapDuration)
       PacketInformation info = it->second;
       m_currentPacket = info.first;
       m_currentHdr = info.second;
+      /* The other allocations share the Block Ack session, a stored MSDU left behind its window gets a new sequence number */
+      if ((m_currentPacket != 0) && m_low->IsStaleSuspendedTransmission (m_currentHdr))
+        {
+          m_currentHdr.SetSequenceNumber (m_txMiddle->GetNextSequenceNumberfor (&m_currentHdr));
+          m_currentHdr.SetNoRetry ();
+        }
     }
 
   /* Do the contention access by DCF Manager */
@@ -1327,6 +1347,11 @@ EdcaTxopN::NeedBarRetransmission (void)
       tid = baRespHdr.GetTidInfo ();
       seqNumber = m_currentHdr.GetSequenceNumber ();
     }
+  /* The agreement may have been torn down while the frame was in flight */
+  if (!m_baManager->ExistsAgreement (m_currentHdr.GetAddr1 (), tid))
+    {
+      return false;
+    }
   return m_baManager->NeedBarRetransmission (tid, seqNumber, m_currentHdr.GetAddr1 ());
 }
 
@@ -1848,6 +1873,25 @@ EdcaTxopN::GetBlockAckThreshold (void) const
   return m_blockAckThreshold;
 }
 
+uint16_t
+EdcaTxopN::GetBlockAckInactivityTimeout (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_blockAckInactivityTimeout;
+}
+
+BlockAckManager *
+EdcaTxopN::GetBlockAckManager (void) const
+{
+  return m_baManager;
+}
+
+QosBlockedDestinations *
+EdcaTxopN::GetQosBlockedDestinations (void) const
+{
+  return m_qosBlockedDestinations;
+}
+
 void
 EdcaTxopN::SendAddBaRequest (Mac48Address dest, uint8_t tid, uint16_t startSeq,
                              uint16_t timeout, bool immediateBAck)
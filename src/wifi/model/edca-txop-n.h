@@ -240,6 +240,14 @@ public:
    * When wake up operation occurs, restart channel access
    */
   void NotifyWakeUp (void);
+  /**
+   * When the recipient of our frames changes its MAC address (e.g. PCP handover), re-address
+   * the enqueued packets and tear down the Block Ack agreements with the old address.
+   *
+   * \param oldAddress the MAC address of the old recipient
+   * \param newAddress the MAC address of the new recipient
+   */
+  void ChangePacketsAddress (Mac48Address oldAddress, Mac48Address newAddress);
 
   /* Event handlers */
   /**
@@ -436,6 +444,24 @@ public:
   uint8_t GetBlockAckThreshold (void) const;
 
   void SetBlockAckInactivityTimeout (uint16_t timeout);
+  /**
+   * Return the inactivity timeout of the block ack agreements set up by this EDCAF.
+   *
+   * \return the block ack inactivity timeout
+   */
+  uint16_t GetBlockAckInactivityTimeout (void) const;
+  /**
+   * Return the BlockAckManager holding the block ack agreements of this EDCAF.
+   *
+   * \return the BlockAckManager
+   */
+  BlockAckManager * GetBlockAckManager (void) const;
+  /**
+   * Return the destinations blocked by the BlockAckManager of this EDCAF.
+   *
+   * \return the blocked destinations
+   */
+  QosBlockedDestinations * GetQosBlockedDestinations (void) const;
   void SendDelbaFrame (Mac48Address addr, uint8_t tid, bool byOriginator);
   void CompleteMpduTx (Ptr<const Packet> packet, WifiMacHeader hdr, Time tstamp);
   bool GetAmpduExist (Mac48Address dest) const;
@@ -11,6 +11,9 @@
 #include "ext-headers.h"
 #include "mgt-headers.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("ExtHeaders");
@@ -91,6 +94,15 @@ ExtChannelMeasurementInfo::SetSnr (uint8_t snr)
   m_snr = snr;
 }
 
+void
+ExtChannelMeasurementInfo::SetSnrDb (double snr)
+{
+  NS_LOG_FUNCTION (this << snr);
+  double value = std::floor (4 * (snr - 19));
+  value = std::max (-128.0, std::min (127.0, value));
+  m_snr = static_cast<uint8_t> (static_cast<int8_t> (value));
+}
+
 void
 ExtChannelMeasurementInfo::SetInternalAngle (uint8_t angle)
 {
@@ -126,6 +138,13 @@ ExtChannelMeasurementInfo::GetSnr (void) const
   return m_snr;
 }
 
+double
+ExtChannelMeasurementInfo::GetSnrDb (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return static_cast<int8_t> (m_snr) / 4.0 + 19;
+}
+
 uint8_t
 ExtChannelMeasurementInfo::GetInternalAngle (void) const
 {
@@ -337,7 +356,8 @@ ExtDMGBeaconIntervalCtrlField::ExtDMGBeaconIntervalCtrlField ()
     m_N_BI (0),
     m_ABFT_Count (0),
     m_N_ABFT_Ant (0),
-    m_pcpAssociationReady (false)
+    m_pcpAssociationReady (false),
+    m_abftMultiplier (0)
 {
 }
 
@@ -396,6 +416,7 @@ ExtDMGBeaconIntervalCtrlField::Serialize (Buffer::Iterator start) const
   ctrl2 |= (m_ABFT_Count >> 1) & 0x1F;
   ctrl2 |= ((m_N_ABFT_Ant & 0x3F) << 5);
   ctrl2 |= ((m_pcpAssociationReady & 0x1) << 11);
+  ctrl2 |= ((m_abftMultiplier & 0x7) << 12);
 
   start.WriteHtolsbU32 (ctrl1);
   start.WriteHtolsbU16 (ctrl2);
@@ -424,6 +445,7 @@ ExtDMGBeaconIntervalCtrlField::Deserialize (Buffer::Iterator start)
   m_ABFT_Count =  ((ctrl1 >> 31) & 0x1) | ((ctrl2 << 1) & 0x3E);
   m_N_ABFT_Ant = (ctrl2 >> 5) & 0x3F;
   m_pcpAssociationReady = (ctrl2 >> 11) & 0x1;
+  m_abftMultiplier = (ctrl2 >> 12) & 0x7;
 
   return start;
 }
@@ -515,6 +537,13 @@ ExtDMGBeaconIntervalCtrlField::SetPCPAssoicationReady (bool value)
   m_pcpAssociationReady = value;
 }
 
+void
+ExtDMGBeaconIntervalCtrlField::SetABFT_Multiplier (uint8_t value)
+{
+  NS_ASSERT (value <= 7);
+  m_abftMultiplier = value;
+}
+
 bool
 ExtDMGBeaconIntervalCtrlField::IsCCPresent (void) const
 {
@@ -600,6 +629,140 @@ ExtDMGBeaconIntervalCtrlField::GetPCPAssoicationReady (void) const
   return m_pcpAssociationReady;
 }
 
+uint8_t
+ExtDMGBeaconIntervalCtrlField::GetABFT_Multiplier (void) const
+{
+  return m_abftMultiplier;
+}
+
+/******************************************
+*     Clustering Control Field (8-34c)
+*******************************************/
+
+NS_OBJECT_ENSURE_REGISTERED (ExtDMGClusteringControlField);
+
+ExtDMGClusteringControlField::ExtDMGClusteringControlField ()
+  : m_beaconSpDuration (0),
+    m_clusterMemberRole (NOT_PARTICIPATING),
+    m_clusterMaxMem (0)
+{
+}
+
+ExtDMGClusteringControlField::~ExtDMGClusteringControlField ()
+{
+}
+
+TypeId
+ExtDMGClusteringControlField::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ExtDMGClusteringControlField")
+    .SetParent<Header> ()
+    .AddConstructor<ExtDMGClusteringControlField> ()
+  ;
+  return tid;
+}
+
+TypeId
+ExtDMGClusteringControlField::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+uint32_t
+ExtDMGClusteringControlField::GetSerializedSize (void) const
+{
+  return 8; // 8 bytes length.
+}
+
+void
+ExtDMGClusteringControlField::Print (std::ostream &os) const
+{
+  os << "Beacon SP Duration=" << GetBeaconSpDuration ()
+     << "|Cluster ID=" << m_clusterId
+     << "|Cluster Member Role=" << uint16_t (m_clusterMemberRole)
+     << "|ClusterMaxMem=" << uint16_t (m_clusterMaxMem);
+}
+
+Buffer::Iterator
+ExtDMGClusteringControlField::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+  uint8_t buffer = 0;
+
+  start.WriteU8 (m_beaconSpDuration);
+  WriteTo (start, m_clusterId);
+  buffer |= m_clusterMemberRole & 0x3;
+  buffer |= ((m_clusterMaxMem & 0x1F) << 2);
+  start.WriteU8 (buffer);
+
+  return start;
+}
+
+Buffer::Iterator
+ExtDMGClusteringControlField::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  uint8_t buffer;
+
+  m_beaconSpDuration = start.ReadU8 ();
+  ReadFrom (start, m_clusterId);
+  buffer = start.ReadU8 ();
+  m_clusterMemberRole = buffer & 0x3;
+  m_clusterMaxMem = (buffer >> 2) & 0x1F;
+
+  return start;
+}
+
+void
+ExtDMGClusteringControlField::SetBeaconSpDuration (uint16_t duration)
+{
+  NS_ASSERT (duration <= 255 * 8);
+  m_beaconSpDuration = duration / 8;
+}
+
+void
+ExtDMGClusteringControlField::SetClusterID (Mac48Address clusterId)
+{
+  m_clusterId = clusterId;
+}
+
+void
+ExtDMGClusteringControlField::SetClusterMemberRole (enum ClusterMemberRole role)
+{
+  m_clusterMemberRole = role;
+}
+
+void
+ExtDMGClusteringControlField::SetClusterMaxMem (uint8_t max)
+{
+  NS_ASSERT (max <= 31);
+  m_clusterMaxMem = max;
+}
+
+uint16_t
+ExtDMGClusteringControlField::GetBeaconSpDuration (void) const
+{
+  return m_beaconSpDuration * 8;
+}
+
+Mac48Address
+ExtDMGClusteringControlField::GetClusterID (void) const
+{
+  return m_clusterId;
+}
+
+enum ClusterMemberRole
+ExtDMGClusteringControlField::GetClusterMemberRole (void) const
+{
+  return static_cast<enum ClusterMemberRole> (m_clusterMemberRole);
+}
+
+uint8_t
+ExtDMGClusteringControlField::GetClusterMaxMem (void) const
+{
+  return m_clusterMaxMem;
+}
+
 /******************************************
 *	   DMG Beacon (8.3.4.1)
 *******************************************/
@@ -641,6 +804,10 @@ ExtDMGBeacon::GetSerializedSize (void) const
   size += 2;                                          // Beacon Interval (See 8.4.1.3)
   size += m_beaconIntervalCtrl.GetSerializedSize ();  // Beacon Interval Control (See 8.4.1.3)
   size += m_dmgParameters.GetSerializedSize ();       // DMG Parameters (See 8.4.1.46)
+  if (m_beaconIntervalCtrl.IsCCPresent ())
+    {
+      size += m_clusterCtrl.GetSerializedSize ();     // Clustering Control (See 8.4.1.47)
+    }
   size += m_ssid.GetSerializedSize ();
   size += GetInformationElementsSerializedSize ();
   return size;
@@ -661,6 +828,7 @@ ExtDMGBeacon::Serialize (Buffer::Iterator start) const
   // 3. Beacon Interval.
   // 4. Beacon Interval Control.
   // 5. DMG Parameters.
+  // 6. Clustering Control (Optional).
   /* Other Information Elements */
   Buffer::Iterator i = start;
   i.WriteHtolsbU64 (Simulator::Now ().GetMicroSeconds ());
@@ -668,6 +836,10 @@ ExtDMGBeacon::Serialize (Buffer::Iterator start) const
   i.WriteHtolsbU16 (m_beaconInterval / 1024);
   i = m_beaconIntervalCtrl.Serialize (i);
   i = m_dmgParameters.Serialize (i);
+  if (m_beaconIntervalCtrl.IsCCPresent ())
+    {
+      i = m_clusterCtrl.Serialize (i);
+    }
   i = m_ssid.Serialize (i);
   i = SerializeInformationElements (i);
 }
@@ -682,6 +854,10 @@ ExtDMGBeacon::Deserialize (Buffer::Iterator start)
   m_beaconInterval *= 1024;
   i = m_beaconIntervalCtrl.Deserialize (i);
   i = m_dmgParameters.Deserialize (i);
+  if (m_beaconIntervalCtrl.IsCCPresent ())
+    {
+      i = m_clusterCtrl.Deserialize (i);
+    }
   i = m_ssid.Deserialize (i);
   i = DeserializeInformationElements (i);
   return i.GetDistanceFrom (start);
@@ -733,6 +909,13 @@ ExtDMGBeacon::SetDMGParameters (ExtDMGParameters &parameters)
   m_dmgParameters = parameters;
 }
 
+void
+ExtDMGBeacon::SetClusterControlField (ExtDMGClusteringControlField &cluster)
+{
+  NS_LOG_FUNCTION (this << &cluster);
+  m_clusterCtrl = cluster;
+}
+
 void
 ExtDMGBeacon::SetSsid (Ssid ssid)
 {
@@ -781,6 +964,13 @@ ExtDMGBeacon::GetDMGParameters (void) const
   return m_dmgParameters;
 }
 
+ExtDMGClusteringControlField
+ExtDMGBeacon::GetClusterControlField (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_clusterCtrl;
+}
+
 Ssid
 ExtDMGBeacon::GetSsid (void) const
 {
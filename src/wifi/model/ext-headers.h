@@ -48,6 +48,12 @@ public:
    * \param
    */
   void SetSnr (uint8_t snr);
+  /**
+   * Encode the SNR subfield from an SNR value in dB. Values outside the representable
+   * range (-13 dB to 50.75 dB) are saturated.
+   * \param snr The measured SNR in dB.
+   */
+  void SetSnrDb (double snr);
   /**
    * The Internal Angle subfield indicates the angle between directions toward the other STAs involved in the
    * relay operation. This covers from 0 degree to 180 degree in 2 degree steps. This subfield uses the degree of
@@ -67,6 +73,11 @@ public:
 
   uint16_t GetPeerStaAid (void) const;
   uint8_t GetSnr (void) const;
+  /**
+   * Decode the SNR subfield.
+   * \return The SNR in dB carried by the SNR subfield.
+   */
+  double GetSnrDb (void) const;
   uint8_t GetInternalAngle (void) const;
   bool GetRecommendSubField (void) const;
   uint8_t GetReserved (void) const;
@@ -274,6 +285,13 @@ public:
    * \param value
    */
   void SetPCPAssoicationReady (bool value);
+  /**
+   * The A-BFT Multiplier field (802.11ay, reserved bits B44-B46 in 802.11ad) indicates the number of
+   * secondary A-BFTs, each of A-BFT Length SSW slots, that follow the primary A-BFT. A value of 0
+   * indicates that the A-BFT is not extended.
+   * \param value
+   */
+  void SetABFT_Multiplier (uint8_t value);
 
   bool IsCCPresent (void) const;
   bool IsDiscoveryMode (void) const;
@@ -289,6 +307,7 @@ public:
   uint8_t GetABFT_Count (void) const;
   uint8_t GetN_ABFT_Ant (void) const;
   bool GetPCPAssoicationReady (void) const;
+  uint8_t GetABFT_Multiplier (void) const;
 
 private:
   bool m_ccPresent;
@@ -305,6 +324,72 @@ private:
   uint8_t m_ABFT_Count;
   uint8_t m_N_ABFT_Ant;
   bool m_pcpAssociationReady;
+  uint8_t m_abftMultiplier;
+
+};
+
+/******************************************
+*     Clustering Control Field (8-34c)
+*******************************************/
+
+enum ClusterMemberRole
+{
+  NOT_PARTICIPATING = 0,
+  SYNC_PCP_AP = 1,
+  PARTICIPATING_PCP_AP = 2
+};
+
+/**
+ * \ingroup wifi
+ * Implement the header for the Clustering Control Field of the DMG Beacon, present when the CC Present
+ * field is 1 and the Discovery Mode field is 0. The format of the field in discovery mode is not supported.
+ */
+class ExtDMGClusteringControlField : public ObjectBase
+{
+public:
+  ExtDMGClusteringControlField ();
+  ~ExtDMGClusteringControlField ();
+
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  void Print (std::ostream &os) const;
+  uint32_t GetSerializedSize (void) const;
+  Buffer::Iterator Serialize (Buffer::Iterator start) const;
+  Buffer::Iterator Deserialize (Buffer::Iterator start);
+
+  /**
+   * The Beacon SP Duration subfield indicates the duration, in units of 8 us, of the Beacon SPs in the cluster.
+   * \param duration The duration of the Beacon SP in microseconds.
+   */
+  void SetBeaconSpDuration (uint16_t duration);
+  /**
+   * The Cluster ID subfield is set to the MAC address of the S-PCP/S-AP of the cluster.
+   * \param clusterId The MAC address of the S-PCP/S-AP.
+   */
+  void SetClusterID (Mac48Address clusterId);
+  /**
+   * The Cluster Member Role subfield indicates the role that the STA transmitting the DMG Beacon
+   * performs within the cluster.
+   * \param role The role of the PCP/AP in the cluster.
+   */
+  void SetClusterMemberRole (enum ClusterMemberRole role);
+  /**
+   * The ClusterMaxMem subfield indicates the maximum number of PCPs/APs, including the S-PCP/S-AP,
+   * that can participate in the cluster. The beacon interval is divided into this number of Beacon SPs.
+   * \param max The maximum number of PCPs/APs in the cluster.
+   */
+  void SetClusterMaxMem (uint8_t max);
+
+  uint16_t GetBeaconSpDuration (void) const;
+  Mac48Address GetClusterID (void) const;
+  enum ClusterMemberRole GetClusterMemberRole (void) const;
+  uint8_t GetClusterMaxMem (void) const;
+
+private:
+  uint8_t m_beaconSpDuration;     //!< Beacon SP Duration in units of 8 us.
+  Mac48Address m_clusterId;       //!< The MAC address of the S-PCP/S-AP.
+  uint8_t m_clusterMemberRole;    //!< Cluster Member Role.
+  uint8_t m_clusterMaxMem;        //!< ClusterMaxMem.
 
 };
 
@@ -365,6 +450,13 @@ public:
   */
   void SetDMGParameters (ExtDMGParameters &parameters);
   /**
+  * Set the Clustering Control Field in the DMG Beacon frame body, the field is only serialized
+  * when the CC Present field of the Beacon Interval Control field is 1.
+  *
+  * \param cluster The Clustering Control field.
+  */
+  void SetClusterControlField (ExtDMGClusteringControlField &cluster);
+  /**
   * Set the Service Set Identifier (SSID)
   *
   * \param ssid SSID.
@@ -407,6 +499,12 @@ public:
   * \return The DMG Parameters field.
   */
   ExtDMGParameters GetDMGParameters (void) const;
+  /**
+  * Get the Clustering Control Field in the DMG Beacon frame body.
+  *
+  * \return The Clustering Control field.
+  */
+  ExtDMGClusteringControlField GetClusterControlField (void) const;
   /**
    * Return the Service Set Identifier (SSID).
    *
@@ -428,6 +526,7 @@ private:
   uint64_t m_beaconInterval;                              //!< Beacon Interval.
   ExtDMGBeaconIntervalCtrlField m_beaconIntervalCtrl;     //!< Beacon Interval Control.
   ExtDMGParameters m_dmgParameters;                       //!< DMG Parameters.
+  ExtDMGClusteringControlField m_clusterCtrl;             //!< Clustering Control.
   Ssid m_ssid;                                            //!< Service set ID (SSID)
 
 };
@@ -188,7 +188,8 @@ Dynamic_Allocation_Info_Field::Dynamic_Allocation_Info_Field ()
     m_allocationType (SERVICE_PERIOD_ALLOCATION),
     m_sourceAID (0),
     m_destinationAID (0),
-    m_allocationDuration (0)
+    m_allocationDuration (0),
+    m_reserved (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -243,7 +244,7 @@ Dynamic_Allocation_Info_Field::Serialize (Buffer::Iterator start) const
   field1 |= m_destinationAID << 15;
   field1 |= (m_allocationDuration & 0x1FF) << 23;
 
-  field2 |= (m_allocationDuration >> 7) & 0x7F;
+  field2 |= (m_allocationDuration >> 9) & 0x7F;
   field2 |= (m_reserved & 0x1) << 7;
 
   i.WriteHtolsbU32 (field1);
@@ -261,11 +262,11 @@ Dynamic_Allocation_Info_Field::Deserialize (Buffer::Iterator start)
   uint8_t field2 = i.ReadU8 ();
 
   m_tid = field1 & 0xF;
-  m_allocationType = static_cast<AllocationType> ((m_allocationType >> 4) & 0x7);
+  m_allocationType = static_cast<AllocationType> ((field1 >> 4) & 0x7);
   m_sourceAID = (field1 >> 7) & 0xFF;
-  m_destinationAID = (field1 >> 7) & 0xFF;
+  m_destinationAID = (field1 >> 15) & 0xFF;
   m_allocationDuration = (static_cast<uint16_t>(field1 >> 23) & 0x1FF) |
-                         (static_cast<uint16_t>(field2 & 0x7F) << 7);
+                         (static_cast<uint16_t>(field2 & 0x7F) << 9);
   m_reserved = (field2 >> 7) & 0x1;
 
   return i;
@@ -920,7 +921,7 @@ BF_Control_Field::Deserialize (Buffer::Iterator start)
 {
   NS_LOG_FUNCTION (this << &start);
   Buffer::Iterator i = start;
-  uint8_t value = i.ReadLsbtohU16 ();
+  uint16_t value = i.ReadLsbtohU16 ();
 
   m_beamformTraining = value & 0x1;
   m_isInitiatorTxss = ((value >> 1) & 0x1);
@@ -928,15 +929,15 @@ BF_Control_Field::Deserialize (Buffer::Iterator start)
 
   if (m_isInitiatorTxss && m_isResponderTxss)
     {
-      m_sectors |= ((value >> 3) & 0x7F);
-      m_antennas |= ((value >> 10) & 0x3);
-      m_reserved |= ((value >> 12) & 0xF);
+      m_sectors = ((value >> 3) & 0x7F);
+      m_antennas = ((value >> 10) & 0x3);
+      m_reserved = ((value >> 12) & 0xF);
     }
   else
     {
-      m_rxssLength |= ((value >> 3) & 0x3F);
-      m_rxssTXRate |= ((value >> 9) & 0x1);
-      m_reserved |= ((value >> 10) & 0x3F);
+      m_rxssLength = ((value >> 3) & 0x3F);
+      m_rxssTXRate = ((value >> 9) & 0x1);
+      m_reserved = ((value >> 10) & 0x3F);
     }
 
   return i;
@@ -177,7 +177,7 @@ private:
   AllocationType m_allocationType;
   uint8_t m_sourceAID;
   uint8_t m_destinationAID;
-  uint8_t m_allocationDuration;
+  uint16_t m_allocationDuration;
   uint8_t m_reserved;
 
 };
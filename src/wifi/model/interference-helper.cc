@@ -25,6 +25,7 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include <algorithm>
+#include <cmath>
 
 namespace ns3 {
 
@@ -42,7 +43,11 @@ InterferenceHelper::Event::Event (uint32_t size, WifiTxVector txVector,
     m_preamble (preamble),
     m_startTime (Simulator::Now ()),
     m_endTime (m_startTime + duration),
-    m_rxPowerW (rxPower)
+    m_rxPowerW (rxPower),
+    m_directional (false),
+    m_rxAngle (0),
+    m_rxGainDbi (0),
+    m_niPowerW (rxPower)
 {
 }
 
@@ -54,7 +59,11 @@ InterferenceHelper::Event::Event (WifiTxVector txVector,
     m_preamble (WIFI_PREAMBLE_NONE),
     m_startTime (Simulator::Now ()),
     m_endTime (m_startTime + duration),
-    m_rxPowerW (rxPower)
+    m_rxPowerW (rxPower),
+    m_directional (false),
+    m_rxAngle (0),
+    m_rxGainDbi (0),
+    m_niPowerW (rxPower)
 {
 }
 
@@ -110,6 +119,44 @@ InterferenceHelper::Event::GetPreambleType (void) const
   return m_preamble;
 }
 
+void
+InterferenceHelper::Event::SetRxDirection (double rxAngle, double rxGainDbi)
+{
+  m_directional = true;
+  m_rxAngle = rxAngle;
+  m_rxGainDbi = rxGainDbi;
+}
+
+bool
+InterferenceHelper::Event::IsDirectional (void) const
+{
+  return m_directional;
+}
+
+double
+InterferenceHelper::Event::GetRxAngle (void) const
+{
+  return m_rxAngle;
+}
+
+double
+InterferenceHelper::Event::GetRxPowerW (double rxGainDbi) const
+{
+  return m_rxPowerW * std::pow (10.0, (rxGainDbi - m_rxGainDbi) / 10.0);
+}
+
+double
+InterferenceHelper::Event::GetNiPowerW (void) const
+{
+  return m_niPowerW;
+}
+
+void
+InterferenceHelper::Event::SetNiPowerW (double power)
+{
+  m_niPowerW = power;
+}
+
 
 /****************************************************************
  *       Class which records SNIR change events for a
@@ -156,6 +203,7 @@ InterferenceHelper::~InterferenceHelper ()
 {
   EraseEvents ();
   m_errorRateModel = 0;
+  m_antenna = 0;
 }
 
 Ptr<InterferenceHelper::Event>
@@ -174,6 +222,26 @@ InterferenceHelper::Add (uint32_t size, WifiTxVector txVector,
   return event;
 }
 
+Ptr<InterferenceHelper::Event>
+InterferenceHelper::Add (uint32_t size, WifiTxVector txVector,
+                         enum WifiPreamble preamble,
+                         Time duration, double rxPowerW,
+                         double rxAngle, double rxGainDbi)
+{
+  Ptr<InterferenceHelper::Event> event;
+
+  event = Create<InterferenceHelper::Event> (size,
+                                             txVector,
+                                             preamble,
+                                             duration,
+                                             rxPowerW);
+  event->SetRxDirection (rxAngle, rxGainDbi);
+  AppendEvent (event);
+  PurgeDirectionalEvents ();
+  m_directionalEvents.push_back (event);
+  return event;
+}
+
 void
 InterferenceHelper::AddForeignSignal (Time duration, double rxPowerW)
 {
@@ -290,7 +358,7 @@ InterferenceHelper::CalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event>
   NS_ASSERT (m_rxing);
   for (NiChanges::const_iterator i = m_niChanges.begin () + 1; i != m_niChanges.end (); i++)
     {
-      if ((event->GetEndTime () == i->GetTime ()) && event->GetRxPowerW () == -i->GetDelta ())
+      if ((event->GetEndTime () == i->GetTime ()) && event->GetNiPowerW () == -i->GetDelta ())
         {
           break;
         }
@@ -308,7 +376,7 @@ InterferenceHelper::CalculateChunkSuccessRate (double snir, Time duration, WifiM
     {
       return 1.0;
     }
-  uint32_t rate = mode.GetPhyRate (txVector);
+  uint64_t rate = mode.GetPhyRate (txVector);
   uint64_t nbits = (uint64_t)(rate * duration.GetSeconds ());
   double csr = m_errorRateModel->GetChunkSuccessRate (mode, txVector, snir, (uint32_t)nbits);
   return csr;
@@ -879,6 +947,8 @@ InterferenceHelper::EraseEvents (void)
 {
   NS_LOG_FUNCTION (this);
   m_niChanges.clear ();
+  m_directionalEvents.clear ();
+  m_rxEvent = 0;
   m_rxing = false;
   m_firstPower = 0.0;
 }
@@ -897,6 +967,110 @@ InterferenceHelper::AddNiChangeEvent (NiChange change)
   m_niChanges.insert (GetPosition (change.GetTime ()), change);
 }
 
+void
+InterferenceHelper::SetDirectionalAntenna (Ptr<DirectionalAntenna> antenna)
+{
+  NS_LOG_FUNCTION (this << antenna);
+  m_antenna = antenna;
+}
+
+void
+InterferenceHelper::PurgeDirectionalEvents (void)
+{
+  Time now = Simulator::Now ();
+  for (Events::iterator i = m_directionalEvents.begin (); i != m_directionalEvents.end (); )
+    {
+      if ((*i)->GetEndTime () <= now)
+        {
+          i = m_directionalEvents.erase (i);
+        }
+      else
+        {
+          i++;
+        }
+    }
+}
+
+void
+InterferenceHelper::UpdateRxBeam (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (getenv ("NO_RW") || m_antenna == 0)
+    {
+      return;
+    }
+  PurgeDirectionalEvents ();
+  Time now = Simulator::Now ();
+  for (Events::const_iterator i = m_directionalEvents.begin (); i != m_directionalEvents.end (); i++)
+    {
+      Ptr<Event> event = *i;
+      if (m_rxing && (event == m_rxEvent))
+        {
+          continue;
+        }
+      double oldPowerW = event->GetNiPowerW ();
+      double newPowerW = event->GetRxPowerW (m_antenna->GetRxGainDbi (event->GetRxAngle ()));
+      if (newPowerW == oldPowerW)
+        {
+          continue;
+        }
+      NS_LOG_DEBUG ("Re-weight interference of signal arriving at angle=" << event->GetRxAngle ()
+                    << " from " << oldPowerW << "W to " << newPowerW << "W");
+      /* Move the end of the signal to its new power */
+      for (NiChanges::iterator j = GetPosition (now); j != m_niChanges.end (); j++)
+        {
+          if ((j->GetTime () == event->GetEndTime ()) && (j->GetDelta () == -oldPowerW))
+            {
+              *j = NiChange (event->GetEndTime (), -newPowerW);
+              break;
+            }
+        }
+      AddNiChangeEvent (NiChange (now, newPowerW - oldPowerW));
+      event->SetNiPowerW (newPowerW);
+    }
+}
+
+double
+InterferenceHelper::CalculateRxSectorSnr (Ptr<const InterferenceHelper::Event> event,
+                                          uint8_t sectorId, uint8_t antennaId) const
+{
+  NS_LOG_FUNCTION (this << event << uint (sectorId) << uint (antennaId));
+  NS_ASSERT (m_antenna != 0);
+  NS_ASSERT (event->IsDirectional ());
+  Time now = Simulator::Now ();
+  double signalW = event->GetRxPowerW (m_antenna->GetGainDbi (event->GetRxAngle (), sectorId, antennaId));
+  double interferenceW = 0;
+  for (Events::const_iterator i = m_directionalEvents.begin (); i != m_directionalEvents.end (); i++)
+    {
+      if ((*i == event) || ((*i)->GetStartTime () > now) || ((*i)->GetEndTime () <= now))
+        {
+          continue;
+        }
+      interferenceW += (*i)->GetRxPowerW (m_antenna->GetGainDbi ((*i)->GetRxAngle (), sectorId, antennaId));
+    }
+  return CalculateSnr (signalW, interferenceW, event->GetTxVector ().GetChannelWidth ());
+}
+
+std::vector<double>
+InterferenceHelper::CalculateRxSectorSnrs (Ptr<const InterferenceHelper::Event> event, uint8_t antennaId) const
+{
+  NS_LOG_FUNCTION (this << event << uint (antennaId));
+  NS_ASSERT (m_antenna != 0);
+  std::vector<double> snrs;
+  snrs.reserve (m_antenna->GetNumberOfSectors ());
+  for (uint8_t sectorId = 1; sectorId <= m_antenna->GetNumberOfSectors (); sectorId++)
+    {
+      snrs.push_back (CalculateRxSectorSnr (event, sectorId, antennaId));
+    }
+  return snrs;
+}
+
+Ptr<InterferenceHelper::Event>
+InterferenceHelper::GetRxEvent (void) const
+{
+  return m_rxEvent;
+}
+
 void
 InterferenceHelper::NotifyRxStart ()
 {
@@ -904,11 +1078,20 @@ InterferenceHelper::NotifyRxStart ()
   m_rxing = true;
 }
 
+void
+InterferenceHelper::NotifyRxStart (Ptr<InterferenceHelper::Event> event)
+{
+  NS_LOG_FUNCTION (this << event);
+  m_rxing = true;
+  m_rxEvent = event;
+}
+
 void
 InterferenceHelper::NotifyRxEnd ()
 {
   NS_LOG_FUNCTION (this);
   m_rxing = false;
+  m_rxEvent = 0;
 }
 
 } //namespace ns3
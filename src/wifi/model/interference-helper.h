@@ -31,6 +31,7 @@
 #include "ns3/simple-ref-count.h"
 #include "ns3/wifi-tx-vector.h"
 #include "error-rate-model.h"
+#include "directional-antenna.h"
 
 namespace ns3 {
 
@@ -118,6 +119,42 @@ public:
      * \return the preamble type of the packet
      */
     enum WifiPreamble GetPreambleType (void) const;
+    /**
+     * Record the direction of arrival of the signal and the receive antenna
+     * gain which was already applied to its receive power.
+     *
+     * \param rxAngle the azimuth angle of arrival (radians)
+     * \param rxGainDbi the receive antenna gain included in the receive power (dBi)
+     */
+    void SetRxDirection (double rxAngle, double rxGainDbi);
+    /**
+     * \return true if the direction of arrival of the signal is known.
+     */
+    bool IsDirectional (void) const;
+    /**
+     * \return the azimuth angle of arrival (radians)
+     */
+    double GetRxAngle (void) const;
+    /**
+     * Return the receive power (w) the signal would have for a different
+     * receive antenna gain.
+     *
+     * \param rxGainDbi the receive antenna gain (dBi)
+     *
+     * \return the receive power (w)
+     */
+    double GetRxPowerW (double rxGainDbi) const;
+    /**
+     * Return the power (w) this signal currently adds to the noise and
+     * interference, i.e. weighted by the current receive beam.
+     *
+     * \return the current noise and interference contribution (w)
+     */
+    double GetNiPowerW (void) const;
+    /**
+     * \param power the current noise and interference contribution (w)
+     */
+    void SetNiPowerW (double power);
 
 
 private:
@@ -127,6 +164,10 @@ private:
     Time m_startTime;
     Time m_endTime;
     double m_rxPowerW;
+    bool m_directional;   //!< Flag to indicate if the direction of arrival is known.
+    double m_rxAngle;     //!< Azimuth angle of arrival (radians).
+    double m_rxGainDbi;   //!< Receive antenna gain included in m_rxPowerW (dBi).
+    double m_niPowerW;    //!< Current contribution to the noise and interference (w).
   };
 
   /**
@@ -200,6 +241,25 @@ private:
   Ptr<InterferenceHelper::Event> Add (uint32_t size, WifiTxVector txVector,
                                       enum WifiPreamble preamble,
                                       Time duration, double rxPower);
+  /**
+   * Add the packet-related signal of a directional transmission to interference
+   * helper. The contribution of the signal to the interference is re-weighted
+   * each time the receive beam changes (see UpdateRxBeam).
+   *
+   * \param size packet size
+   * \param txVector TXVECTOR of the packet
+   * \param preamble Wi-Fi preamble for the packet
+   * \param duration the duration of the signal
+   * \param rxPower receive power (W)
+   * \param rxAngle the azimuth angle of arrival (radians)
+   * \param rxGainDbi the receive antenna gain included in rxPower (dBi)
+   *
+   * \return InterferenceHelper::Event
+   */
+  Ptr<InterferenceHelper::Event> Add (uint32_t size, WifiTxVector txVector,
+                                      enum WifiPreamble preamble,
+                                      Time duration, double rxPower,
+                                      double rxAngle, double rxGainDbi);
 
   /**
    * Add a non-Wifi signal to interference helper.
@@ -235,10 +295,55 @@ private:
    */
   struct InterferenceHelper::SnrPer CalculatePlcpHeaderSnrPer (Ptr<InterferenceHelper::Event> event);
 
+  /**
+   * Set the directional antenna whose receive beam weights the directional signals.
+   *
+   * \param antenna the directional antenna of the PHY
+   */
+  void SetDirectionalAntenna (Ptr<DirectionalAntenna> antenna);
+  /**
+   * Re-weight the interference of all active directional signals by the gain
+   * of the current receive beam. This must be called whenever the receive
+   * sector, antenna or omni/directional receive mode changes. The signal we are
+   * currently synchronized to is not re-weighted.
+   */
+  void UpdateRxBeam (void);
+  /**
+   * Calculate the SNIR of the given signal as if it were received right now
+   * through a candidate receive sector. Interference from the other active
+   * directional signals is weighted by the same candidate beam.
+   *
+   * \param event the event of the signal of interest
+   * \param sectorId the candidate receive sector ID
+   * \param antennaId the candidate receive antenna ID
+   *
+   * \return the SNIR (linear ratio)
+   */
+  double CalculateRxSectorSnr (Ptr<const InterferenceHelper::Event> event, uint8_t sectorId, uint8_t antennaId) const;
+  /**
+   * Calculate the SNIR of the given signal for every receive sector of an antenna.
+   *
+   * \param event the event of the signal of interest
+   * \param antennaId the candidate receive antenna ID
+   *
+   * \return the SNIR (linear ratio) of each sector, indexed by sector ID - 1
+   */
+  std::vector<double> CalculateRxSectorSnrs (Ptr<const InterferenceHelper::Event> event, uint8_t antennaId) const;
+  /**
+   * \return the event of the signal we are currently synchronized to, or 0.
+   */
+  Ptr<InterferenceHelper::Event> GetRxEvent (void) const;
+
   /**
    * Notify that RX has started.
    */
   void NotifyRxStart ();
+  /**
+   * Notify that RX of the given signal has started.
+   *
+   * \param event the event of the signal we synchronized to
+   */
+  void NotifyRxStart (Ptr<InterferenceHelper::Event> event);
   /**
    * Notify that RX has ended.
    */
@@ -362,6 +467,13 @@ private:
   NiChanges m_niChanges;
   double m_firstPower;
   bool m_rxing;
+  Ptr<DirectionalAntenna> m_antenna;  //!< Directional antenna which weights directional signals.
+  Events m_directionalEvents;         //!< Active directional signals, one per transmitter.
+  Ptr<Event> m_rxEvent;               //!< The signal we are currently synchronized to.
+  /**
+   * Remove the directional signals which ended.
+   */
+  void PurgeDirectionalEvents (void);
   /// Returns an iterator to the first nichange, which is later than moment
   NiChanges::iterator GetPosition (Time moment);
   /**
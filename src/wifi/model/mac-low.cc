@@ -833,6 +833,16 @@ MacLow::ResumeTransmission (Time duration, MacLowTransmissionListener *listener)
 //        }
       CancelAllEvents ();
       m_listener = listener;
+      m_aggregateQueue->Flush ();
+      if (m_currentAllocation.aggregateQueue != 0)
+        {
+          WifiMacHeader mpduHdr;
+          Ptr<const Packet> mpdu;
+          while ((mpdu = m_currentAllocation.aggregateQueue->Dequeue (&mpduHdr)) != 0)
+            {
+              m_aggregateQueue->Enqueue (mpdu, mpduHdr);
+            }
+        }
       SendDataPacket ();
 
       /* When this method completes, we have taken ownership of the medium. */
@@ -851,7 +861,21 @@ MacLow::RestoreAllocationParameters (AllocationID allocationId)
   m_transmissionSuspended = false;
   m_currentAllocationID = allocationId;
   /* Find the stored parameters for the provided allocation */
-  AllocationPeriodsTableCI it = m_allocationPeriodsTable.find (m_currentAllocationID);
+  AllocationPeriodsTableI it = m_allocationPeriodsTable.find (m_currentAllocationID);
+  if ((it != m_allocationPeriodsTable.end ()) && it->second.isAmpdu && it->second.aggregateQueue->IsEmpty ())
+    {
+      /* All the MPDUs of the suspended A-MPDU have expired while waiting for this allocation */
+      NS_LOG_DEBUG ("Suspended A-MPDU of Allocation=" << allocationId << " has expired");
+      m_allocationPeriodsTable.erase (it);
+      it = m_allocationPeriodsTable.end ();
+    }
+  if ((it != m_allocationPeriodsTable.end ()) && IsStaleSuspendedTransmission (it->second.hdr))
+    {
+      /* The other allocations kept using the Block Ack session, the recipient window has moved past these MPDUs */
+      NS_LOG_DEBUG ("Suspended transmission of Allocation=" << allocationId << " is behind the Block Ack window");
+      m_allocationPeriodsTable.erase (it);
+      it = m_allocationPeriodsTable.end ();
+    }
   if (it != m_allocationPeriodsTable.end ())
     {
       NS_LOG_DEBUG ("Restored Allocation Parameters for Allocation=" << allocationId);
@@ -864,11 +888,31 @@ MacLow::RestoreAllocationParameters (AllocationID allocationId)
     }
 }
 
+bool
+MacLow::IsStaleSuspendedTransmission (const WifiMacHeader &hdr) const
+{
+  if (!hdr.IsQosData () || hdr.GetAddr1 ().IsGroup ())
+    {
+      return false;
+    }
+  std::map<AcIndex, MacLowAggregationCapableTransmissionListener*>::const_iterator listenerIt =
+    m_edcaListeners.find (QosUtilsMapTidToAc (hdr.GetQosTid ()));
+  if (listenerIt == m_edcaListeners.end ())
+    {
+      return false;
+    }
+  WifiMacHeader peekHdr = hdr;
+  uint16_t nextSequence = listenerIt->second->PeekNextSequenceNumberfor (&peekHdr);
+  uint16_t distance = ((nextSequence - hdr.GetSequenceNumber ()) + 4096) % 4096;
+  return (distance >= 64);
+}
+
 void
 MacLow::StoreAllocationParameters (void)
 {
   NS_LOG_FUNCTION (this);
-  if (m_currentPacket != 0)
+  /* An A-MPDU whose MPDUs have all been forwarded is already on air, the Block Ack Agreement takes care of it */
+  if ((m_currentPacket != 0) && !(m_ampdu && (m_aggregateQueue->GetSize () == 0)))
     {
       CancelAllEvents ();
       /* Since CurrentPacket is not empty it means we suspended transmission */
@@ -877,6 +921,18 @@ MacLow::StoreAllocationParameters (void)
       m_currentAllocation.txParams = m_txParams;
       m_currentAllocation.txVector = m_currentTxVector;
       m_currentAllocation.isAmpdu = m_ampdu;
+      /* The other allocations reuse the aggregate queue, keep the MPDUs of the suspended A-MPDU aside */
+      m_currentAllocation.aggregateQueue = 0;
+      if (m_ampdu)
+        {
+          m_currentAllocation.aggregateQueue = CreateObject<WifiMacQueue> ();
+          WifiMacHeader mpduHdr;
+          Ptr<const Packet> mpdu;
+          while ((mpdu = m_aggregateQueue->Dequeue (&mpduHdr)) != 0)
+            {
+              m_currentAllocation.aggregateQueue->Enqueue (mpdu, mpduHdr);
+            }
+        }
       m_allocationPeriodsTable[m_currentAllocationID] = m_currentAllocation;
     }
   else
@@ -1360,6 +1416,11 @@ MacLow::ReceiveOk (Ptr<Packet> packet, double rxSnr, WifiTxVector txVector, Wifi
           NS_LOG_DEBUG ("Received Sector Sweep Frame");
           goto rxPacket;
         }
+      else if (hdr.IsPollFrame () || hdr.IsSprFrame ())
+        {
+          NS_LOG_DEBUG ("Received " << hdr.GetTypeString () << " Frame");
+          goto rxPacket;
+        }
       else if (hdr.IsQosData () && ReceiveMpdu (packet, hdr))
         {
           /* From section 9.10.4 in IEEE 802.11:
@@ -1375,7 +1436,8 @@ MacLow::ReceiveOk (Ptr<Packet> packet, double rxSnr, WifiTxVector txVector, Wifi
               RxCompleteBufferedPacketsWithSmallerSequence (it->second.first.GetStartingSequenceControl (),
                                                             hdr.GetAddr2 (), hdr.GetQosTid ());
               RxCompleteBufferedPacketsUntilFirstLost (hdr.GetAddr2 (), hdr.GetQosTid ());
-              NS_ASSERT (m_sendAckEvent.IsExpired ());
+              /* A hidden DMG STA may start its frame while our ACK is still pending, answer the latest one */
+              m_sendAckEvent.Cancel ();
               m_sendAckEvent = Simulator::Schedule (GetSifs (),
                                                     &MacLow::SendAckAfterData, this,
                                                     hdr.GetAddr2 (),
@@ -1432,7 +1494,8 @@ MacLow::ReceiveOk (Ptr<Packet> packet, double rxSnr, WifiTxVector txVector, Wifi
           else
             {
               NS_LOG_DEBUG ("rx unicast/sendAck from=" << hdr.GetAddr2 ());
-              NS_ASSERT (m_sendAckEvent.IsExpired ());
+              /* A hidden DMG STA may start its frame while our ACK is still pending, answer the latest one */
+              m_sendAckEvent.Cancel ();
               m_sendAckEvent = Simulator::Schedule (GetSifs (),
                                                     &MacLow::SendAckAfterData, this,
                                                     hdr.GetAddr2 (),
@@ -3436,6 +3499,20 @@ MacLow::StopMpduAggregation (Ptr<const Packet> peekedPacket, WifiMacHeader peeke
       return true;
     }
 
+  //In a DMG allocation, stop aggregating before the A-MPDU and its Block Ack overrun the time left, rather than suspending it
+  if (m_txParams.IsTransmissionBounded ())
+    {
+      WifiTxVector blockAckTxVector = GetBlockAckTxVector (m_currentHdr.GetAddr2 (), m_currentTxVector.GetMode ());
+      Time exchangeDuration = m_phy->CalculateTxDuration (aggregatedPacket->GetSize () + peekedPacket->GetSize () + peekedHdr.GetSize () + WIFI_MAC_FCS_LENGTH,
+                                                          m_currentTxVector, preamble, m_phy->GetFrequency ())
+        + GetSifs () + GetBlockAckDuration (m_currentHdr.GetAddr1 (), blockAckTxVector, COMPRESSED_BLOCK_ACK);
+      if (exchangeDuration > m_txParams.GetMaximumTransmissionDuration ())
+        {
+          NS_LOG_DEBUG ("no more packets can be aggregated to complete the A-MPDU exchange within the allocation");
+          return true;
+        }
+    }
+
   if (!listenerIt->second->GetMpduAggregator ()->CanBeAggregated (peekedPacket->GetSize () + peekedHdr.GetSize () + WIFI_MAC_FCS_LENGTH, aggregatedPacket, size))
     {
       NS_LOG_DEBUG ("no more packets can be aggregated because the maximum A-MPDU size has been reached");
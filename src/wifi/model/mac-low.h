@@ -827,6 +827,13 @@ public:
   bool IsTransmissionSuspended (void) const;
 
   bool RestoredSuspendedTransmission (void) const;
+  /**
+   * Check whether the sequence number of a suspended QoS Data frame fell out of the Block Ack window
+   * because later MPDUs of the same TID have been sequenced meanwhile.
+   * \param hdr the header of the suspended frame.
+   * \return True if the suspended frame is stale otherwise false.
+   */
+  bool IsStaleSuspendedTransmission (const WifiMacHeader &hdr) const;
 
   /**
    * \param packet packet to send
@@ -1598,12 +1605,14 @@ private:
     Ptr<Packet> packet;
     WifiMacHeader hdr;
     bool isAmpdu;
+    Ptr<WifiMacQueue> aggregateQueue;   //!< The MPDUs of the suspended A-MPDU.
     MacLowTransmissionParameters txParams;
     WifiTxVector txVector;
   } AllocationParameters;
 
   typedef std::map<AllocationID, AllocationParameters> AllocationPeriodsTable;
   typedef AllocationPeriodsTable::const_iterator AllocationPeriodsTableCI;
+  typedef AllocationPeriodsTable::iterator AllocationPeriodsTableI;
   AllocationPeriodsTable m_allocationPeriodsTable;
   AllocationID m_currentAllocationID;
   AllocationParameters m_currentAllocation;
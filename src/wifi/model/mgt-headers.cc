@@ -769,6 +769,12 @@ WifiActionHeader::GetAction ()
         case DMG_ROC_RESPONSE:
           retval.dmgAction = DMG_ROC_RESPONSE;
           break;
+        case DMG_CLUSTER_REQUEST:
+          retval.dmgAction = DMG_CLUSTER_REQUEST;
+          break;
+        case DMG_CLUSTER_RESPONSE:
+          retval.dmgAction = DMG_CLUSTER_RESPONSE;
+          break;
         default:
           NS_FATAL_ERROR ("Unknown DMG management action code");
           retval.selfProtectedAction = PEER_LINK_OPEN; /* quiet compiler */
@@ -2438,6 +2444,291 @@ ExtHandoverResponseHeader::GetHandoverRejectReason (void) const
   return static_cast<enum HandoverRejectReason> (m_handoverRejectReason);
 }
 
+/***************************************************
+*                 Cluster Request
+****************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED (ExtClusterRequestHeader);
+
+ExtClusterRequestHeader::ExtClusterRequestHeader ()
+  : m_sectorId (0),
+    m_antennaId (0),
+    m_countDown (0),
+    m_bestSectorId (0),
+    m_bestAntennaId (0)
+{
+}
+
+TypeId
+ExtClusterRequestHeader::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ExtClusterRequestHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<ExtClusterRequestHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+ExtClusterRequestHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void
+ExtClusterRequestHeader::Print (std::ostream &os) const
+{
+  os << "Cluster ID = " << m_clusterId
+     << ", Sector ID = " << uint16_t (m_sectorId)
+     << ", Antenna ID = " << uint16_t (m_antennaId)
+     << ", CDOWN = " << m_countDown;
+}
+
+uint32_t
+ExtClusterRequestHeader::GetSerializedSize (void) const
+{
+  uint32_t size = 0;
+  size += 6; //Cluster ID
+  size += 1; //Sector ID
+  size += 1; //Antenna ID
+  size += 2; //CDOWN
+  size += 1; //Best Sector ID
+  size += 1; //Best Antenna ID
+  return size;
+}
+
+void
+ExtClusterRequestHeader::Serialize (Buffer::Iterator start) const
+{
+  Buffer::Iterator i = start;
+  WriteTo (i, m_clusterId);
+  i.WriteU8 (m_sectorId);
+  i.WriteU8 (m_antennaId);
+  i.WriteHtolsbU16 (m_countDown);
+  i.WriteU8 (m_bestSectorId);
+  i.WriteU8 (m_bestAntennaId);
+}
+
+uint32_t
+ExtClusterRequestHeader::Deserialize (Buffer::Iterator start)
+{
+  Buffer::Iterator i = start;
+  ReadFrom (i, m_clusterId);
+  m_sectorId = i.ReadU8 ();
+  m_antennaId = i.ReadU8 ();
+  m_countDown = i.ReadLsbtohU16 ();
+  m_bestSectorId = i.ReadU8 ();
+  m_bestAntennaId = i.ReadU8 ();
+  return i.GetDistanceFrom (start);
+}
+
+void
+ExtClusterRequestHeader::SetClusterID (Mac48Address clusterId)
+{
+  m_clusterId = clusterId;
+}
+
+void
+ExtClusterRequestHeader::SetSectorID (uint8_t sectorId)
+{
+  m_sectorId = sectorId;
+}
+
+void
+ExtClusterRequestHeader::SetAntennaID (uint8_t antennaId)
+{
+  m_antennaId = antennaId;
+}
+
+void
+ExtClusterRequestHeader::SetCountDown (uint16_t countdown)
+{
+  m_countDown = countdown;
+}
+
+void
+ExtClusterRequestHeader::SetBestSectorID (uint8_t sectorId)
+{
+  m_bestSectorId = sectorId;
+}
+
+void
+ExtClusterRequestHeader::SetBestAntennaID (uint8_t antennaId)
+{
+  m_bestAntennaId = antennaId;
+}
+
+Mac48Address
+ExtClusterRequestHeader::GetClusterID (void) const
+{
+  return m_clusterId;
+}
+
+uint8_t
+ExtClusterRequestHeader::GetSectorID (void) const
+{
+  return m_sectorId;
+}
+
+uint8_t
+ExtClusterRequestHeader::GetAntennaID (void) const
+{
+  return m_antennaId;
+}
+
+uint16_t
+ExtClusterRequestHeader::GetCountDown (void) const
+{
+  return m_countDown;
+}
+
+uint8_t
+ExtClusterRequestHeader::GetBestSectorID (void) const
+{
+  return m_bestSectorId;
+}
+
+uint8_t
+ExtClusterRequestHeader::GetBestAntennaID (void) const
+{
+  return m_bestAntennaId;
+}
+
+/***************************************************
+*                 Cluster Response
+****************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED (ExtClusterResponseHeader);
+
+ExtClusterResponseHeader::ExtClusterResponseHeader ()
+  : m_status (0),
+    m_beaconSpIndex (0),
+    m_bestSectorId (0),
+    m_bestAntennaId (0)
+{
+}
+
+TypeId
+ExtClusterResponseHeader::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ExtClusterResponseHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<ExtClusterResponseHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+ExtClusterResponseHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void
+ExtClusterResponseHeader::Print (std::ostream &os) const
+{
+  os << "Cluster ID = " << m_clusterId
+     << ", Status = " << m_status
+     << ", Beacon SP Index = " << uint16_t (m_beaconSpIndex);
+}
+
+uint32_t
+ExtClusterResponseHeader::GetSerializedSize (void) const
+{
+  uint32_t size = 0;
+  size += 6; //Cluster ID
+  size += 2; //Status Code
+  size += 1; //Beacon SP Index
+  size += 1; //Best Sector ID
+  size += 1; //Best Antenna ID
+  return size;
+}
+
+void
+ExtClusterResponseHeader::Serialize (Buffer::Iterator start) const
+{
+  Buffer::Iterator i = start;
+  WriteTo (i, m_clusterId);
+  i.WriteHtolsbU16 (m_status);
+  i.WriteU8 (m_beaconSpIndex);
+  i.WriteU8 (m_bestSectorId);
+  i.WriteU8 (m_bestAntennaId);
+}
+
+uint32_t
+ExtClusterResponseHeader::Deserialize (Buffer::Iterator start)
+{
+  Buffer::Iterator i = start;
+  ReadFrom (i, m_clusterId);
+  m_status = i.ReadLsbtohU16 ();
+  m_beaconSpIndex = i.ReadU8 ();
+  m_bestSectorId = i.ReadU8 ();
+  m_bestAntennaId = i.ReadU8 ();
+  return i.GetDistanceFrom (start);
+}
+
+void
+ExtClusterResponseHeader::SetClusterID (Mac48Address clusterId)
+{
+  m_clusterId = clusterId;
+}
+
+void
+ExtClusterResponseHeader::SetStatusCode (uint16_t status)
+{
+  m_status = status;
+}
+
+void
+ExtClusterResponseHeader::SetBeaconSpIndex (uint8_t index)
+{
+  m_beaconSpIndex = index;
+}
+
+void
+ExtClusterResponseHeader::SetBestSectorID (uint8_t sectorId)
+{
+  m_bestSectorId = sectorId;
+}
+
+void
+ExtClusterResponseHeader::SetBestAntennaID (uint8_t antennaId)
+{
+  m_bestAntennaId = antennaId;
+}
+
+Mac48Address
+ExtClusterResponseHeader::GetClusterID (void) const
+{
+  return m_clusterId;
+}
+
+uint16_t
+ExtClusterResponseHeader::GetStatusCode (void) const
+{
+  return m_status;
+}
+
+uint8_t
+ExtClusterResponseHeader::GetBeaconSpIndex (void) const
+{
+  return m_beaconSpIndex;
+}
+
+uint8_t
+ExtClusterResponseHeader::GetBestSectorID (void) const
+{
+  return m_bestSectorId;
+}
+
+uint8_t
+ExtClusterResponseHeader::GetBestAntennaID (void) const
+{
+  return m_bestAntennaId;
+}
+
 /***************************************************
 *               Relay Search Request
 ****************************************************/
@@ -439,7 +439,10 @@ public:
     DMG_TPA_RESPONSE = 19,
     DMG_TPA_REPORT = 20,
     DMG_ROC_REQUEST = 21,
-    DMG_ROC_RESPONSE = 22
+    DMG_ROC_RESPONSE = 22,
+    /* Not part of Table 8-281b, used for centralized PCP/AP clustering */
+    DMG_CLUSTER_REQUEST = 23,
+    DMG_CLUSTER_RESPONSE = 24
   };
 
   /**
@@ -1322,6 +1325,126 @@ private:
 
 };
 
+/**
+ * \ingroup wifi
+ * Implement the header for extension frames of type Cluster Request frame. A PCP/AP
+ * willing to join a centralized cluster sweeps this frame through its transmit sectors
+ * right after the Beacon SP of the S-AP, each frame carries the sector it was sent
+ * through and the number of frames remaining in the sweep.
+ */
+class ExtClusterRequestHeader : public Header
+{
+public:
+  ExtClusterRequestHeader ();
+
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void);
+  // Inherited
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * Set the ID of the cluster the PCP/AP requests to join.
+   * \param clusterId The MAC address of the S-AP.
+   */
+  void SetClusterID (Mac48Address clusterId);
+  /**
+   * Set the transmit sector and antenna of this frame.
+   * \param sectorId The ID of the sector.
+   * \param antennaId The ID of the antenna.
+   */
+  void SetSectorID (uint8_t sectorId);
+  void SetAntennaID (uint8_t antennaId);
+  /**
+   * Set the number of Cluster Request frames remaining until the end of the sweep.
+   * \param countdown
+   */
+  void SetCountDown (uint16_t countdown);
+  /**
+   * Set the best sector and antenna of the requesting PCP/AP to receive from the S-AP,
+   * as measured during the reception of the DMG Beacons of the S-AP.
+   */
+  void SetBestSectorID (uint8_t sectorId);
+  void SetBestAntennaID (uint8_t antennaId);
+
+  Mac48Address GetClusterID (void) const;
+  uint8_t GetSectorID (void) const;
+  uint8_t GetAntennaID (void) const;
+  uint16_t GetCountDown (void) const;
+  uint8_t GetBestSectorID (void) const;
+  uint8_t GetBestAntennaID (void) const;
+
+private:
+  Mac48Address m_clusterId;
+  uint8_t m_sectorId;
+  uint8_t m_antennaId;
+  uint16_t m_countDown;
+  uint8_t m_bestSectorId;
+  uint8_t m_bestAntennaId;
+
+};
+
+/**
+ * \ingroup wifi
+ * Implement the header for extension frames of type Cluster Response frame. The S-AP
+ * answers a Cluster Request with the Beacon SP assigned to the requesting PCP/AP.
+ */
+class ExtClusterResponseHeader : public Header
+{
+public:
+  ExtClusterResponseHeader ();
+
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void);
+  // Inherited
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  void SetClusterID (Mac48Address clusterId);
+  /**
+   * Set the status of the request, a value of 0 indicates that the PCP/AP joined the cluster,
+   * any other value indicates that the cluster has no empty Beacon SP.
+   * \param status
+   */
+  void SetStatusCode (uint16_t status);
+  /**
+   * Set the index of the Beacon SP assigned to the requesting PCP/AP, counted from 1 for the S-AP.
+   * \param index
+   */
+  void SetBeaconSpIndex (uint8_t index);
+  /**
+   * Set the best sector and antenna of the requesting PCP/AP as measured by the S-AP.
+   */
+  void SetBestSectorID (uint8_t sectorId);
+  void SetBestAntennaID (uint8_t antennaId);
+
+  Mac48Address GetClusterID (void) const;
+  uint16_t GetStatusCode (void) const;
+  uint8_t GetBeaconSpIndex (void) const;
+  uint8_t GetBestSectorID (void) const;
+  uint8_t GetBestAntennaID (void) const;
+
+private:
+  Mac48Address m_clusterId;
+  uint16_t m_status;
+  uint8_t m_beaconSpIndex;
+  uint8_t m_bestSectorId;
+  uint8_t m_bestAntennaId;
+
+};
+
 /**
  * \ingroup wifi
  * Implement the header for extension frames of type Relay Search Request frame.
@@ -8,12 +8,17 @@
 #include "ns3/llc-snap-header.h"
 #include "ns3/packet.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
 #include "ns3/pointer.h"
 #include "ns3/node.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/log.h"
 #include "ns3/socket.h"
 
+#include <cmath>
+
 #include "dmg-sta-wifi-mac.h"
 #include "multi-band-net-device.h"
 #include "regular-wifi-mac.h"
@@ -41,6 +46,42 @@ MultiBandNetDevice::GetTypeId (void)
                    MakeUintegerAccessor (&MultiBandNetDevice::SetMtu,
                                          &MultiBandNetDevice::GetMtu),
                    MakeUintegerChecker<uint16_t> (1, MAX_MSDU_SIZE - LLC_SNAP_HEADER_LENGTH))
+
+    /* Automatic Fast Session Transfer */
+    .AddAttribute ("AutomaticFst", "Whether to transfer sessions between bands based on the 60 GHz link quality.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&MultiBandNetDevice::m_automaticFst),
+                   MakeBooleanChecker ())
+    .AddAttribute ("FstSwitchThreshold", "The predicted 60 GHz SNR (dB) below which the session leaves the 60 GHz band.",
+                   DoubleValue (10.0),
+                   MakeDoubleAccessor (&MultiBandNetDevice::m_fstSwitchThreshold),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("FstRecoveryThreshold", "The 60 GHz SNR (dB) above which the session returns to the 60 GHz band. "
+                   "It must be higher than FstSwitchThreshold to provide hysteresis.",
+                   DoubleValue (15.0),
+                   MakeDoubleAccessor (&MultiBandNetDevice::m_fstRecoveryThreshold),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("FstPredictionHorizon", "How far ahead the 60 GHz SNR trend is extrapolated.",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&MultiBandNetDevice::m_fstPredictionHorizon),
+                   MakeTimeChecker ())
+    .AddAttribute ("FstRecoveryHoldTime", "How long the 60 GHz link must stay above FstRecoveryThreshold before switching back.",
+                   TimeValue (MilliSeconds (200)),
+                   MakeTimeAccessor (&MultiBandNetDevice::m_fstRecoveryHoldTime),
+                   MakeTimeChecker ())
+    .AddAttribute ("FstSmoothingFactor", "The weight of the latest sample in the 60 GHz SNR and trend averages.",
+                   DoubleValue (0.2),
+                   MakeDoubleAccessor (&MultiBandNetDevice::m_fstSmoothingFactor),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("FstMaxFailedTransmissions", "The number of consecutive unacknowledged MPDUs over the 60 GHz band "
+                   "which triggers FST.",
+                   UintegerValue (16),
+                   MakeUintegerAccessor (&MultiBandNetDevice::m_fstMaxFailedTransmissions),
+                   MakeUintegerChecker<uint32_t> (1))
+
+    .AddTraceSource ("FstTriggered", "The 60 GHz link quality has triggered a fast session transfer.",
+                     MakeTraceSourceAccessor (&MultiBandNetDevice::m_fstTriggered),
+                     "ns3::MultiBandNetDevice::FstTriggeredCallback")
   ;
   return tid;
 }
@@ -119,6 +160,18 @@ MultiBandNetDevice::CompleteConfig (void)
       technology->Mac->SetLinkDownCallback (MakeCallback (&MultiBandNetDevice::LinkDown, this));
       technology->StationManager->SetupPhy (technology->Phy);
       technology->StationManager->SetupMac (technology->Mac);
+      if (technology->Standard == WIFI_PHY_STANDARD_80211ad)
+        {
+          /* Monitor the 60 GHz link quality for automatic FST */
+          technology->StationManager->TraceConnectWithoutContext ("MacRxOK", MakeCallback (&MultiBandNetDevice::DmgRxOk, this));
+          technology->StationManager->TraceConnectWithoutContext ("MacTxOK", MakeCallback (&MultiBandNetDevice::DmgTxOk, this));
+          technology->StationManager->TraceConnectWithoutContext ("MacTxDataFailed", MakeCallback (&MultiBandNetDevice::DmgTxFailed, this));
+          Ptr<DmgStaWifiMac> dmgStaMac = DynamicCast<DmgStaWifiMac> (technology->Mac);
+          if (dmgStaMac != 0)
+            {
+              dmgStaMac->TraceConnectWithoutContext ("BeaconMissed", MakeCallback (&MultiBandNetDevice::DmgBeaconMissed, this));
+            }
+        }
     }
   m_configComplete = true;
 }
@@ -239,6 +292,12 @@ MultiBandNetDevice::BandChanged (enum WifiPhyStandard standard, Mac48Address add
       m_stationManager->RecordGotAssocTxOk (Mac48Address (address));
     }
 
+  /* The transfer has completed, so the 60 GHz link has to prove itself again before any new transfer */
+  DmgLinkQuality &quality = GetDmgLinkQuality (address);
+  quality.TransferPending = false;
+  quality.FailedTransmissions = 0;
+  quality.RecoveryStart = Time::Max ();
+
   m_mac->NotifyBandChanged (standard, address, isInitiator);
 }
 
@@ -250,6 +309,144 @@ MultiBandNetDevice::EstablishFastSessionTransferSession (Mac48Address address)
   mac->SetupFSTSession (address);
 }
 
+DmgLinkQuality &
+MultiBandNetDevice::GetDmgLinkQuality (Mac48Address address)
+{
+  DmgLinkQualityMap::iterator it = m_dmgLinkQuality.find (address);
+  if (it == m_dmgLinkQuality.end ())
+    {
+      DmgLinkQuality quality;
+      quality.Snr = 0;
+      quality.SnrTrend = 0;
+      quality.LastUpdate = Time::Max ();
+      quality.FailedTransmissions = 0;
+      quality.RecoveryStart = Time::Max ();
+      quality.TransferPending = false;
+      it = m_dmgLinkQuality.insert (std::make_pair (address, quality)).first;
+    }
+  return it->second;
+}
+
+void
+MultiBandNetDevice::DmgRxOk (Mac48Address address, double snr)
+{
+  NS_LOG_FUNCTION (this << address << snr);
+  if (!m_automaticFst)
+    {
+      return;
+    }
+
+  DmgLinkQuality &quality = GetDmgLinkQuality (address);
+  double snrDb = 10 * std::log10 (snr);
+  Time now = Simulator::Now ();
+  if (quality.LastUpdate == Time::Max ())
+    {
+      quality.Snr = snrDb;
+    }
+  else if (now > quality.LastUpdate)
+    {
+      double slope = (snrDb - quality.Snr) / (now - quality.LastUpdate).GetSeconds ();
+      quality.SnrTrend = m_fstSmoothingFactor * slope + (1 - m_fstSmoothingFactor) * quality.SnrTrend;
+      quality.Snr = m_fstSmoothingFactor * snrDb + (1 - m_fstSmoothingFactor) * quality.Snr;
+    }
+  quality.LastUpdate = now;
+
+  if (m_standard == WIFI_PHY_STANDARD_80211ad)
+    {
+      /* Leave the 60 GHz band before the outage happens by extrapolating the SNR trend */
+      double predictedSnr = quality.Snr + quality.SnrTrend * m_fstPredictionHorizon.GetSeconds ();
+      if (predictedSnr < m_fstSwitchThreshold)
+        {
+          NS_LOG_DEBUG ("Predicted 60 GHz SNR=" << predictedSnr << " dB towards " << address << " is below the threshold");
+          TriggerFastSessionTransfer (address, Band_4_9GHz);
+        }
+    }
+  else if (quality.Snr >= m_fstRecoveryThreshold)
+    {
+      /* Return to the 60 GHz band once the link has been stable for the hold time */
+      if (quality.RecoveryStart == Time::Max ())
+        {
+          quality.RecoveryStart = now;
+        }
+      else if (now - quality.RecoveryStart >= m_fstRecoveryHoldTime)
+        {
+          NS_LOG_DEBUG ("60 GHz link towards " << address << " has recovered with SNR=" << quality.Snr << " dB");
+          TriggerFastSessionTransfer (address, Band_60GHz);
+        }
+    }
+  else
+    {
+      quality.RecoveryStart = Time::Max ();
+    }
+}
+
+void
+MultiBandNetDevice::DmgTxOk (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  if (m_automaticFst)
+    {
+      GetDmgLinkQuality (address).FailedTransmissions = 0;
+    }
+}
+
+void
+MultiBandNetDevice::DmgTxFailed (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  if (m_automaticFst && (m_standard == WIFI_PHY_STANDARD_80211ad))
+    {
+      DmgLinkQuality &quality = GetDmgLinkQuality (address);
+      quality.FailedTransmissions++;
+      if (quality.FailedTransmissions >= m_fstMaxFailedTransmissions)
+        {
+          NS_LOG_DEBUG ("Missed " << quality.FailedTransmissions << " consecutive acknowledgements from " << address);
+          TriggerFastSessionTransfer (address, Band_4_9GHz);
+        }
+    }
+}
+
+void
+MultiBandNetDevice::DmgBeaconMissed (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  if (m_automaticFst && (m_standard == WIFI_PHY_STANDARD_80211ad))
+    {
+      GetDmgLinkQuality (address).RecoveryStart = Time::Max ();
+      TriggerFastSessionTransfer (address, Band_4_9GHz);
+    }
+}
+
+void
+MultiBandNetDevice::TriggerFastSessionTransfer (Mac48Address address, BandID bandId)
+{
+  NS_LOG_FUNCTION (this << address << bandId);
+  DmgLinkQuality &quality = GetDmgLinkQuality (address);
+  if (quality.TransferPending)
+    {
+      return;
+    }
+  enum WifiPhyStandard standard = WIFI_PHY_STANDARD_80211ad;
+  if (bandId != Band_60GHz)
+    {
+      /* Use the first legacy band available on this device */
+      WifiTechnologyList::const_iterator item = m_list.begin ();
+      while ((item != m_list.end ()) && (item->first == WIFI_PHY_STANDARD_80211ad))
+        {
+          item++;
+        }
+      if (item == m_list.end ())
+        {
+          return;
+        }
+      standard = item->first;
+      bandId = (standard == WIFI_PHY_STANDARD_80211n_2_4GHZ) ? Band_2_4GHz : Band_4_9GHz;
+    }
+  quality.TransferPending = true;
+  m_fstTriggered (address, standard);
+  StaticCast<RegularWifiMac> (m_mac)->SetupFSTSession (address, bandId);
+}
+
 Ptr<WifiMac>
 MultiBandNetDevice::GetTechnologyMac (enum WifiPhyStandard standard)
 {
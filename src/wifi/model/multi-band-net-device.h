@@ -11,7 +11,9 @@
 #include "ns3/net-device.h"
 #include "ns3/packet.h"
 #include "ns3/traced-callback.h"
+#include "ns3/nstime.h"
 #include "wifi-phy-standard.h"
+#include "dmg-information-elements.h"
 #include <string>
 #include <map>
 
@@ -37,6 +39,18 @@ typedef std::map<enum WifiPhyStandard, WifiTechnology> WifiTechnologyList;
 /* Typedef to map each station with specific access technology */
 typedef std::map<Mac48Address, Ptr<WifiMac> > TransmissionTechnologyMap;
 
+/* Quality of the 60 GHz link towards a peer station as seen by the automatic FST controller */
+typedef struct {
+  double Snr;                       /* Smoothed SNR in dB */
+  double SnrTrend;                  /* Smoothed SNR slope in dB per second */
+  Time LastUpdate;                  /* The time of the last SNR sample */
+  uint32_t FailedTransmissions;     /* Number of consecutive failed MPDU transmissions */
+  Time RecoveryStart;               /* The time at which the link quality went back above the recovery threshold */
+  bool TransferPending;             /* Flag to indicate that an FST session has been requested but not completed */
+} DmgLinkQuality;
+
+typedef std::map<Mac48Address, DmgLinkQuality> DmgLinkQualityMap;
+
 /**
  * \brief Hold together all Wifi-related objects.
  * \ingroup wifi
@@ -214,6 +228,42 @@ private:
    */
   uint8_t SelectQueue (Ptr<QueueItem> item) const;
 
+  /** Automatic Fast Session Transfer **/
+
+  /**
+   * Get the quality record of the 60 GHz link towards a peer station.
+   * \param address The MAC address of the peer station.
+   * \return The quality record of the link.
+   */
+  DmgLinkQuality &GetDmgLinkQuality (Mac48Address address);
+  /**
+   * Called when a frame has been received over the 60 GHz band.
+   * \param address The MAC address of the peer station.
+   * \param snr The SNR of the received frame (linear ratio).
+   */
+  void DmgRxOk (Mac48Address address, double snr);
+  /**
+   * Called when an MPDU has been acknowledged over the 60 GHz band.
+   * \param address The MAC address of the peer station.
+   */
+  void DmgTxOk (Mac48Address address);
+  /**
+   * Called when an MPDU (or an A-MPDU subframe) has not been acknowledged over the 60 GHz band.
+   * \param address The MAC address of the peer station.
+   */
+  void DmgTxFailed (Mac48Address address);
+  /**
+   * Called when the DMG STA has lost the DMG Beacons of its PCP/AP.
+   * \param address The BSSID of the PCP/AP.
+   */
+  void DmgBeaconMissed (Mac48Address address);
+  /**
+   * Transfer the session with a peer station to another band if no transfer is pending.
+   * \param address The MAC address of the peer station.
+   * \param bandId The band to which the session is transferred.
+   */
+  void TriggerFastSessionTransfer (Mac48Address address, BandID bandId);
+
   uint32_t m_ifIndex;
   bool m_linkUp;
   TracedCallback<> m_linkChanges;
@@ -236,6 +286,25 @@ private:
   TransmissionTechnologyMap m_technologyMap;  //!< Map between peer station and the corresponding transmission technology.
   Mac48Address m_address;                     //!< Address of this Multi-Band Device (Mac48Address).
 
+  /* Automatic Fast Session Transfer */
+  bool m_automaticFst;                        //!< Flag to indicate whether FST is triggered by the 60 GHz link quality.
+  double m_fstSwitchThreshold;                //!< The predicted SNR (dB) below which we leave the 60 GHz band.
+  double m_fstRecoveryThreshold;              //!< The SNR (dB) above which the 60 GHz link is considered recovered.
+  Time m_fstPredictionHorizon;                //!< How far ahead the SNR trend is extrapolated.
+  Time m_fstRecoveryHoldTime;                 //!< How long the 60 GHz link must stay recovered before switching back.
+  double m_fstSmoothingFactor;                //!< The weight of the latest sample in the SNR and trend averages.
+  uint32_t m_fstMaxFailedTransmissions;       //!< The number of consecutive failed MPDUs that triggers FST.
+  DmgLinkQualityMap m_dmgLinkQuality;         //!< The quality of the 60 GHz link towards each peer station.
+
+  /**
+   * TracedCallback signature for automatic FST events.
+   *
+   * \param address The MAC address of the peer station.
+   * \param standard The standard of the band the session is transferred to.
+   */
+  typedef void (* FstTriggeredCallback)(Mac48Address address, enum WifiPhyStandard standard);
+  TracedCallback<Mac48Address, enum WifiPhyStandard> m_fstTriggered;
+
 };
 
 } //namespace ns3
@@ -851,7 +851,13 @@ RegularWifiMac::ForwardUp (Ptr<Packet> packet, Mac48Address from, Mac48Address t
 void
 RegularWifiMac::SetupFSTSession (Mac48Address staAddress)
 {
-  NS_LOG_FUNCTION (this << staAddress);
+  SetupFSTSession (staAddress, Band_4_9GHz);
+}
+
+void
+RegularWifiMac::SetupFSTSession (Mac48Address staAddress, BandID newBandId)
+{
+  NS_LOG_FUNCTION (this << staAddress << newBandId);
 
   WifiMacHeader hdr;
   hdr.SetAction ();
@@ -869,11 +875,11 @@ RegularWifiMac::SetupFSTSession (Mac48Address staAddress)
 
   SessionTransitionElement sessionTransition;
   Band newBand, oldBand;
-  newBand.Band_ID = Band_4_9GHz;
+  newBand.Band_ID = newBandId;
   newBand.Setup = 1;
   newBand.Operation = 1;
   sessionTransition.SetNewBand (newBand);
-  oldBand.Band_ID = Band_60GHz;
+  oldBand.Band_ID = (GetDmgSupported () ? Band_60GHz : Band_4_9GHz);
   oldBand.Setup = 1;
   oldBand.Operation = 1;
   sessionTransition.SetOldBand (oldBand);
@@ -890,7 +896,7 @@ RegularWifiMac::SetupFSTSession (Mac48Address staAddress)
   fstSession.ID = m_fstId;
   fstSession.CurrentState = FST_INITIAL_STATE;
   fstSession.IsInitiator = true;
-  fstSession.NewBandId = Band_4_9GHz;
+  fstSession.NewBandId = newBandId;
   fstSession.LLT = m_llt;
   m_fstSessionMap[staAddress] = fstSession;
 
@@ -1559,6 +1565,7 @@ RegularWifiMac::FinishConfigureStandard (enum WifiPhyStandard standard)
   switch (standard)
     {
     case WIFI_PHY_STANDARD_80211ad:
+    case WIFI_PHY_STANDARD_80211ay:
       SetDmgSupported (true);
       cwmin = 15;
       cwmax = 1023;
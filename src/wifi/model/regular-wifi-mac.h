@@ -346,6 +346,12 @@ public:
    * \param staAddress The address of the sta to establish FST session with it.
    */
   void SetupFSTSession (Mac48Address staAddress);
+  /**
+   * Setup FST session as initiator towards a specific frequency band.
+   * \param staAddress The address of the sta to establish FST session with it.
+   * \param newBandId The band to which the session is transferred.
+   */
+  void SetupFSTSession (Mac48Address staAddress, BandID newBandId);
   /**
    * Get Type Of Station.
    * \return station type
@@ -403,8 +409,16 @@ protected:
    * \param isInitiator
    */
   void ChangeBand (Mac48Address peerStation, BandID bandId, bool isInitiator);
-  void MacTxOk (Mac48Address address);
-  void MacRxOk (Mac48Address address);
+  /**
+   * This method is called by the remote station manager upon a successful transmission.
+   * \param address The MAC address of the peer station.
+   */
+  virtual void MacTxOk (Mac48Address address);
+  /**
+   * This method is called by the remote station manager upon a successful reception.
+   * \param address The MAC address of the peer station.
+   */
+  virtual void MacRxOk (Mac48Address address);
 
   uint32_t m_llt;                 //!< Link Loss Timeout.
   uint32_t m_fstId;
@@ -18,6 +18,7 @@
 #include "mpdu-aggregator.h"
 #include "mgt-headers.h"
 #include "qos-blocked-destinations.h"
+#include "edca-txop-n.h"
 #include "service-period.h"
 
 #undef NS_LOG_APPEND_CONTEXT
@@ -90,87 +91,6 @@ private:
 
 };
 
-class ServicePeriod::AggregationCapableTransmissionListener : public MacLowAggregationCapableTransmissionListener
-{
-public:
-  AggregationCapableTransmissionListener (ServicePeriod *sp)
-    : MacLowAggregationCapableTransmissionListener (),
-      m_sp (sp)
-  {
-  }
-  virtual ~AggregationCapableTransmissionListener ()
-  {
-  }
-
-  virtual void BlockAckInactivityTimeout (Mac48Address address, uint8_t tid)
-  {
-    m_sp->SendDelbaFrame (address, tid, false);
-  }
-  virtual Ptr<WifiMacQueue> GetQueue (void)
-  {
-    return m_sp->GetQueue ();
-  }
-  virtual  void CompleteTransfer (Mac48Address recipient, uint8_t tid)
-  {
-    m_sp->CompleteAmpduTransfer (recipient, tid);
-  }
-  virtual void SetAmpdu (Mac48Address dest, bool enableAmpdu)
-  {
-    return m_sp->SetAmpduExist (dest, enableAmpdu);
-  }
-  virtual void CompleteMpduTx (Ptr<const Packet> packet, WifiMacHeader hdr, Time tstamp)
-  {
-    m_sp->CompleteMpduTx (packet, hdr, tstamp);
-  }
-  virtual uint16_t GetNextSequenceNumberfor (WifiMacHeader *hdr)
-  {
-    return m_sp->GetNextSequenceNumberfor (hdr);
-  }
-  virtual uint16_t PeekNextSequenceNumberfor (WifiMacHeader *hdr)
-  {
-    return m_sp->PeekNextSequenceNumberfor (hdr);
-  }
-  virtual Ptr<const Packet> PeekNextPacketInBaQueue (WifiMacHeader &header, Mac48Address recipient, uint8_t tid, Time *timestamp)
-  {
-    return m_sp->PeekNextRetransmitPacket (header, recipient, tid, timestamp);
-  }
-  virtual void RemoveFromBaQueue (uint8_t tid, Mac48Address recipient, uint16_t seqnumber)
-  {
-    m_sp->RemoveRetransmitPacket (tid, recipient, seqnumber);
-  }
-  virtual bool GetBlockAckAgreementExists (Mac48Address address, uint8_t tid)
-  {
-    return m_sp->GetBaAgreementExists (address,tid);
-  }
-  virtual uint32_t GetNOutstandingPackets (Mac48Address address, uint8_t tid)
-  {
-    return m_sp->GetNOutstandingPacketsInBa (address, tid);
-  }
-  virtual uint32_t GetNRetryNeededPackets (Mac48Address recipient, uint8_t tid) const
-  {
-    return m_sp->GetNRetryNeededPackets (recipient, tid);
-  }
-  virtual Ptr<MsduAggregator> GetMsduAggregator (void) const
-  {
-    return m_sp->GetMsduAggregator ();
-  }
-  virtual Ptr<MpduAggregator> GetMpduAggregator (void) const
-  {
-    return m_sp->GetMpduAggregator ();
-  }
-  virtual Mac48Address GetSrcAddressForAggregation (const WifiMacHeader &hdr)
-  {
-    return m_sp->MapSrcAddressForAggregation (hdr);
-  }
-  virtual Mac48Address GetDestAddressForAggregation (const WifiMacHeader &hdr)
-  {
-    return m_sp->MapDestAddressForAggregation (hdr);
-  }
-
-private:
-  ServicePeriod *m_sp;
-};
-
 NS_OBJECT_ENSURE_REGISTERED (ServicePeriod);
 
 TypeId
@@ -194,21 +114,12 @@ ServicePeriod::ServicePeriod ()
     m_msduAggregator (0),
     m_mpduAggregator (0),
     m_typeOfStation (DMG_STA),
+    m_qosBlockedDestinations (0),
+    m_baManager (0),
     m_blockAckType (COMPRESSED_BLOCK_ACK)
 {
   NS_LOG_FUNCTION (this);
   m_transmissionListener = new ServicePeriod::TransmissionListener (this);
-  m_blockAckListener = new ServicePeriod::AggregationCapableTransmissionListener (this);
-  m_queue = CreateObject<WifiMacQueue> ();
-  m_qosBlockedDestinations = new QosBlockedDestinations ();
-  m_baManager = new BlockAckManager ();
-  m_baManager->SetQueue (m_queue);
-  m_baManager->SetBlockAckType (m_blockAckType);
-  m_baManager->SetBlockDestinationCallback (MakeCallback (&QosBlockedDestinations::Block, m_qosBlockedDestinations));
-  m_baManager->SetUnblockDestinationCallback (MakeCallback (&QosBlockedDestinations::Unblock, m_qosBlockedDestinations));
-  m_baManager->SetMaxPacketDelay (m_queue->GetMaxDelay ());
-  m_baManager->SetTxOkCallback (MakeCallback (&ServicePeriod::BaTxOk, this));
-  m_baManager->SetTxFailedCallback (MakeCallback (&ServicePeriod::BaTxFailed, this));
 }
 
 ServicePeriod::~ServicePeriod ()
@@ -221,45 +132,19 @@ ServicePeriod::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
   m_queue = 0;
+  m_edca = 0;
   m_low = 0;
   m_stationManager = 0;
   delete m_transmissionListener;
-  delete m_qosBlockedDestinations;
-  delete m_baManager;
-  delete m_blockAckListener;
   m_transmissionListener = 0;
+  /* The queue and the block ack state belong to the shared EDCA function */
   m_qosBlockedDestinations = 0;
   m_baManager = 0;
-  m_blockAckListener = 0;
   m_txMiddle = 0;
   m_msduAggregator = 0;
   m_mpduAggregator = 0;
 }
 
-bool
-ServicePeriod::GetBaAgreementExists (Mac48Address address, uint8_t tid)
-{
-  return m_baManager->ExistsAgreement (address, tid);
-}
-
-uint32_t
-ServicePeriod::GetNOutstandingPacketsInBa (Mac48Address address, uint8_t tid)
-{
-  return m_baManager->GetNBufferedPackets (address, tid);
-}
-
-uint32_t
-ServicePeriod::GetNRetryNeededPackets (Mac48Address recipient, uint8_t tid) const
-{
-  return m_baManager->GetNRetryNeededPackets (recipient, tid);
-}
-
-void
-ServicePeriod::CompleteAmpduTransfer (Mac48Address recipient, uint8_t tid)
-{
-  m_baManager->CompleteAmpduExchange (recipient, tid);
-}
-
 void
 ServicePeriod::SetTxOkCallback (TxPacketOk callback)
 {
@@ -286,7 +171,6 @@ ServicePeriod::SetWifiRemoteStationManager (Ptr<WifiRemoteStationManager> remote
 {
   NS_LOG_FUNCTION (this << remoteManager);
   m_stationManager = remoteManager;
-  m_baManager->SetWifiRemoteStationManager (m_stationManager);
 }
 
 void
@@ -317,6 +201,16 @@ ServicePeriod::SetTxMiddle (MacTxMiddle *txMiddle)
   m_txMiddle = txMiddle;
 }
 
+void
+ServicePeriod::SetEdcaTxopN (Ptr<EdcaTxopN> edca)
+{
+  NS_LOG_FUNCTION (this << edca);
+  m_edca = edca;
+  m_queue = edca->GetEdcaQueue ();
+  m_baManager = edca->GetBlockAckManager ();
+  m_qosBlockedDestinations = edca->GetQosBlockedDestinations ();
+}
+
 Ptr<MacLow>
 ServicePeriod::Low (void)
 {
@@ -335,31 +229,13 @@ bool
 ServicePeriod::NeedsAccess (void) const
 {
   NS_LOG_FUNCTION (this);
-  return !m_queue->IsEmpty () || m_currentPacket != 0 || m_baManager->HasPackets ();
-}
-
-uint16_t
-ServicePeriod::GetNextSequenceNumberfor (WifiMacHeader *hdr)
-{
-  return m_txMiddle->GetNextSequenceNumberfor (hdr);
-}
-
-uint16_t
-ServicePeriod::PeekNextSequenceNumberfor (WifiMacHeader *hdr)
-{
-  return m_txMiddle->PeekNextSequenceNumberfor (hdr);
+  return m_currentPacket != 0 || HasPacketsForPeer ();
 }
 
-Ptr<const Packet>
-ServicePeriod::PeekNextRetransmitPacket (WifiMacHeader &header, Mac48Address recipient, uint8_t tid, Time *timestamp)
-{
-  return m_baManager->PeekNextPacketByTidAndAddress (header, recipient, tid, timestamp);
-}
-
-void
-ServicePeriod::RemoveRetransmitPacket (uint8_t tid, Mac48Address recipient, uint16_t seqnumber)
+bool
+ServicePeriod::HasPacketsForPeer (void) const
 {
-  m_baManager->RemovePacket (tid, recipient, seqnumber);
+  return m_queue->HasPacketsForReceiver (m_peerStation) || m_baManager->HasPacketsForReceiver (m_peerStation);
 }
 
 Time
@@ -388,13 +264,13 @@ ServicePeriod::NotifyAccessGranted (void)
 
   if (m_currentPacket == 0)
     {
-      if (m_baManager->HasBar (m_currentBar))
+      if (m_baManager->HasBarForReceiver (m_currentBar, m_peerStation))
         {
           SendBlockAckRequest (m_currentBar);
           return;
         }
       /* check if packets need retransmission are stored in BlockAckManager */
-      m_currentPacket = m_baManager->GetNextPacket (m_currentHdr);
+      m_currentPacket = m_baManager->GetNextPacketByAddress (m_currentHdr, m_peerStation);
       if (m_currentPacket == 0)
         {
           /* Check if there is any available packets for the destination DMG STA in this SP */
@@ -457,7 +333,7 @@ ServicePeriod::NotifyAccessGranted (void)
             }
           if (((m_currentHdr.IsQosData () && !m_currentHdr.IsQosAmsdu ())
               || (m_currentHdr.IsData () && !m_currentHdr.IsQosData () && m_currentHdr.IsQosAmsdu ()))
-              && (m_blockAckThreshold == 0 || m_blockAckType == BASIC_BLOCK_ACK)
+              && (m_edca->GetBlockAckThreshold () == 0 || m_blockAckType == BASIC_BLOCK_ACK)
               && NeedFragmentation ())
             {
               //With COMPRESSED_BLOCK_ACK fragmentation must be avoided.
@@ -582,7 +458,7 @@ ServicePeriod::MissedCts (void)
               NS_FATAL_ERROR ("Current packet is not Qos Data nor BlockAckReq");
             }
 
-          if (GetBaAgreementExists (m_currentHdr.GetAddr1 (), tid))
+          if (m_baManager->ExistsAgreement (m_currentHdr.GetAddr1 (), tid))
             {
               NS_LOG_DEBUG ("Transmit Block Ack Request");
               CtrlBAckRequestHeader reqHdr;
@@ -718,7 +594,7 @@ ServicePeriod::MissedAck (void)
               NS_FATAL_ERROR ("Current packet is not Qos Data");
             }
 
-          if (GetBaAgreementExists (m_currentHdr.GetAddr1 (), tid))
+          if (m_baManager->ExistsAgreement (m_currentHdr.GetAddr1 (), tid))
             {
               //send Block ACK Request in order to shift WinStart at the receiver
               NS_LOG_DEBUG ("Transmit Block Ack Request");
@@ -858,9 +734,7 @@ void
 ServicePeriod::RestartAccessIfNeeded (void)
 {
   NS_LOG_FUNCTION (this);
-  if ((m_currentPacket != 0
-       || !m_queue->IsEmpty ()
-       || m_baManager->HasPackets ())
+  if ((m_currentPacket != 0 || HasPacketsForPeer ())
        && m_accessAllowed
        && !m_low->IsTransmissionSuspended ())
     {
@@ -873,7 +747,7 @@ ServicePeriod::StartAccessIfNeeded (void)
 {
   NS_LOG_FUNCTION (this);
   if (m_currentPacket == 0
-      && (!m_queue->IsEmpty () || m_baManager->HasPackets ())
+      && HasPacketsForPeer ()
       && m_accessAllowed
       && !m_low->IsTransmissionSuspended ())
     {
@@ -939,13 +813,19 @@ ServicePeriod::InitiateTransmission (void)
       PacketInformation info = it->second;
       m_currentPacket = info.first;
       m_currentHdr = info.second;
+      /* The other allocations share the Block Ack session, a stored MSDU left behind its window gets a new sequence number */
+      if ((m_currentPacket != 0) && m_low->IsStaleSuspendedTransmission (m_currentHdr))
+        {
+          m_currentHdr.SetSequenceNumber (m_txMiddle->GetNextSequenceNumberfor (&m_currentHdr));
+          m_currentHdr.SetNoRetry ();
+        }
     }
 
   /* Restore previously suspended transmission */
   m_low->RestoreAllocationParameters (m_allocationID);
 
   /* Start access if we have packets in the queue or packets that need retransmit or non-restored transmission */
-  if (!m_queue->IsEmpty () || m_baManager->HasPackets () || !m_low->RestoredSuspendedTransmission ())
+  if (HasPacketsForPeer () || !m_low->RestoredSuspendedTransmission ())
     {
       NotifyAccessGranted ();
     }
@@ -958,7 +838,7 @@ ServicePeriod::ResumeTransmission (Time servicePeriodDuration)
   m_servicePeriodDuration = servicePeriodDuration;
   m_transmissionStarted = Simulator::Now ();
   m_accessAllowed = true;
-  if (!m_queue->IsEmpty () || m_baManager->HasPackets ())
+  if (HasPacketsForPeer ())
     {
       NotifyAccessGranted ();
     }
@@ -977,8 +857,8 @@ void
 ServicePeriod::Queue (Ptr<const Packet> packet, WifiMacHeader &hdr)
 {
   NS_LOG_FUNCTION (this << packet << &hdr << hdr.GetAddr1 ());
-  m_stationManager->PrepareForQueue (hdr.GetAddr1 (), &hdr, packet);
-  m_queue->Enqueue (packet, hdr);
+  /* The packet joins the shared queue, so it can also be sent in a CBAP allocation */
+  m_edca->Queue (packet, hdr);
   StartAccessIfNeeded ();
 }
 
@@ -1264,28 +1144,11 @@ ServicePeriod::VerifyBlockAck (void)
 }
 
 bool
-ServicePeriod::GetAmpduExist (Mac48Address dest)
+ServicePeriod::GetAmpduExist (Mac48Address dest) const
 {
   NS_LOG_FUNCTION (this << dest);
-  if (m_aMpduEnabled.find (dest) != m_aMpduEnabled.end ())
-    {
-      return m_aMpduEnabled.find (dest)->second;
-    }
-  return false;
-}
-
-void
-ServicePeriod::SetAmpduExist (Mac48Address dest, bool enableAmpdu)
-{
-  NS_LOG_FUNCTION (this << dest << enableAmpdu);
-  if (m_aMpduEnabled.find (dest) != m_aMpduEnabled.end () && m_aMpduEnabled.find (dest)->second != enableAmpdu)
-    {
-      m_aMpduEnabled.erase (m_aMpduEnabled.find (dest));
-    }
-  if (m_aMpduEnabled.find (dest) == m_aMpduEnabled.end ())
-    {
-      m_aMpduEnabled.insert (std::make_pair (dest, enableAmpdu));
-    }
+  /* MacLow reports A-MPDU transmissions to the block ack listener of the shared EDCA function */
+  return m_edca->GetAmpduExist (dest);
 }
 
 void
@@ -1304,16 +1167,6 @@ ServicePeriod::CompleteTx (void)
     }
 }
 
-void
-ServicePeriod::CompleteMpduTx (Ptr<const Packet> packet, WifiMacHeader hdr, Time tstamp)
-{
-  NS_ASSERT (hdr.IsQosData ());
-  m_baManager->StorePacket (packet, hdr, tstamp);
-  m_baManager->NotifyMpduTransmission (hdr.GetAddr1 (), hdr.GetQosTid (),
-                                       m_txMiddle->GetNextSeqNumberByTidAndAddress (hdr.GetQosTid (),
-                                                                                    hdr.GetAddr1 ()), WifiMacHeader::NORMAL_ACK);
-}
-
 /* Test Function */
 void
 ServicePeriod::SetupBlockAck (uint8_t tid, Mac48Address recipient)
@@ -1321,7 +1174,7 @@ ServicePeriod::SetupBlockAck (uint8_t tid, Mac48Address recipient)
   NS_LOG_FUNCTION (this << tid << recipient);
   if (m_mpduAggregator != 0)
     {
-      SendAddBaRequest (recipient, tid, 0, m_blockAckInactivityTimeout, true);
+      SendAddBaRequest (recipient, tid, 0, m_edca->GetBlockAckInactivityTimeout (), true);
     }
 }
 
@@ -1334,11 +1187,12 @@ ServicePeriod::SetupBlockAckIfNeeded ()
 
   uint32_t packets = m_queue->GetNPacketsByTidAndAddress (tid, WifiMacHeader::ADDR1, recipient);
 
-  if ((m_blockAckThreshold > 0 && packets >= m_blockAckThreshold) || (packets > 1 && m_mpduAggregator != 0))
+  uint8_t blockAckThreshold = m_edca->GetBlockAckThreshold ();
+  if ((blockAckThreshold > 0 && packets >= blockAckThreshold) || (packets > 1 && m_mpduAggregator != 0))
     {
       /* Block ack setup */
       uint16_t startingSequence = m_txMiddle->GetNextSeqNumberByTidAndAddress (tid, recipient);
-      SendAddBaRequest (recipient, tid, startingSequence, m_blockAckInactivityTimeout, true);
+      SendAddBaRequest (recipient, tid, startingSequence, m_edca->GetBlockAckInactivityTimeout (), true);
       return true;
     }
   return false;
@@ -1392,37 +1246,6 @@ ServicePeriod::SendBlockAckRequest (const struct Bar &bar)
   m_low->StartTransmission (m_currentPacket, &m_currentHdr, params, m_transmissionListener);
 }
 
-void
-ServicePeriod::CompleteConfig (void)
-{
-  NS_LOG_FUNCTION (this);
-  m_baManager->SetTxMiddle (m_txMiddle);
-  m_low->RegisterBlockAckListenerForAc (AC_BE, m_blockAckListener);
-  m_baManager->SetBlockAckInactivityCallback (MakeCallback (&ServicePeriod::SendDelbaFrame, this));
-}
-
-void
-ServicePeriod::SetBlockAckThreshold (uint8_t threshold)
-{
-  NS_LOG_FUNCTION (this << static_cast<uint32_t> (threshold));
-  m_blockAckThreshold = threshold;
-  m_baManager->SetBlockAckThreshold (threshold);
-}
-
-void
-ServicePeriod::SetBlockAckInactivityTimeout (uint16_t timeout)
-{
-  NS_LOG_FUNCTION (this << timeout);
-  m_blockAckInactivityTimeout = timeout;
-}
-
-uint8_t
-ServicePeriod::GetBlockAckThreshold (void) const
-{
-  NS_LOG_FUNCTION (this);
-  return m_blockAckThreshold;
-}
-
 void
 ServicePeriod::SendAddBaRequest (Mac48Address dest, uint8_t tid, uint16_t startSeq,
                                  uint16_t timeout, bool immediateBAck)
@@ -1620,24 +1443,4 @@ ServicePeriod::DoInitialize ()
   NS_LOG_FUNCTION (this);
 }
 
-void
-ServicePeriod::BaTxOk (const WifiMacHeader &hdr)
-{
-  NS_LOG_FUNCTION (this << hdr);
-  if (!m_txOkCallback.IsNull ())
-    {
-      m_txOkCallback (m_currentPacket, m_currentHdr);
-    }
-}
-
-void
-ServicePeriod::BaTxFailed (const WifiMacHeader &hdr)
-{
-  NS_LOG_FUNCTION (this << hdr);
-  if (!m_txFailedCallback.IsNull ())
-    {
-      m_txFailedCallback (m_currentHdr);
-    }
-}
-
 } //namespace ns3
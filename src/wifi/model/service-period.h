@@ -35,6 +35,7 @@ class MpduAggregator;
 class MgtAddBaResponseHeader;
 class BlockAckManager;
 class MgtDelBaHeader;
+class EdcaTxopN;
 
 class ServicePeriod : public Object
 {
@@ -57,8 +58,6 @@ public:
    * packet transmission was failed.
    */
   typedef Callback <void, const WifiMacHeader&> TxFailed;
-  
-  std::map<Mac48Address, bool> m_aMpduEnabled;
 
   static TypeId GetTypeId (void);
   ServicePeriod ();
@@ -72,6 +71,16 @@ public:
    */
   void SetLow (Ptr<MacLow> low);
   void SetTxMiddle (MacTxMiddle *txMiddle);
+  /**
+   * Share the transmit state of an EDCA function: its queue, its block ack agreements
+   * (including the MPDUs waiting for retransmission) and its blocked destinations.
+   * The service period only transmits the frames destined to the peer station of the
+   * current SP, so a flow moves between CBAP and SP allocations without copying packets
+   * or negotiating a new block ack agreement.
+   *
+   * \param edca The EDCA function whose transmit state is shared.
+   */
+  void SetEdcaTxopN (Ptr<EdcaTxopN> edca);
   /**
    * \param callback the callback to invoke when a
    * packet transmission was completed successfully.
@@ -122,40 +131,6 @@ public:
   Ptr<MsduAggregator> GetMsduAggregator (void) const;
   Ptr<MpduAggregator> GetMpduAggregator (void) const;
 
-  /**
-   * \param recipient address of the peer station
-   * \param tid traffic ID.
-   * \return true if a block ack agreement exists, false otherwise
-   *
-   * Checks if a block ack agreement exists with station addressed by
-   * <i>recipient</i> for tid <i>tid</i>.
-   */
-  bool GetBaAgreementExists (Mac48Address address, uint8_t tid);
-  /**
-   * \param recipient address of peer station involved in block ack mechanism.
-   * \param tid traffic ID.
-   * \return the number of packets buffered for a specified agreement
-   *
-   * Returns number of packets buffered for a specified agreement.
-   */
-  uint32_t GetNOutstandingPacketsInBa (Mac48Address address, uint8_t tid);
-  /**
-   * \param recipient address of peer station involved in block ack mechanism.
-   * \param tid traffic ID.
-   * \return the number of packets for a specific agreement that need retransmission
-   *
-   * Returns number of packets for a specific agreement that need retransmission.
-   */
-  uint32_t GetNRetryNeededPackets (Mac48Address recipient, uint8_t tid) const;
-  /**
-   * \param recipient address of peer station involved in block ack mechanism.
-   * \param tid Ttraffic ID of transmitted packet.
-   *
-   * This function resets the status of OriginatorBlockAckAgreement after the transfer
-   * of an A-MPDU with ImmediateBlockAck policy (i.e. no BAR is scheduled)
-   */
-  void CompleteAmpduTransfer (Mac48Address recipient, uint8_t tid);
-
   /**
    * Check if the EDCAF requires access.
    *
@@ -364,67 +339,8 @@ public:
    */
   void PushFront (Ptr<const Packet> packet, const WifiMacHeader &hdr);
 
-  /**
-   * Complete block ACK configuration.
-   */
-  void CompleteConfig (void);
-
-  /**
-   * Set threshold for block ACK mechanism. If number of packets in the
-   * queue reaches the threshold, block ACK mechanism is used.
-   *
-   * \param threshold
-   */
-  void SetBlockAckThreshold (uint8_t threshold);
-  /**
-   * Return the current threshold for block ACK mechanism.
-   *
-   * \return the current threshold for block ACK mechanism
-   */
-  uint8_t GetBlockAckThreshold (void) const;
-
-  void SetBlockAckInactivityTimeout (uint16_t timeout);
   void SendDelbaFrame (Mac48Address addr, uint8_t tid, bool byOriginator);
-  void CompleteMpduTx (Ptr<const Packet> packet, WifiMacHeader hdr, Time tstamp);
-  bool GetAmpduExist (Mac48Address dest);
-  void SetAmpduExist (Mac48Address dest, bool enableAmpdu);
-
-  /**
-   * Return the next sequence number for the given header.
-   *
-   * \param hdr Wi-Fi header
-   *
-   * \return the next sequence number
-   */
-  uint16_t GetNextSequenceNumberfor (WifiMacHeader *hdr);
-  /**
-   * Return the next sequence number for the Traffic ID and destination, but do not pick it (i.e. the current sequence number remains unchanged).
-   *
-   * \param hdr Wi-Fi header
-   *
-   * \return the next sequence number
-   */
-  uint16_t PeekNextSequenceNumberfor (WifiMacHeader *hdr);
-  /**
-   * Remove a packet after you peek in the retransmit queue and get it
-   */
-  void RemoveRetransmitPacket (uint8_t tid, Mac48Address recipient, uint16_t seqnumber);
-  /*
-   * Peek in retransmit queue and get the next packet without removing it from the queue
-   */
-  Ptr<const Packet> PeekNextRetransmitPacket (WifiMacHeader &header, Mac48Address recipient, uint8_t tid, Time *timestamp);
-  /**
-   * The packet we sent was successfully received by the receiver
-   *
-   * \param hdr the header of the packet that we successfully sent
-   */
-  void BaTxOk (const WifiMacHeader &hdr);
-  /**
-   * The packet we sent was successfully received by the receiver
-   *
-   * \param hdr the header of the packet that we failed to sent
-   */
-  void BaTxFailed (const WifiMacHeader &hdr);
+  bool GetAmpduExist (Mac48Address dest) const;
 
   /**
    * TracedCallback signature for Access Granted events.
@@ -496,9 +412,12 @@ private:
    * if an established block ack agreement exists with the receiver.
    */
   void VerifyBlockAck (void);
+  /**
+   * \return true if the shared queue or block ack manager hold frames for the peer station.
+   */
+  bool HasPacketsForPeer (void) const;
 
   class TransmissionListener;
-  class AggregationCapableTransmissionListener;
   friend class TransmissionListener;
 
   Ptr<WifiMacQueue> m_queue;
@@ -507,7 +426,6 @@ private:
   Ptr<MacLow> m_low;
   MacTxMiddle *m_txMiddle;
   TransmissionListener *m_transmissionListener;
-  AggregationCapableTransmissionListener *m_blockAckListener;
   Ptr<WifiRemoteStationManager> m_stationManager;
   uint8_t m_fragmentNumber;
 
@@ -519,15 +437,11 @@ private:
   Ptr<MsduAggregator> m_msduAggregator;
   Ptr<MpduAggregator> m_mpduAggregator;
   TypeOfStation m_typeOfStation;
-  QosBlockedDestinations *m_qosBlockedDestinations;
-  BlockAckManager *m_baManager;
-  /*
-   * Represents the minimum number of packets for use of block ack.
-   */
-  uint8_t m_blockAckThreshold;
+  Ptr<EdcaTxopN> m_edca;                          //!< The EDCA function sharing its transmit state.
+  QosBlockedDestinations *m_qosBlockedDestinations; //!< The blocked destinations of the shared EDCA function.
+  BlockAckManager *m_baManager;                   //!< The block ack agreements of the shared EDCA function.
   enum BlockAckType m_blockAckType;
   Time m_currentPacketTimestamp;
-  uint16_t m_blockAckInactivityTimeout;
   struct Bar m_currentBar;
   Ptr<WifiMac> m_wifiMac;
 
@@ -65,9 +65,15 @@ enum
 };
 
 WifiMacHeader::WifiMacHeader ()
-  : m_ctrlMoreData (0),
+  : m_ctrlToDs (0),
+    m_ctrlFromDs (0),
+    m_ctrlMoreFrag (0),
+    m_ctrlRetry (0),
+    m_ctrlMoreData (0),
     m_ctrlWep (0),
     m_ctrlOrder (1),
+    m_seqFrag (0),
+    m_seqSeq (0),
     m_amsduPresent (0),
     m_dmgPpdu (false),
     m_beamRefinementRequired (false),
@@ -1222,27 +1228,27 @@ WifiMacHeader::GetSize (void) const
         case SUBTYPE_CTL_EXTENSION:
           switch (m_ctrlFrameExtension)
             {
-            case WIFI_MAC_CTL_DMG_POLL:
+            case SUBTYPE_CTL_EXTENSION_POLL:
               size = 2 + 2 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_SPR:
-            case WIFI_MAC_CTL_DMG_GRANT:
+            case SUBTYPE_CTL_EXTENSION_SPR:
+            case SUBTYPE_CTL_EXTENSION_GRANT:
               size = 2 + 2 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_CTS:
+            case SUBTYPE_CTL_EXTENSION_DMG_CTS:
               size = 2 + 2 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_DTS:
+            case SUBTYPE_CTL_EXTENSION_DMG_DTS:
               size = 2 + 2 + 6 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_SSW:
+            case SUBTYPE_CTL_EXTENSION_SSW:
               size = 2 + 2 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_SSW_FBCK:
-            case WIFI_MAC_CTL_DMG_SSW_ACK:
+            case SUBTYPE_CTL_EXTENSION_SSW_FBCK:
+            case SUBTYPE_CTL_EXTENSION_SSW_ACK:
               size = 2 + 2 + 6 + 6;
               break;
-            case WIFI_MAC_CTL_DMG_GRANT_ACK:
+            case SUBTYPE_CTL_EXTENSION_GRANT_ACK:
               size = 2 + 2 + 6 + 6;
               break;
             }
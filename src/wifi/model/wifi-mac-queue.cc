@@ -586,4 +586,19 @@ WifiMacQueue::HasPacketsForReceiver (Mac48Address addr)
   return false;
 }
 
+uint32_t
+WifiMacQueue::GetNBytesForReceiver (Mac48Address addr)
+{
+  Cleanup ();
+  uint32_t nBytes = 0;
+  for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); it++)
+    {
+      if (GetAddressForPacket (WifiMacHeader::AddressType::ADDR1, it) == addr)
+        {
+          nBytes += it->packet->GetSize () + it->hdr.GetSize ();
+        }
+    }
+  return nBytes;
+}
+
 } //namespace ns3
@@ -263,6 +263,12 @@ public:
    * \return true if the queue has at least one packet for the provided receiver address.
    */
   bool HasPacketsForReceiver (Mac48Address addr);
+  /**
+   * Return the number of bytes queued for the provided receiver address, MAC headers included.
+   * \param addr The MAC Address of the receiver.
+   * \return the number of bytes queued for the receiver.
+   */
+  uint32_t GetNBytesForReceiver (Mac48Address addr);
   /**
    * Flush the queue.
    */
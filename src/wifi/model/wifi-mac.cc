@@ -328,6 +328,7 @@ WifiMac::ConfigureStandard (enum WifiPhyStandard standard)
       Configure80211ac ();
       break;
     case WIFI_PHY_STANDARD_80211ad:
+    case WIFI_PHY_STANDARD_80211ay:
       Configure80211ad ();
       break;
     default:
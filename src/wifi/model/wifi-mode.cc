@@ -25,6 +25,7 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include <cmath>
+#include <algorithm>
 
 namespace ns3 {
 
@@ -75,10 +76,22 @@ WifiMode::GetPhyRate (uint32_t channelWidth, bool isShortGuardInterval, uint8_t
 {
   //TODO: nss > 4 not supported yet
   NS_ASSERT (nss <= 4);
-  uint32_t dataRate, phyRate;
+  uint64_t dataRate, phyRate;
   dataRate = GetDataRate (channelWidth, isShortGuardInterval, nss);
   switch (GetCodeRate ())
     {
+    case WIFI_CODE_RATE_7_8:
+      phyRate = dataRate * 8 / 7;
+      break;
+    case WIFI_CODE_RATE_13_16:
+      phyRate = dataRate * 16 / 13;
+      break;
+    case WIFI_CODE_RATE_5_8:
+      phyRate = dataRate * 8 / 5;
+      break;
+    case WIFI_CODE_RATE_1_4:
+      phyRate = dataRate * 4 / 1;
+      break;
     case WIFI_CODE_RATE_5_6:
       phyRate = dataRate * 6 / 5;
       break;
@@ -219,6 +232,11 @@ WifiMode::GetDataRate (uint32_t channelWidth, bool isShortGuardInterval, uint8_t
 
       dataRate = lrint (ceil (symbolRate * usableSubCarriers * numberOfBitsPerSubcarrier * codingRate));
     }
+  else if (item->modClass == WIFI_MOD_CLASS_EDMG_SC)
+    {
+      /* The EDMG SC rate of a single 2.16 GHz channel scales with the number of bonded channels */
+      dataRate = item->dataRate * std::max<uint32_t> (1, channelWidth / 2160);
+    }
   else
     {
       NS_ASSERT ("undefined datarate for the modulation class!");
@@ -641,6 +659,9 @@ WifiModeFactory::CreateWifiMode (std::string uniqueName,
     case WIFI_CODE_RATE_1_4:
       item->phyRate = dataRate * 4 / 1;
       break;
+    case WIFI_CODE_RATE_7_8:
+      item->phyRate = dataRate * 8 / 7;
+      break;
     case WIFI_CODE_RATE_UNDEFINED:
     default:
       item->phyRate = dataRate;
@@ -69,7 +69,9 @@ enum WifiModulationClass
   /** DMG Low-Power SC PHY (Clause 21.7) 802.11ad */
   WIFI_MOD_CLASS_DMG_LP_SC,
   /** VHT PHY (Clause 22) */
-  WIFI_MOD_CLASS_VHT
+  WIFI_MOD_CLASS_VHT,
+  /** EDMG SC PHY (Clause 28.5) 802.11ay */
+  WIFI_MOD_CLASS_EDMG_SC
 };
 
 /**
@@ -105,6 +107,8 @@ enum WifiCodeRate
   WIFI_CODE_RATE_52_63,
   /** Rate 13/14 */
   WIFI_CODE_RATE_13_14,
+  /** Rate 7/8 */
+  WIFI_CODE_RATE_7_8,
 };
 
 /**
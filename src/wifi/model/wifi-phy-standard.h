@@ -53,6 +53,8 @@ enum WifiPhyStandard
   WIFI_PHY_STANDARD_80211ad,
   /** VHT OFDM PHY (clause 22) */
   WIFI_PHY_STANDARD_80211ac,
+  /** EDMG PHY for 802.11ay (Clause 28) */
+  WIFI_PHY_STANDARD_80211ay,
   /** Unspecified */
   WIFI_PHY_STANDARD_UNSPECIFIED
 };
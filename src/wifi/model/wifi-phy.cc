@@ -161,7 +161,19 @@ WifiPhy::ChannelToFrequencyWidthMap WifiPhy::m_channelToFrequencyWidth =
   { std::make_pair (1, WIFI_PHY_STANDARD_80211ad), std::make_pair (58320, 2160) },
   { std::make_pair (2, WIFI_PHY_STANDARD_80211ad), std::make_pair (60480, 2160) },
   { std::make_pair (3, WIFI_PHY_STANDARD_80211ad), std::make_pair (62640, 2160) },
-  { std::make_pair (4, WIFI_PHY_STANDARD_80211ad), std::make_pair (64800, 2160) }
+  { std::make_pair (4, WIFI_PHY_STANDARD_80211ad), std::make_pair (64800, 2160) },
+
+  // 802.11ay/EDMG (2.16, 4.32, 6.48 and 8.64 GHz channels at the 56.16-64.8 GHz band)
+  { std::make_pair (1, WIFI_PHY_STANDARD_80211ay), std::make_pair (58320, 2160) },
+  { std::make_pair (2, WIFI_PHY_STANDARD_80211ay), std::make_pair (60480, 2160) },
+  { std::make_pair (3, WIFI_PHY_STANDARD_80211ay), std::make_pair (62640, 2160) },
+  { std::make_pair (4, WIFI_PHY_STANDARD_80211ay), std::make_pair (64800, 2160) },
+  { std::make_pair (9, WIFI_PHY_STANDARD_80211ay), std::make_pair (59400, 4320) },
+  { std::make_pair (10, WIFI_PHY_STANDARD_80211ay), std::make_pair (61560, 4320) },
+  { std::make_pair (11, WIFI_PHY_STANDARD_80211ay), std::make_pair (63720, 4320) },
+  { std::make_pair (17, WIFI_PHY_STANDARD_80211ay), std::make_pair (60480, 6480) },
+  { std::make_pair (18, WIFI_PHY_STANDARD_80211ay), std::make_pair (62640, 6480) },
+  { std::make_pair (25, WIFI_PHY_STANDARD_80211ay), std::make_pair (61560, 8640) }
 };
 
 TypeId
@@ -388,6 +400,11 @@ WifiPhy::DoDispose (void)
   m_state = 0;
   m_deviceRateSet.clear ();
   m_deviceMcsSet.clear ();
+  if (m_directionalAntenna != 0)
+    {
+      m_directionalAntenna->TraceDisconnectWithoutContext ("RxBeamChange", MakeCallback (&WifiPhy::NotifyRxBeamChange, this));
+    }
+  m_interference.SetDirectionalAntenna (0);
 }
 
 void 
@@ -739,6 +756,12 @@ WifiPhy::ConfigureDefaultsForStandard (enum WifiPhyStandard standard)
       // Channel number should be aligned by SetFrequency () to 36
       NS_ASSERT (GetChannelNumber () == 1);
       break;
+    case WIFI_PHY_STANDARD_80211ay:
+      SetChannelWidth (2160);
+      SetFrequency (58320);
+      // Channel number should be aligned by SetFrequency () to 1
+      NS_ASSERT (GetChannelNumber () == 1);
+      break;
     case WIFI_PHY_STANDARD_80211ac:
       SetChannelWidth (80);
       SetFrequency (5210);
@@ -961,6 +984,37 @@ WifiPhy::Configure80211ad (void)
   m_deviceRateSet.push_back (WifiPhy::GetDMG_MCS24 ());
 }
 
+void
+WifiPhy::Configure80211ay (void)
+{
+  NS_LOG_FUNCTION (this);
+  /* An EDMG STA is also a DMG STA */
+  Configure80211ad ();
+
+  /* EDMG SC-PHY */
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS1 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS2 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS3 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS4 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS5 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS6 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS7 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS8 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS9 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS10 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS11 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS12 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS13 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS14 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS15 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS16 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS17 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS18 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS19 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS20 ());
+  m_deviceRateSet.push_back (WifiPhy::GetEDMG_MCS21 ());
+}
+
 void
 WifiPhy::Configure80211ac (void)
 {
@@ -1125,6 +1179,9 @@ WifiPhy::ConfigureStandard (enum WifiPhyStandard standard)
     case WIFI_PHY_STANDARD_80211ad:
       Configure80211ad ();
       break;
+    case WIFI_PHY_STANDARD_80211ay:
+      Configure80211ay ();
+      break;
     case WIFI_PHY_STANDARD_80211ac:
       Configure80211ac ();
       break;
@@ -1206,7 +1263,8 @@ WifiPhy::GetFrequency (void) const
 void
 WifiPhy::SetChannelWidth (uint32_t channelwidth)
 {
-  NS_ASSERT_MSG (channelwidth == 5 || channelwidth == 10 || channelwidth == 20 || channelwidth == 22 || channelwidth == 40 || channelwidth == 80 || channelwidth == 160 || channelwidth == 2160, "wrong channel width value");
+  NS_ASSERT_MSG (channelwidth == 5 || channelwidth == 10 || channelwidth == 20 || channelwidth == 22 || channelwidth == 40 || channelwidth == 80 || channelwidth == 160
+                 || channelwidth == 2160 || channelwidth == 4320 || channelwidth == 6480 || channelwidth == 8640, "wrong channel width value");
   m_channelWidth = channelwidth;
   AddSupportedChannelWidth (channelwidth);
 }
@@ -1560,6 +1618,7 @@ WifiPhy::GetPlcpHeaderMode (WifiMode payloadMode, WifiPreamble preamble, WifiTxV
       return WifiPhy::GetDMG_MCS0 ();
 
     case WIFI_MOD_CLASS_DMG_SC:
+    case WIFI_MOD_CLASS_EDMG_SC:
       return WifiPhy::GetDMG_MCS1 ();
 
     case WIFI_MOD_CLASS_DMG_OFDM:
@@ -1639,6 +1698,14 @@ WifiPhy::GetPlcpHeaderDuration (WifiTxVector txVector, WifiPreamble preamble)
     case WIFI_MOD_CLASS_DMG_OFDM:
       /* From Table 21-4 in 802.11ad spec 21.3.4 */
       return NanoSeconds (242);
+    case WIFI_MOD_CLASS_EDMG_SC:
+      {
+        /* L-Header and EDMG-Header-A are both sent like the DMG SC header (1024 chips each),
+         * followed by the EDMG-STF (19 Golay 128 sequences) and 1, 2 or 4 EDMG-CEF sequences
+         * (1152 chips each) for 1, 2 or 3-4 spatial streams. */
+        uint8_t cefFields = (txVector.GetNss () > 2) ? 4 : txVector.GetNss ();
+        return NanoSeconds (582 + 582 + 1382 + cefFields * 655);
+      }
     default:
       NS_FATAL_ERROR ("unsupported modulation class");
       return MicroSeconds (0);
@@ -1699,8 +1766,10 @@ WifiPhy::GetPlcpPreambleDuration (WifiTxVector txVector, WifiPreamble preamble)
 
     case WIFI_MOD_CLASS_DMG_SC:
     case WIFI_MOD_CLASS_DMG_LP_SC:
+    case WIFI_MOD_CLASS_EDMG_SC:
       // SC Preamble = 3328 Samples * Tc (Chip Time for SC), Tc = 0.57ns.
       // SC Preamble = 1.89 micro seconds.
+      // The EDMG PPDU starts with the same non-EDMG L-STF and L-CEF.
       return NanoSeconds (1891);
 
     case WIFI_MOD_CLASS_DMG_OFDM:
@@ -1714,6 +1783,19 @@ WifiPhy::GetPlcpPreambleDuration (WifiTxVector txVector, WifiPreamble preamble)
     }
 }
 
+Time
+WifiPhy::GetTrnFieldDuration (WifiTxVector txVector)
+{
+  if (txVector.GetMode ().GetModulationClass () == WIFI_MOD_CLASS_EDMG_SC)
+    {
+      /* An EDMG TRN-Unit consists of P subfields sent with the preamble AWV followed by M
+       * subfields for AWV training. With channel bonding the subfield is NCB times longer
+       * in chips but is sent at NCB times the chip rate, so its duration does not change. */
+      return (txVector.GetEdmgTrnUnitP () + txVector.GetEdmgTrnUnitM ()) * EDMGTRNSubfield;
+    }
+  return TRNUnit;
+}
+
 Time
 WifiPhy::GetPayloadDuration (uint32_t size, WifiTxVector txVector, WifiPreamble preamble, double frequency)
 {
@@ -2124,6 +2206,30 @@ WifiPhy::GetPayloadDuration (uint32_t size, WifiTxVector txVector, WifiPreamble
         return NanoSeconds (tData);
       }
 
+    case WIFI_MOD_CLASS_EDMG_SC:
+      {
+        /* 28.5.9 EDMG SC payload: TData = (Nblks * 512 + 64) * Tc, with every symbol block
+         * carrying NCB * Nss times the coded bits of a single channel, single stream block. */
+        uint32_t Ncbpb = 448 * log2 (payloadMode.GetConstellationSize ())
+                         * txVector.GetNumberOfBondedChannels () * txVector.GetNss ();
+        uint32_t Nbits = (size * 8); /* Nbits = Number of bits in the payload part. */
+        uint32_t Ncbits = CalculateEdmgCodedBits (Nbits, payloadMode);
+        uint32_t Ncw = (uint32_t) ceil (double (Ncbits) / 672.0);         /* Ncw = The number of LDPC codewords.  */
+        uint32_t Nblks = (uint32_t) ceil (double (Ncw) * 672.0 / Ncbpb);  /* Nblks = The number of symbol blocks. */
+
+        uint32_t tData; /* The duration of the data part */
+        tData = lrint (ceil ((double (Nblks) * 512 + 64) / 1.76));
+        NS_LOG_DEBUG ("bits " << Nbits << " cbits " << Ncbits << " NCB " << uint16_t (txVector.GetNumberOfBondedChannels ())
+                      << " Nss " << uint16_t (txVector.GetNss ()) << " Payload Time " << tData << " ns");
+
+        if (txVector.GetTrainngFieldLength () != 0)
+          {
+            if (tData < OFDMSCMin)
+              tData = OFDMSCMin;
+          }
+        return NanoSeconds (tData);
+      }
+
     case WIFI_MOD_CLASS_DMG_OFDM:
       {
         /* 21.3.4 Timeing Related Parameters, Table 21-4 TData = Nsym * Tsys(OFDM) */
@@ -2179,6 +2285,29 @@ WifiPhy::GetPayloadDuration (uint32_t size, WifiTxVector txVector, WifiPreamble
   }
 }
 
+uint32_t
+WifiPhy::CalculateEdmgCodedBits (uint32_t Nbits, WifiMode payloadMode)
+{
+  switch (payloadMode.GetCodeRate ())
+    {
+    case WIFI_CODE_RATE_1_4:
+      return Nbits * 4;
+    case WIFI_CODE_RATE_1_2:
+      return Nbits * 2;
+    case WIFI_CODE_RATE_5_8:
+      return (uint32_t) ceil (double (Nbits) * 8.0 / 5);
+    case WIFI_CODE_RATE_3_4:
+      return (uint32_t) ceil (double (Nbits) * 4.0 / 3);
+    case WIFI_CODE_RATE_13_16:
+      return (uint32_t) ceil (double (Nbits) * 16.0 / 13);
+    case WIFI_CODE_RATE_7_8:
+      return (uint32_t) ceil (double (Nbits) * 8.0 / 7);
+    default:
+      NS_FATAL_ERROR ("unsupported code rate");
+      return 0;
+    }
+}
+
 uint64_t
 WifiPhy::CaluclateTransmittedBits (uint32_t size, WifiTxVector txvector)
 {
@@ -2269,6 +2398,19 @@ WifiPhy::CaluclateTransmittedBits (uint32_t size, WifiTxVector txvector)
         return 3328 + 672 + Nsym * Ncbps; /* Preamble + Header + Payload */
       }
 
+    case WIFI_MOD_CLASS_EDMG_SC:
+      {
+        uint32_t Ncbpb = 448 * log2 (payloadMode.GetConstellationSize ())
+                         * txvector.GetNumberOfBondedChannels () * txvector.GetNss ();
+        uint32_t Ncbits = CalculateEdmgCodedBits (size * 8, payloadMode);
+        uint32_t Ncw = (uint32_t) ceil (Ncbits / 672.0);         /* Ncw = The number of LDPC codewords.  */
+        uint32_t Nblks = (uint32_t) ceil (Ncw * 672.0 / Ncbpb);  /* Nblks = The number of symbol blocks. */
+
+        return 3328 + 1024 + 1024  /* Preamble + L-Header + EDMG-Header-A */
+               + (Nblks + 1) * 64 * txvector.GetNumberOfBondedChannels () * txvector.GetNss () /* Guard Interval Bits */
+               + (Nblks * Ncbpb);  /* Number of Bits Per Block */
+      }
+
     default:
       NS_FATAL_ERROR ("unsupported modulation class");
       return 0;
@@ -2335,7 +2477,16 @@ WifiPhy::GetAntenna (void) const
 void
 WifiPhy::SetDirectionalAntenna (Ptr<DirectionalAntenna> antenna)
 {
+  if (m_directionalAntenna != 0)
+    {
+      m_directionalAntenna->TraceDisconnectWithoutContext ("RxBeamChange", MakeCallback (&WifiPhy::NotifyRxBeamChange, this));
+    }
   m_directionalAntenna = antenna;
+  m_interference.SetDirectionalAntenna (antenna);
+  if (antenna != 0)
+    {
+      antenna->TraceConnectWithoutContext ("RxBeamChange", MakeCallback (&WifiPhy::NotifyRxBeamChange, this));
+    }
 }
 
 Ptr<DirectionalAntenna>
@@ -2344,6 +2495,13 @@ WifiPhy::GetDirectionalAntenna (void) const
   return m_directionalAntenna;
 }
 
+void
+WifiPhy::NotifyRxBeamChange (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_interference.UpdateRxBeam ();
+}
+
 void
 WifiPhy::NotifyTxBegin (Ptr<const Packet> packet)
 {
@@ -3807,6 +3965,280 @@ WifiPhy::GetDMG_MCS31 ()
   return mode;
 }
 
+/**** EDMG SC MCSs ****/
+WifiMode
+WifiPhy::GetEDMG_MCS1 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS1",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 385000000,
+                                     WIFI_CODE_RATE_1_4, /* 2 repetition */
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS2 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS2",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 770000000,
+                                     WIFI_CODE_RATE_1_2,
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS3 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS3",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 962500000,
+                                     WIFI_CODE_RATE_5_8,
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS4 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS4",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 1155000000,
+                                     WIFI_CODE_RATE_3_4,
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS5 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS5",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 1251250000,
+                                     WIFI_CODE_RATE_13_16,
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS6 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS6",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     true,
+                                     1880000000, 1347500000,
+                                     WIFI_CODE_RATE_7_8,
+                                     2);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS7 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS7",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 1540000000,
+                                     WIFI_CODE_RATE_1_2,
+                                     4);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS8 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS8",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 1925000000,
+                                     WIFI_CODE_RATE_5_8,
+                                     4);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS9 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS9",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 2310000000ULL,
+                                     WIFI_CODE_RATE_3_4,
+                                     4);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS10 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS10",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 2502500000ULL,
+                                     WIFI_CODE_RATE_13_16,
+                                     4);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS11 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS11",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 2695000000ULL,
+                                     WIFI_CODE_RATE_7_8,
+                                     4);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS12 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS12",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 3080000000ULL,
+                                     WIFI_CODE_RATE_1_2,
+                                     16);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS13 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS13",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 3850000000ULL,
+                                     WIFI_CODE_RATE_5_8,
+                                     16);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS14 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS14",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 4620000000ULL,
+                                     WIFI_CODE_RATE_3_4,
+                                     16);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS15 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS15",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 5005000000ULL,
+                                     WIFI_CODE_RATE_13_16,
+                                     16);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS16 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS16",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 5390000000ULL,
+                                     WIFI_CODE_RATE_7_8,
+                                     16);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS17 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS17",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 4620000000ULL,
+                                     WIFI_CODE_RATE_1_2,
+                                     64);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS18 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS18",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 5775000000ULL,
+                                     WIFI_CODE_RATE_5_8,
+                                     64);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS19 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS19",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 6930000000ULL,
+                                     WIFI_CODE_RATE_3_4,
+                                     64);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS20 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS20",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 7507500000ULL,
+                                     WIFI_CODE_RATE_13_16,
+                                     64);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetEDMG_MCS21 ()
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("EDMG_MCS21",
+                                     WIFI_MOD_CLASS_EDMG_SC,
+                                     false,
+                                     1880000000, 8085000000ULL,
+                                     WIFI_CODE_RATE_7_8,
+                                     64);
+  return mode;
+}
+
 std::ostream& operator<< (std::ostream& os, enum WifiPhy::State state)
 {
   switch (state)
@@ -3943,6 +4375,28 @@ public:
     ns3::WifiPhy::GetDMG_MCS22 ();
     ns3::WifiPhy::GetDMG_MCS23 ();
     ns3::WifiPhy::GetDMG_MCS24 ();
+    /* Data Rates for 802.11ay PHY*/
+    ns3::WifiPhy::GetEDMG_MCS1 ();
+    ns3::WifiPhy::GetEDMG_MCS2 ();
+    ns3::WifiPhy::GetEDMG_MCS3 ();
+    ns3::WifiPhy::GetEDMG_MCS4 ();
+    ns3::WifiPhy::GetEDMG_MCS5 ();
+    ns3::WifiPhy::GetEDMG_MCS6 ();
+    ns3::WifiPhy::GetEDMG_MCS7 ();
+    ns3::WifiPhy::GetEDMG_MCS8 ();
+    ns3::WifiPhy::GetEDMG_MCS9 ();
+    ns3::WifiPhy::GetEDMG_MCS10 ();
+    ns3::WifiPhy::GetEDMG_MCS11 ();
+    ns3::WifiPhy::GetEDMG_MCS12 ();
+    ns3::WifiPhy::GetEDMG_MCS13 ();
+    ns3::WifiPhy::GetEDMG_MCS14 ();
+    ns3::WifiPhy::GetEDMG_MCS15 ();
+    ns3::WifiPhy::GetEDMG_MCS16 ();
+    ns3::WifiPhy::GetEDMG_MCS17 ();
+    ns3::WifiPhy::GetEDMG_MCS18 ();
+    ns3::WifiPhy::GetEDMG_MCS19 ();
+    ns3::WifiPhy::GetEDMG_MCS20 ();
+    ns3::WifiPhy::GetEDMG_MCS21 ();
   }
 } g_constructor;
 
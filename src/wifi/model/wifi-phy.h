@@ -88,6 +88,10 @@ struct mpduInfo
 #define OFDMSCMin           (aBRPminSCblocks * aSCBlockSize + aSCGILength) * 0.57
 #define OFDMBRPMin          aBRPminOFDMblocks * 242
 
+/* EDMG PHY Parameters */
+#define aEDMGTRNSubfield    768   /* TRN subfield length in chips for a single channel (6 x Golay 128) */
+#define EDMGTRNSubfield     NanoSeconds (ceil (aEDMGTRNSubfield * 0.57))
+
 /**
  * \brief receive notifications about phy events.
  */
@@ -419,6 +423,12 @@ public:
    * \return the duration of the PLCP preamble
    */
   static Time GetPlcpPreambleDuration (WifiTxVector txVector, WifiPreamble preamble);
+  /**
+   * \param txVector the transmission parameters used for this packet
+   *
+   * \return the duration of a single TRN field (TRN-Unit) appended to the packet
+   */
+  static Time GetTrnFieldDuration (WifiTxVector txVector);
   /**
    * \param size the number of bytes in the packet to send
    * \param txVector the TXVECTOR used for the transmission of this packet
@@ -447,6 +457,13 @@ public:
    * \return the number of bits in the PPDU.
    */
   uint64_t CaluclateTransmittedBits (uint32_t size, WifiTxVector txvector);
+  /**
+   * \param Nbits the number of uncoded bits in the payload
+   * \param payloadMode the EDMG SC mode used for the payload
+   *
+   * \return the number of LDPC coded bits in the payload.
+   */
+  static uint32_t CalculateEdmgCodedBits (uint32_t Nbits, WifiMode payloadMode);
   /**
    *
    * \return the total time spent sneding PPDUs.
@@ -1329,6 +1346,132 @@ public:
    * \return a WifiMode for Low Power SC PHY with MCS31.
    */
   static WifiMode GetDMG_MCS31 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS1.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS1.
+   */
+  static WifiMode GetEDMG_MCS1 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS2.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS2.
+   */
+  static WifiMode GetEDMG_MCS2 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS3.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS3.
+   */
+  static WifiMode GetEDMG_MCS3 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS4.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS4.
+   */
+  static WifiMode GetEDMG_MCS4 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS5.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS5.
+   */
+  static WifiMode GetEDMG_MCS5 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS6.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS6.
+   */
+  static WifiMode GetEDMG_MCS6 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS7.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS7.
+   */
+  static WifiMode GetEDMG_MCS7 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS8.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS8.
+   */
+  static WifiMode GetEDMG_MCS8 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS9.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS9.
+   */
+  static WifiMode GetEDMG_MCS9 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS10.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS10.
+   */
+  static WifiMode GetEDMG_MCS10 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS11.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS11.
+   */
+  static WifiMode GetEDMG_MCS11 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS12.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS12.
+   */
+  static WifiMode GetEDMG_MCS12 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS13.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS13.
+   */
+  static WifiMode GetEDMG_MCS13 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS14.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS14.
+   */
+  static WifiMode GetEDMG_MCS14 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS15.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS15.
+   */
+  static WifiMode GetEDMG_MCS15 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS16.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS16.
+   */
+  static WifiMode GetEDMG_MCS16 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS17.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS17.
+   */
+  static WifiMode GetEDMG_MCS17 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS18.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS18.
+   */
+  static WifiMode GetEDMG_MCS18 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS19.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS19.
+   */
+  static WifiMode GetEDMG_MCS19 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS20.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS20.
+   */
+  static WifiMode GetEDMG_MCS20 ();
+  /**
+   * Return a WifiMode for EDMG SC PHY with MCS21.
+   *
+   * \return a WifiMode for EDMG SC PHY with MCS21.
+   */
+  static WifiMode GetEDMG_MCS21 ();
   /**
    * Sets the antenna type.
    *
@@ -1906,6 +2049,11 @@ private:
    * DoInitialize () is called.  
    */
   void InitializeFrequencyChannelNumber (void);
+  /**
+   * Re-weight the interference of the active directional signals once the
+   * receive beam of the directional antenna has changed.
+   */
+  void NotifyRxBeamChange (void);
   /**
    * Configure WifiPhy with appropriate channel frequency and
    * supported rates for 802.11a standard.
@@ -1942,6 +2090,11 @@ private:
    * supported rates for 802.11ad standard.
    */
   void Configure80211ad (void);
+  /**
+   * Configure YansWifiPhy with appropriate channel frequency and
+   * supported rates for 802.11ay standard.
+   */
+  void Configure80211ay (void);
   /**
    * Configure WifiPhy with appropriate channel frequency and
    * supported rates for 802.11ac standard.
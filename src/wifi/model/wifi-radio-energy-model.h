@@ -308,16 +308,20 @@ public:
   WifiRadioEnergyModelPhyListener * GetPhyListener (void);
 
 
-private:
-  void DoDispose (void);
+protected:
+  virtual void DoDispose (void);
 
   /**
    * \returns Current draw of device, at current state.
    *
-   * Implements DeviceEnergyModel::GetCurrentA.
+   * Implements DeviceEnergyModel::GetCurrentA. The energy consumed in a state is
+   * accounted with the current returned by this function, so subclasses can refine
+   * the current draw of a state.
    */
   virtual double DoGetCurrentA (void) const;
 
+private:
+
   /**
    * \param state New state the radio device is currently in.
    *
@@ -358,6 +358,10 @@ WifiRemoteStationManager::GetTypeId (void)
                      "The transmission of an MPDU  packet by the MAC layer has successed",
                      MakeTraceSourceAccessor (&WifiRemoteStationManager::m_macTxOk),
                      "ns3::Mac48Address::TracedCallback")
+    .AddTraceSource ("MacRxOK",
+                     "A frame has been received successfully from a remote station",
+                     MakeTraceSourceAccessor (&WifiRemoteStationManager::m_macRxOk),
+                     "ns3::WifiRemoteStationManager::RxOkTracedCallback")
   ;
   return tid;
 }
@@ -784,6 +788,13 @@ WifiRemoteStationManager::GetDmgTxVector (Mac48Address address, const WifiMacHea
       v.SetTrainngFieldLength (header->GetTrainngFieldLength ());
     }
 
+  /* Poll and SPR frames exchanged over the trained link during the ATI */
+  if (header->IsPollFrame () || header->IsSprFrame () || header->IsGrantFrame ())
+    {
+      v.SetMode (WifiMode ("DMG_MCS1"));
+      v.SetTrainngFieldLength (0);
+    }
+
   /* Beamforming */
   if (header->IsDMGBeacon () || header->IsSSW () || header->IsSSW_FBCK () || header->IsSSW_ACK ())
     {
@@ -939,6 +950,7 @@ WifiRemoteStationManager::ReportRxOk (Mac48Address address, const WifiMacHeader
     }
   WifiRemoteStation *station = Lookup (address, header);
   m_rxCallbackOk (address);
+  m_macRxOk (address, rxSnr);
   DoReportRxOk (station, rxSnr, txMode);
 }
 
@@ -1571,6 +1583,11 @@ WifiRemoteStationManager::LookupState (Mac48Address address) const
   state->m_shortGuardInterval = m_wifiPhy->GetGuardInterval ();
   state->m_greenfield = m_wifiPhy->GetGreenfield ();
   state->m_rx = 1;
+  if (m_wifiPhy->GetStandard () == WIFI_PHY_STANDARD_80211ay)
+    {
+      /* Assume the peer EDMG STA can receive as many spatial streams as we can */
+      state->m_rx = m_wifiPhy->GetNumberOfReceiveAntennas ();
+    }
   state->m_ness = 0;
   state->m_aggregation = false;
   state->m_stbc = false;
@@ -802,6 +802,14 @@ public:
    */
   typedef void (*RateChangeTracedCallback)(uint32_t rate, Mac48Address remoteAddress);
 
+  /**
+   * TracedCallback signature for successful reception events.
+   *
+   * \param [in] address The remote station MAC address.
+   * \param [in] snr The SNR of the received frame (linear ratio).
+   */
+  typedef void (*RxOkTracedCallback)(Mac48Address remoteAddress, double snr);
+
   /**
    * Return the states of the assoicated stations.
    *
@@ -1323,6 +1331,10 @@ private:
    * The trace source fired when the transmission of a single MPDU has successed.
    */
   TracedCallback<Mac48Address> m_macTxOk;
+  /**
+   * The trace source fired when a frame has been received successfully from a remote station.
+   */
+  TracedCallback<Mac48Address, double> m_macRxOk;
 
   Callback<void, Mac48Address> m_txCallbackOk;
   Callback<void, Mac48Address> m_rxCallbackOk;
@@ -22,6 +22,8 @@
 
 #include "ns3/wifi-tx-vector.h"
 #include "ns3/fatal-error.h"
+#include "ns3/assert.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -35,10 +37,17 @@ WifiTxVector::WifiTxVector ()
     m_stbc (false),
     m_modeInitialized (false),
     m_txPowerLevelInitialized (false),
+    m_packetType (TRN_R),
     m_traingFieldLength (0),
     m_beamTrackingRequest (false),
-    m_lastRssi (0)
+    m_lastRssi (0),
+    m_edmgTrnUnitP (2),
+    m_edmgTrnUnitM (4)
 {
+  for (uint8_t stream = 0; stream < MAX_EDMG_SPATIAL_STREAMS; stream++)
+    {
+      m_streamAntennaId[stream] = stream + 1;
+    }
 }
 
 WifiTxVector::WifiTxVector (WifiMode mode, uint8_t powerLevel, uint8_t retries,
@@ -55,10 +64,17 @@ WifiTxVector::WifiTxVector (WifiMode mode, uint8_t powerLevel, uint8_t retries,
     m_stbc (stbc),
     m_modeInitialized (true),
     m_txPowerLevelInitialized (true),
+    m_packetType (TRN_R),
     m_traingFieldLength (0),
     m_beamTrackingRequest (false),
-    m_lastRssi (0)
+    m_lastRssi (0),
+    m_edmgTrnUnitP (2),
+    m_edmgTrnUnitM (4)
 {
+  for (uint8_t stream = 0; stream < MAX_EDMG_SPATIAL_STREAMS; stream++)
+    {
+      m_streamAntennaId[stream] = stream + 1;
+    }
 }
 
 WifiMode
@@ -227,6 +243,50 @@ WifiTxVector::GetLastRssi (void) const
   return m_lastRssi;
 }
 
+uint8_t
+WifiTxVector::GetNumberOfBondedChannels (void) const
+{
+  return std::max<uint32_t> (1, m_channelWidth / 2160);
+}
+
+void
+WifiTxVector::SetStreamAntennaId (uint8_t stream, uint8_t antennaId)
+{
+  NS_ASSERT_MSG (stream < MAX_EDMG_SPATIAL_STREAMS, "Invalid spatial stream index");
+  m_streamAntennaId[stream] = antennaId;
+}
+
+uint8_t
+WifiTxVector::GetStreamAntennaId (uint8_t stream) const
+{
+  NS_ASSERT_MSG (stream < MAX_EDMG_SPATIAL_STREAMS, "Invalid spatial stream index");
+  return m_streamAntennaId[stream];
+}
+
+void
+WifiTxVector::SetEdmgTrnUnitP (uint8_t p)
+{
+  m_edmgTrnUnitP = p;
+}
+
+uint8_t
+WifiTxVector::GetEdmgTrnUnitP (void) const
+{
+  return m_edmgTrnUnitP;
+}
+
+void
+WifiTxVector::SetEdmgTrnUnitM (uint8_t m)
+{
+  m_edmgTrnUnitM = m;
+}
+
+uint8_t
+WifiTxVector::GetEdmgTrnUnitM (void) const
+{
+  return m_edmgTrnUnitM;
+}
+
 std::ostream & operator << ( std::ostream &os, const WifiTxVector &v)
 {
   os << "mode: " << v.GetMode () <<
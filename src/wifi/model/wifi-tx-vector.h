@@ -28,6 +28,8 @@
 
 namespace ns3 {
 
+/* Maximum number of EDMG spatial streams (802.11ay SU-MIMO) */
+#define MAX_EDMG_SPATIAL_STREAMS  4
 
 /**
  * This class mimics the TXVECTOR which is to be
@@ -235,6 +237,44 @@ public:
    */
   uint8_t GetLastRssi (void) const;
 
+  /* EDMG Tx Vector */
+
+  /**
+   * \returns the number of 2.16 GHz channels bonded together by this transmission.
+   */
+  uint8_t GetNumberOfBondedChannels (void) const;
+  /**
+   * Map a spatial stream onto one of the antenna arrays of the DirectionalAntenna.
+   * \param stream The index of the spatial stream [0, MAX_EDMG_SPATIAL_STREAMS).
+   * \param antennaId The ID of the antenna array transmitting this stream.
+   */
+  void SetStreamAntennaId (uint8_t stream, uint8_t antennaId);
+  /**
+   * \param stream The index of the spatial stream [0, MAX_EDMG_SPATIAL_STREAMS).
+   * \return The ID of the antenna array transmitting this stream.
+   */
+  uint8_t GetStreamAntennaId (uint8_t stream) const;
+  /**
+   * Set the number of TRN subfields at the start of each EDMG TRN-Unit that are
+   * transmitted with the same AWV as the preamble (EDMG TRN-Unit P).
+   * \param p The value of EDMG TRN-Unit P.
+   */
+  void SetEdmgTrnUnitP (uint8_t p);
+  /**
+   * \return The value of EDMG TRN-Unit P.
+   */
+  uint8_t GetEdmgTrnUnitP (void) const;
+  /**
+   * Set the number of TRN subfields in an EDMG TRN-Unit that may be used
+   * for AWV changes (EDMG TRN-Unit M).
+   * \param m The value of EDMG TRN-Unit M.
+   */
+  void SetEdmgTrnUnitM (uint8_t m);
+  /**
+   * \return The value of EDMG TRN-Unit M.
+   */
+  uint8_t GetEdmgTrnUnitM (void) const;
+
 private:
   WifiMode    m_mode;               /**< The DATARATE parameter in Table 15-4.
                                          It is the value that will be passed
@@ -259,6 +299,10 @@ private:
   bool        m_beamTrackingRequest;      //*!< Flag to indicate the need for beam tracking. */
   uint8_t     m_lastRssi;                 //*!< Last Received Signal Strength Indicator. */
 
+  uint8_t     m_streamAntennaId[MAX_EDMG_SPATIAL_STREAMS]; //*!< Antenna array ID used by each spatial stream. */
+  uint8_t     m_edmgTrnUnitP;             //*!< EDMG TRN-Unit P. */
+  uint8_t     m_edmgTrnUnitM;             //*!< EDMG TRN-Unit M. */
+
 };
 
 /**
@@ -124,6 +124,7 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
 //  Ptr<AbstractAntenna> senderAnt = sender->GetAntenna();
   Ptr<DirectionalAntenna> senderAnt = sender->GetDirectionalAntenna ();
   double rxPowerDbm;
+  double rxGainDbi;
   Time delay; /* Propagation delay of the signal */
   Ptr<MobilityModel> receiverMobility;
   for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
@@ -172,9 +173,10 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
                                 << ", Gtx=" << senderAnt->GetTxGainDbi (azimuthTx)
                                 << ", Grx=" << (*i)->GetDirectionalAntenna ()->GetRxGainDbi (azimuthRx));
 
+                  rxGainDbi = (*i)->GetDirectionalAntenna ()->GetRxGainDbi (azimuthRx);
                   rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +
                                senderAnt->GetTxGainDbi (azimuthTx) +                            // Sender's antenna gain.
-                               (*i)->GetDirectionalAntenna ()->GetRxGainDbi (azimuthRx);        // Receiver's antenna gain.
+                               rxGainDbi;                                                       // Receiver's antenna gain.
 
                   /* External Attenuator */
                   if ((m_blockage != 0) &&
@@ -188,6 +190,7 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
               else
                 {
                   rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) ;
+                  rxGainDbi = 0;
                 }
 
               NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
@@ -212,6 +215,8 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
               parameters.duration = duration;
               parameters.txVector = txVector;
               parameters.preamble = preamble;
+              parameters.rxAngle = azimuthRx;
+              parameters.rxGainDbi = rxGainDbi;
               NS_LOG_DEBUG ("Receiving Node ID=" << dstNode);
 
               Simulator::ScheduleWithContext (dstNode, delay, &YansWifiChannel::Receive, this, j, copy, parameters);
@@ -267,7 +272,8 @@ YansWifiChannel::Receive (uint32_t i, Ptr<Packet> packet, struct Parameters para
 {
   NS_LOG_FUNCTION (this << i << packet);
   m_phyList[i]->StartReceivePreambleAndHeader (packet, parameters.rxPowerDbm, parameters.txVector,
-                                               parameters.preamble, parameters.type, parameters.duration);
+                                               parameters.preamble, parameters.type, parameters.duration,
+                                               parameters.rxAngle, parameters.rxGainDbi);
 }
 
 void
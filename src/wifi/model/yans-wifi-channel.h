@@ -44,6 +44,8 @@ struct Parameters
   Time duration;
   WifiTxVector txVector;
   WifiPreamble preamble;
+  double rxAngle;     //!< Azimuth angle of arrival at the receiver (radians).
+  double rxGainDbi;   //!< Receive antenna gain included in rxPowerDbm (dBi).
 };
 
 /**
@@ -30,6 +30,7 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/double.h"
+#include "ns3/trace-source-accessor.h"
 #include "ampdu-tag.h"
 #include <cmath>
 
@@ -46,6 +47,10 @@ YansWifiPhy::GetTypeId (void)
     .SetParent<WifiPhy> ()
     .SetGroupName ("Wifi")
     .AddConstructor<YansWifiPhy> ()
+    .AddTraceSource ("PhyTrnRxBegin",
+                     "Trace source indicating the start of the reception of a TRN field.",
+                     MakeTraceSourceAccessor (&YansWifiPhy::m_phyTrnRxBeginTrace),
+                     "ns3::YansWifiPhy::TrnRxBeginTracedCallback")
   ;
   return tid;
 }
@@ -55,6 +60,7 @@ YansWifiPhy::YansWifiPhy ()
   NS_LOG_FUNCTION (this);
   m_antenna = 0;
   m_rdsActivated = false;
+  m_psduSuccess = false;
 }
 
 YansWifiPhy::~YansWifiPhy ()
@@ -266,13 +272,15 @@ YansWifiPhy::StartReceivePreambleAndHeader (Ptr<Packet> packet,
                                             WifiTxVector txVector,
                                             enum WifiPreamble preamble,
                                             enum mpduType mpdutype,
-                                            Time rxDuration)
+                                            Time rxDuration,
+                                            double rxAngle,
+                                            double rxGainDbi)
 {
   //This function should be later split to check separately whether plcp preamble and plcp header can be successfully received.
   //Note: plcp preamble reception is not yet modeled.
   NS_LOG_FUNCTION (this << packet << rxPowerDbm << txVector.GetMode () << preamble << (uint32_t)mpdutype);
   AmpduTag ampduTag;
-  Time totalDuration = rxDuration + txVector.GetTrainngFieldLength () * TRNUnit;
+  Time totalDuration = rxDuration + txVector.GetTrainngFieldLength () * GetTrnFieldDuration (txVector);
   rxPowerDbm += GetRxGain ();
   m_rxDuration = totalDuration; // Duraion of the last frame
   double rxPowerW = DbmToW (rxPowerDbm);
@@ -286,11 +294,24 @@ YansWifiPhy::StartReceivePreambleAndHeader (Ptr<Packet> packet,
     }
 
   Ptr<InterferenceHelper::Event> event;
-  event = m_interference.Add (packet->GetSize (),
-                              txVector,
-                              preamble,
-                              totalDuration,
-                              rxPowerW);
+  if (m_directionalAntenna != 0)
+    {
+      event = m_interference.Add (packet->GetSize (),
+                                  txVector,
+                                  preamble,
+                                  totalDuration,
+                                  rxPowerW,
+                                  rxAngle,
+                                  rxGainDbi);
+    }
+  else
+    {
+      event = m_interference.Add (packet->GetSize (),
+                                  txVector,
+                                  preamble,
+                                  totalDuration,
+                                  rxPowerW);
+    }
 
   switch (m_state->GetState ())
     {
@@ -418,7 +439,7 @@ YansWifiPhy::StartReceivePreambleAndHeader (Ptr<Packet> packet,
 
               NS_ASSERT (m_endPlcpRxEvent.IsExpired ());
               NotifyRxBegin (packet);
-              m_interference.NotifyRxStart ();
+              m_interference.NotifyRxStart (event);
 
               if (preamble != WIFI_PREAMBLE_NONE)
                 {
@@ -497,7 +518,16 @@ YansWifiPhy::StartReceivePacket (Ptr<Packet> packet,
 
   if (m_random->GetValue () > snrPer.per) //plcp reception succeeded
     {
-      if (IsModeSupported (txMode) || IsMcsSupported (txMode))
+      if ((txMode.GetModulationClass () == WIFI_MOD_CLASS_EDMG_SC)
+          && ((txVector.GetChannelWidth () > GetChannelWidth ())
+              || (m_directionalAntenna == 0) || (txVector.GetNss () > m_directionalAntenna->GetNumberOfAntennas ())))
+        {
+          NS_LOG_DEBUG ("drop packet because we cannot receive " << txVector.GetChannelWidth () << " MHz with "
+                        << uint16_t (txVector.GetNss ()) << " spatial streams");
+          NotifyRxDrop (packet);
+          m_plcpSuccess = false;
+        }
+      else if (IsModeSupported (txMode) || IsMcsSupported (txMode))
         {
           NS_LOG_DEBUG ("receiving plcp payload"); //endReceive is already scheduled
           m_plcpSuccess = true;
@@ -537,7 +567,36 @@ YansWifiPhy::SendPacket (Ptr<const Packet> packet, WifiTxVector txVector, WifiPr
    */
   NS_ASSERT (!m_state->IsStateTx () && !m_state->IsStateSwitching ());
 
-  if (txVector.GetNss () > GetNumberOfTransmitAntennas ())
+  if (txVector.GetMode ().GetModulationClass () == WIFI_MOD_CLASS_EDMG_SC)
+    {
+      /* Each EDMG spatial stream is transmitted by a separate antenna array */
+      if ((m_directionalAntenna == 0) || (txVector.GetNss () > m_directionalAntenna->GetNumberOfAntennas ())
+          || (txVector.GetNss () > MAX_EDMG_SPATIAL_STREAMS))
+        {
+          NS_FATAL_ERROR ("Less antenna arrays than number of spatial streams!");
+        }
+      for (uint8_t stream = 0; stream < txVector.GetNss (); stream++)
+        {
+          uint8_t antennaId = txVector.GetStreamAntennaId (stream);
+          if ((antennaId == 0) || (antennaId > m_directionalAntenna->GetNumberOfAntennas ()))
+            {
+              NS_FATAL_ERROR ("Spatial stream " << uint16_t (stream) << " mapped to invalid antenna array " << uint16_t (antennaId));
+            }
+          for (uint8_t other = 0; other < stream; other++)
+            {
+              if (txVector.GetStreamAntennaId (other) == antennaId)
+                {
+                  NS_FATAL_ERROR ("Spatial streams " << uint16_t (other) << " and " << uint16_t (stream)
+                                  << " are mapped to the same antenna array");
+                }
+            }
+        }
+      if (txVector.GetChannelWidth () > GetChannelWidth ())
+        {
+          NS_FATAL_ERROR ("Channel width " << txVector.GetChannelWidth () << " exceeds the operating channel width");
+        }
+    }
+  else if (txVector.GetNss () > GetNumberOfTransmitAntennas ())
     {
       NS_FATAL_ERROR ("Less TX antennas than number of spatial streams!");
     }
@@ -559,7 +618,7 @@ YansWifiPhy::SendPacket (Ptr<const Packet> packet, WifiTxVector txVector, WifiPr
        (mpdutype == LAST_MPDU_IN_AGGREGATE && preamble == WIFI_PREAMBLE_NONE)) && (txVector.GetTrainngFieldLength () > 0))
     {
       NS_LOG_DEBUG ("Send TRN Fields:" << txVector.GetTrainngFieldLength ());
-      txDuration += txVector.GetTrainngFieldLength () * TRNUnit;
+      txDuration += txVector.GetTrainngFieldLength () * GetTrnFieldDuration (txVector);
       sendTrnFields = true;
     }
 
@@ -617,7 +676,7 @@ YansWifiPhy::SendTrnField (WifiTxVector txVector, uint8_t fieldsRemaining)
   fieldsRemaining--;
   if (fieldsRemaining != 0)
     {
-      Simulator::Schedule (TRNUnit, &YansWifiPhy::SendTrnField, this, txVector, fieldsRemaining);
+      Simulator::Schedule (GetTrnFieldDuration (txVector), &YansWifiPhy::SendTrnField, this, txVector, fieldsRemaining);
     }
 
   m_channel->SendTrn (this, GetPowerDbm (txVector.GetTxPowerLevel ()) + GetTxGain (), txVector, fieldsRemaining);
@@ -628,16 +687,18 @@ YansWifiPhy::StartReceiveTrnField (WifiTxVector txVector, double rxPowerDbm, uin
 {
   NS_LOG_FUNCTION (this << txVector.GetMode () << rxPowerDbm << fieldsRemaining);
   double rxPowerW = DbmToW (rxPowerDbm);
-  if (m_plcpSuccess)
+  /* TRN fields are only meaningful while we are receiving the frame they are appended to */
+  if (m_plcpSuccess && IsStateRx ())
     {
       /* Add Interference event for TRN field */
       Ptr<InterferenceHelper::Event> event;
       event = m_interference.Add (txVector,
-                                  TRNUnit,
+                                  GetTrnFieldDuration (txVector),
                                   rxPowerW);
+      m_phyTrnRxBeginTrace (txVector, fieldsRemaining);
 
       /* Schedule an event for the complete reception of this TRN Field */
-      Simulator::Schedule (TRNUnit, &YansWifiPhy::EndReceiveTrnField, this,
+      Simulator::Schedule (GetTrnFieldDuration (txVector), &YansWifiPhy::EndReceiveTrnField, this,
                            m_directionalAntenna->GetCurrentRxSectorID (), m_directionalAntenna->GetCurrentRxAntennaID (),
                            txVector, fieldsRemaining, event);
 
@@ -660,6 +721,13 @@ YansWifiPhy::EndReceiveTrnField (uint8_t sectorId, uint8_t antennaId,
 {
   NS_LOG_FUNCTION (this << sectorId << antennaId << txVector.GetMode () << fieldsRemaining << event);
 
+  /* The reception has been aborted (e.g. we started transmitting) */
+  if (!IsStateRx ())
+    {
+      NS_LOG_DEBUG ("Drop TRN Field because the reception has been aborted");
+      return;
+    }
+
   /* Calculate SNR and report it to the upper layer */
   double snr;
   snr = m_interference.CalculatePlcpTrnSnr (event);
@@ -689,6 +757,18 @@ YansWifiPhy::EndReceiveTrnFields (void)
     }
 }
 
+std::vector<double>
+YansWifiPhy::CalculateRxSectorSnrs (uint8_t antennaId) const
+{
+  NS_LOG_FUNCTION (this << uint (antennaId));
+  Ptr<InterferenceHelper::Event> event = m_interference.GetRxEvent ();
+  if ((m_directionalAntenna == 0) || (event == 0) || !event->IsDirectional ())
+    {
+      return std::vector<double> ();
+    }
+  return m_interference.CalculateRxSectorSnrs (event, antennaId);
+}
+
 void
 YansWifiPhy::RegisterReportSnrCallback (ReportSnrCallback callback)
 {
@@ -52,6 +52,14 @@ public:
   YansWifiPhy ();
   virtual ~YansWifiPhy ();
 
+  /**
+   * TracedCallback signature for the start of a TRN field reception.
+   *
+   * \param txVector The TXVECTOR of the BRP packet carrying the TRN field.
+   * \param fieldsRemaining The number of TRN fields remaining after this one.
+   */
+  typedef void (* TrnRxBeginTracedCallback)(WifiTxVector txVector, uint8_t fieldsRemaining);
+
   /**
    * Set the YansWifiChannel this YansWifiPhy is to be connected to.
    *
@@ -68,13 +76,17 @@ public:
    * \param preamble the preamble of the arriving packet
    * \param mpdutype the type of the MPDU as defined in WifiPhy::mpduType.
    * \param rxDuration the duration needed for the reception of the packet
+   * \param rxAngle the azimuth angle of arrival of the packet (radians)
+   * \param rxGainDbi the receive antenna gain included in rxPowerDbm (dBi)
    */
   void StartReceivePreambleAndHeader (Ptr<Packet> packet,
                                       double rxPowerDbm,
                                       WifiTxVector txVector,
                                       WifiPreamble preamble,
                                       enum mpduType mpdutype,
-                                      Time rxDuration);
+                                      Time rxDuration,
+                                      double rxAngle,
+                                      double rxGainDbi);
   /**
    * Starting receiving the payload of a packet (i.e. the first bit of the packet has arrived).
    *
@@ -117,6 +129,14 @@ public:
    * This method is called once all the TRN Fields are received.
    */
   void EndReceiveTrnFields (void);
+  /**
+   * Calculate the SNIR of the packet we are currently receiving for every
+   * receive sector of an antenna, as if it were received through that sector.
+   * \param antennaId The ID of the candidate receive antenna.
+   * \return The SNIR (linear) of each sector indexed by sector ID - 1, or an
+   * empty vector if we are not receiving a directional packet.
+   */
+  std::vector<double> CalculateRxSectorSnrs (uint8_t antennaId) const;
 
   virtual void RegisterListener (WifiPhyListener *listener);
   virtual void UnregisterListener (WifiPhyListener *listener);
@@ -188,6 +208,7 @@ private:
   uint8_t m_dstAntenna;
   uint8_t m_rdsSector;
   uint8_t m_rdsAntenna;
+  TracedCallback<WifiTxVector, uint8_t> m_phyTrnRxBeginTrace; //!< Trace source for the start of a TRN field reception.
 
 };
 